@@ -9,11 +9,61 @@
 #define Utilities_DropDetectorConfig_HPP
 #include "Fw/FPrimeBasicTypes.hpp"
 namespace Utilities {
-//! Number of chunks of data to process per rate tick
+//! Number of chunks of data to process per rate tick when no tick budget is set
 constexpr FwSizeType DROP_DETECTOR_CHUNKS_PER_RATE_TICK = 20;
 
+//! Upper bound on chunks of data processed per rate tick when a tick budget is set. Bounds the tick when only a time
+//! budget is set and time is unavailable, and when packets cost no bytes (sparse file holes). Sized for one tick: 1024
+//! packets of a few KiB each are a few MiB of I/O.
+constexpr FwSizeType DROP_DETECTOR_MAX_CHUNKS_PER_RATE_TICK = 1024;
+
+//! Number of packets scanned per batch by the ActiveDropDetector before yielding to its queue
+constexpr FwSizeType DROP_DETECTOR_ACTIVE_PACKETS_PER_BATCH = 1024;
+
+//! Delay in microseconds taken by the ActiveDropDetector between batches. 0 yields only to messages on its queue and
+//! to higher-priority tasks, which scans at full disk speed when the CPU is otherwise idle.
+constexpr U32 DROP_DETECTOR_ACTIVE_BATCH_DELAY_US = 0;
+
+//! Maximum number of packets of an uplinked file tracked by the StreamDropDetector, which holds one bit per packet
+constexpr FwSizeType DROP_DETECTOR_STREAM_MAX_PACKETS = 64 * 1024;
+
+//! Suffix appended to the path of an uplinked file to name the drop bitmap file written by the StreamDropDetector
+constexpr const char* DROP_DETECTOR_STREAM_BITMAP_SUFFIX = ".drops";
+
+//! Number of packets scanned by the DropDetector between writes of its checkpoint file. The checkpoint is also written
+//! when a detection ends. Each write costs a small file write and rename within a rate tick.
+constexpr FwSizeType DROP_DETECTOR_CHECKPOINT_INTERVAL = 1000;
+
 //! Size of stack buffer for file reads
 constexpr FwSizeType DROP_DETECTOR_FILE_READ_BUFFER_SIZE = 256;
 
+//! Size in bytes of the buffer of CRC32 manifest entries read at a time when verifying packets against a manifest. Must
+//! be a multiple of 4 bytes.
+constexpr FwSizeType DROP_DETECTOR_MANIFEST_BUFFER_SIZE = 1024;
+
+//! Size of the window mapped into memory when scanning in memory-mapped mode (Linux only). Rounded down to a multiple
+//! of the page size. Set to 0 to always scan through Os::File reads.
+constexpr FwSizeType DROP_DETECTOR_MAP_WINDOW_SIZE = 16 * 1024 * 1024;
+
+//! Classify packets lying entirely within a sparse file hole as possible drops without reading them (Linux only).
+//! Holes are found with SEEK_HOLE/SEEK_DATA. File systems without hole support report no holes.
+constexpr bool DROP_DETECTOR_HOLE_DETECTION = true;
+
+//! Maximum number of worker threads used to scan a file in parallel mode
+constexpr FwSizeType DROP_DETECTOR_PARALLEL_MAX_THREADS = 4;
+
+//! Bytes in each share of a file scanned by one worker in parallel mode. Each worker scans one share ahead of the
+//! caller, which waits on at most one share when the workers have not kept ahead.
+constexpr FwSizeType DROP_DETECTOR_PARALLEL_BYTES_PER_SHARE = 256 * 1024;
+
+//! Maximum packets in each share in parallel mode. Sizes each worker's result storage.
+constexpr FwSizeType DROP_DETECTOR_PARALLEL_MAX_PACKETS_PER_SHARE = 1024;
+
+//! Size of each worker's read buffer in parallel mode. Workers are allocated by DropScanner::configure only.
+constexpr FwSizeType DROP_DETECTOR_PARALLEL_READ_BUFFER_SIZE = 32 * 1024;
+
+//! Size of the buffer staging drop bitmap bits before they are written to the bitmap file
+constexpr FwSizeType DROP_DETECTOR_BITMAP_BUFFER_SIZE = 256;
+
 }  // namespace Utilities
 #endif // Utilities_DropDetectorConfig_HPP
\ No newline at end of file
@@ -0,0 +1,73 @@
+// ======================================================================
+// \title  FileHelperConfig.hpp
+// \author starchmd
+// \brief  hpp file for FileHelper configuration
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+
+#ifndef Utilities_FileHelperConfig_HPP
+#define Utilities_FileHelperConfig_HPP
+#include "Fw/FPrimeBasicTypes.hpp"
+namespace Utilities {
+//! Size of the stack buffer staging byte-swapped array elements before they are written by FileHelper::writeArray.
+//! Must be a multiple of 8 bytes.
+constexpr FwSizeType FILE_HELPER_STAGING_BUFFER_SIZE = 1024;
+
+//! Size of the pieces in which the CRC-fused FileHelper functions fold data into the CRC next to each read or write,
+//! and of the stack buffer of FileHelper::copyFileCrc32 and FileHelper::crc32OfFile
+constexpr FwSizeType FILE_HELPER_CRC_CHUNK_SIZE = 4096;
+
+//! Bytes moved by each kernel copy call of FileHelper::copyFile, and so between its progress reports, and the size of the
+//! buffer it draws from the caller's allocator to copy through in user space
+constexpr FwSizeType FILE_HELPER_COPY_CHUNK_SIZE = 1024 * 1024;
+
+//! Bytes read by each read call of the FileHelper::readFromFile overload loading a whole file into allocated memory
+constexpr FwSizeType FILE_HELPER_LOAD_CHUNK_SIZE = 1024 * 1024;
+
+//! Capacity of the buffer held by FileHelper::StaticBufferedWriter and FileHelper::StaticBufferedReader when no
+//! capacity is given
+constexpr FwSizeType FILE_HELPER_STREAM_BUFFER_SIZE = 4096;
+
+//! Size of the staging buffer of FileHelper::FileSerializer and FileHelper::FileDeserializer. Serializables with a
+//! SERIALIZED_SIZE above this are streamed through the staging buffer by writeToFile and readFromFile rather than
+//! serialized in a stack buffer of their full size. Must be at least 8 bytes.
+constexpr FwSizeType FILE_HELPER_SERIAL_STAGING_SIZE = 256;
+
+//! Capacity of the buffer held by FileHelper::StaticJournal, which bounds the size of each record
+constexpr FwSizeType FILE_HELPER_JOURNAL_BUFFER_SIZE = 4096;
+
+//! Number of pending records committing a FileHelper::Journal by default, 0 to not commit on a count
+constexpr FwSizeType FILE_HELPER_JOURNAL_GROUP_RECORDS = 1;
+
+//! Microseconds the oldest pending record waits before committing a FileHelper::Journal by default, 0 to not commit
+//! on time
+constexpr U32 FILE_HELPER_JOURNAL_GROUP_WINDOW_US = 0;
+
+//! Suffix of the temporary file written while truncating a damaged FileHelper::Journal
+constexpr const char* FILE_HELPER_JOURNAL_TEMP_SUFFIX = ".tmp";
+
+//! Number of entries held by a FileHelper::KeyValueStore. Must be a power of two.
+constexpr FwSizeType FILE_HELPER_KV_MAX_ENTRIES = 64;
+
+//! Maximum length of a string key of a FileHelper::KeyValueStore
+constexpr FwSizeType FILE_HELPER_KV_MAX_KEY_SIZE = 32;
+
+//! Maximum serialized size of a value of a FileHelper::KeyValueStore
+constexpr FwSizeType FILE_HELPER_KV_MAX_VALUE_SIZE = 128;
+
+//! FileHelper::KeyValueStore::compactIfDue compacts once the log exceeds both this many times the size of the live
+//! entries and FILE_HELPER_KV_COMPACT_MIN_SIZE bytes
+constexpr FwSizeType FILE_HELPER_KV_COMPACT_RATIO = 4;
+constexpr FwSizeType FILE_HELPER_KV_COMPACT_MIN_SIZE = 16 * 1024;
+
+//! Suffix of the temporary file written while compacting a FileHelper::KeyValueStore
+constexpr const char* FILE_HELPER_KV_TEMP_SUFFIX = ".compact";
+
+//! Number of requests a FileHelper::AsyncFileHelper holds, queued or awaiting collection by poll
+constexpr FwSizeType FILE_HELPER_ASYNC_QUEUE_DEPTH = 16;
+
+//! Maximum number of worker threads of a FileHelper::AsyncFileHelper
+constexpr FwSizeType FILE_HELPER_ASYNC_MAX_THREADS = 2;
+
+}  // namespace Utilities
+#endif // Utilities_FileHelperConfig_HPP
@@ -0,0 +1,182 @@
+// ======================================================================
+// \title  ActiveDropDetector.cpp
+// \author starchmd
+// \brief  cpp file for ActiveDropDetector component implementation class
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+
+#include "FprimeExtras/Utilities/ActiveDropDetector/ActiveDropDetector.hpp"
+#include "ExtrasConfig/DropDetectorConfig.hpp"
+#include "Os/Task.hpp"
+
+namespace Utilities {
+
+// ----------------------------------------------------------------------
+// Component construction and destruction
+// ----------------------------------------------------------------------
+
+ActiveDropDetector ::ActiveDropDetector(const char* const compName)
+    : ActiveDropDetectorComponentBase(compName),
+      m_batchQueued(false),
+      m_opCode(0),
+      m_cmdSeq(0) {}
+
+ActiveDropDetector ::~ActiveDropDetector() {}
+
+// ----------------------------------------------------------------------
+// Handler implementations for internal ports
+// ----------------------------------------------------------------------
+
+void ActiveDropDetector ::scanBatch_internalInterfaceHandler() {
+    this->m_batchQueued = false;
+    // A cancel may have been processed after this batch was queued
+    if (!this->m_scanner.isOpen()) {
+        return;
+    }
+    for (FwSizeType i = 0; i < Utilities::DROP_DETECTOR_ACTIVE_PACKETS_PER_BATCH; i++) {
+        const FwSizeType index = this->m_scanner.getIndex();
+        Os::File::Status fileStatus = Os::File::OP_OK;
+        DropScanner::PacketStatus status = this->m_scanner.readPacket(fileStatus);
+        // Check for file errors in the seek/read
+        if (fileStatus != Os::File::OP_OK) {
+            // File packets are reported as a one-based index because the no-data start packet is zero
+            this->log_WARNING_HI_FileReadError(index + 1, Os::FileStatus(static_cast<Os::FileStatus::T>(fileStatus)));
+            this->finishScan();
+            this->cmdResponse_out(this->m_opCode, this->m_cmdSeq, Fw::CmdResponse::OK);
+            return;
+        }
+        // Check for end of file and handle completion
+        if (status == DropScanner::PacketStatus::FILE_EOF) {
+            this->finishScan();
+            this->log_ACTIVITY_HI_DetectingDropsCompleted();
+            this->cmdResponse_out(this->m_opCode, this->m_cmdSeq, Fw::CmdResponse::OK);
+            return;
+        }
+        // Only parallel scans report packets not yet scanned, the packet is read again by the next batch
+        if (status == DropScanner::PacketStatus::NOT_READY) {
+            break;
+        }
+        this->recordPacket(index, status == DropScanner::PacketStatus::POSSIBLE_DROP);
+    }
+    this->tlmWrite_PacketsScanned(this->m_scanner.getIndex());
+    this->tlmWrite_BytesScanned(this->m_scanner.getBytesScanned());
+    if (Utilities::DROP_DETECTOR_ACTIVE_BATCH_DELAY_US > 0) {
+        Os::Task::delay(Fw::TimeInterval(0, Utilities::DROP_DETECTOR_ACTIVE_BATCH_DELAY_US));
+    }
+    this->queueBatch();
+}
+
+// ----------------------------------------------------------------------
+// Handler implementations for commands
+// ----------------------------------------------------------------------
+
+void ActiveDropDetector ::DETECT_DROPS_cmdHandler(FwOpcodeType opCode,
+                                                  U32 cmdSeq,
+                                                  const Fw::CmdStringArg& file,
+                                                  FwSizeType packet_size) {
+    this->startScan(opCode, cmdSeq, file, packet_size, nullptr);
+}
+
+void ActiveDropDetector ::CANCEL_DETECT_DROPS_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
+    // Canceling when no detection is running is not an error
+    if (this->m_scanner.isOpen()) {
+        // File packets are reported as a one-based index because the no-data start packet is zero
+        this->log_ACTIVITY_HI_DetectingDropsCanceled(this->m_scanner.getIndex() + 1);
+        this->finishScan();
+        this->cmdResponse_out(this->m_opCode, this->m_cmdSeq, Fw::CmdResponse::EXECUTION_ERROR);
+    }
+    this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::OK);
+}
+
+void ActiveDropDetector ::DETECT_DROPS_BITMAP_cmdHandler(FwOpcodeType opCode,
+                                                         U32 cmdSeq,
+                                                         const Fw::CmdStringArg& file,
+                                                         FwSizeType packet_size,
+                                                         const Fw::CmdStringArg& bitmap) {
+    this->startScan(opCode, cmdSeq, file, packet_size, &bitmap);
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+void ActiveDropDetector ::startScan(FwOpcodeType opCode,
+                                    U32 cmdSeq,
+                                    const Fw::CmdStringArg& file,
+                                    FwSizeType packet_size,
+                                    const Fw::CmdStringArg* bitmap) {
+    // Check if the component is already busy
+    if (this->m_scanner.isOpen()) {
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::BUSY);
+    }
+    // Check for valid packet size
+    else if (packet_size == 0) {
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::VALIDATION_ERROR);
+    }
+    // Check if the supplied file can be opened
+    else if (this->m_scanner.open(file.toChar(), packet_size) != Os::File::OP_OK) {
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::VALIDATION_ERROR);
+    }
+    // Check if the supplied bitmap file can be created
+    else if ((bitmap != nullptr) && (this->m_bitmap.open(bitmap->toChar(), packet_size) != Os::File::OP_OK)) {
+        this->m_scanner.close();
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::VALIDATION_ERROR);
+    }
+    // Start the drop detection
+    else {
+        this->log_ACTIVITY_HI_DetectingDrops();
+        this->log_ACTIVITY_HI_PossibleDrops_ThrottleClear();
+        this->m_opCode = opCode;
+        this->m_cmdSeq = cmdSeq;
+        this->m_ranges.reset();
+        this->queueBatch();
+    }
+}
+
+void ActiveDropDetector ::recordPacket(FwSizeType index, bool drop) {
+    // The bitmap is left open on a failed write such that its staged bits are written again, it is closed on finishing
+    if (this->m_bitmap.isOpen()) {
+        Os::File::Status status = this->m_bitmap.recordOrEnd(drop);
+        if (status != Os::File::OP_OK) {
+            this->log_WARNING_HI_BitmapWriteError(Os::FileStatus(static_cast<Os::FileStatus::T>(status)));
+        }
+    }
+    // Consecutive drops are coalesced into a range reported when the range ends
+    DropRanges::Range range;
+    if (this->m_ranges.record(index, drop, range)) {
+        this->reportRange(range);
+    }
+}
+
+void ActiveDropDetector ::reportRange(const DropRanges::Range& range) {
+    // File packets are reported as a one-based index because the no-data start packet is zero
+    this->log_ACTIVITY_HI_PossibleDrops(range.first + 1, range.last + 1);
+}
+
+void ActiveDropDetector ::finishScan() {
+    const FwSizeType packets = this->m_scanner.getIndex();
+    DropRanges::Range range;
+    if (this->m_ranges.finish(packets, range)) {
+        this->reportRange(range);
+    }
+    this->log_ACTIVITY_HI_DropSummary(packets, this->m_ranges.getDrops(), this->m_ranges.getRanges());
+    if (this->m_bitmap.isOpen()) {
+        Os::File::Status status = this->m_bitmap.close();
+        if (status != Os::File::OP_OK) {
+            this->log_WARNING_HI_BitmapWriteError(Os::FileStatus(static_cast<Os::FileStatus::T>(status)));
+        }
+    }
+    this->tlmWrite_PacketsScanned(packets);
+    this->tlmWrite_BytesScanned(this->m_scanner.getBytesScanned());
+    this->m_scanner.close();
+}
+
+void ActiveDropDetector ::queueBatch() {
+    // A batch left on the queue by a canceled scan picks up the new scan, so at most one batch is ever queued
+    if (!this->m_batchQueued) {
+        this->m_batchQueued = true;
+        this->scanBatch_internalInterfaceInvoke();
+    }
+}
+
+}  // namespace Utilities
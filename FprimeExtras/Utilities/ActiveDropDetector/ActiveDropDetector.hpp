@@ -0,0 +1,112 @@
+// ======================================================================
+// \title  ActiveDropDetector.hpp
+// \author starchmd
+// \brief  hpp file for ActiveDropDetector component implementation class
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+
+#ifndef Utilities_ActiveDropDetector_HPP
+#define Utilities_ActiveDropDetector_HPP
+
+#include "FprimeExtras/Utilities/ActiveDropDetector/ActiveDropDetectorComponentAc.hpp"
+#include "FprimeExtras/Utilities/DropBitmap/DropBitmap.hpp"
+#include "FprimeExtras/Utilities/DropBitmap/DropRanges.hpp"
+#include "FprimeExtras/Utilities/DropScanner/DropScanner.hpp"
+
+namespace Utilities {
+
+class ActiveDropDetector final : public ActiveDropDetectorComponentBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Component construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct ActiveDropDetector object
+    ActiveDropDetector(const char* const compName  //!< The component name
+    );
+
+    //! Destroy ActiveDropDetector object
+    ~ActiveDropDetector();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Handler implementations for internal ports
+    // ----------------------------------------------------------------------
+
+    //! Handler implementation for scanBatch
+    //!
+    //! Scan the next batch of packets
+    void scanBatch_internalInterfaceHandler() override;
+
+  private:
+    // ----------------------------------------------------------------------
+    // Handler implementations for commands
+    // ----------------------------------------------------------------------
+
+    //! Handler implementation for command DETECT_DROPS
+    //!
+    //! Search the specified file for sequences of zeros of length packet_size and report ranges of
+    //! their one-based indices via events.
+    void DETECT_DROPS_cmdHandler(FwOpcodeType opCode,  //!< The opcode
+                                 U32 cmdSeq,           //!< The command sequence number
+                                 const Fw::CmdStringArg& file,
+                                 FwSizeType packet_size) override;
+
+    //! Handler implementation for command CANCEL_DETECT_DROPS
+    //!
+    //! Cancel the drop detection in progress
+    void CANCEL_DETECT_DROPS_cmdHandler(FwOpcodeType opCode,  //!< The opcode
+                                        U32 cmdSeq            //!< The command sequence number
+                                        ) override;
+
+    //! Handler implementation for command DETECT_DROPS_BITMAP
+    //!
+    //! Search the specified file for sequences of zeros of length packet_size as DETECT_DROPS does, additionally
+    //! writing a one-bit-per-packet bitmap of the possible drops to the bitmap file.
+    void DETECT_DROPS_BITMAP_cmdHandler(FwOpcodeType opCode,  //!< The opcode
+                                        U32 cmdSeq,           //!< The command sequence number
+                                        const Fw::CmdStringArg& file,
+                                        FwSizeType packet_size,
+                                        const Fw::CmdStringArg& bitmap) override;
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Validate the detection arguments and start scanning, responding to the command on failure
+    void startScan(FwOpcodeType opCode,            //!< The opcode
+                   U32 cmdSeq,                     //!< The command sequence number
+                   const Fw::CmdStringArg& file,   //!< The file to scan
+                   FwSizeType packet_size,         //!< The packet size
+                   const Fw::CmdStringArg* bitmap  //!< The bitmap file to write, nullptr for none
+    );
+
+    //! Record a scanned packet in the bitmap file and the current range of drops
+    void recordPacket(FwSizeType index,  //!< Zero-based index of the packet
+                      bool drop          //!< The packet is a possible drop
+    );
+
+    //! Report a range of drops that ended
+    void reportRange(const DropRanges::Range& range  //!< Range of drops, as zero-based indices
+    );
+
+    //! Report the final range, summary, and progress, then close the bitmap file and scanner
+    void finishScan();
+
+    //! Queue the next batch unless one is already queued
+    void queueBatch();
+
+    DropScanner m_scanner;
+    DropBitmapWriter m_bitmap;
+    bool m_batchQueued;  //!< A scanBatch message is on the queue
+
+    FwOpcodeType m_opCode;
+    U32 m_cmdSeq;
+
+    DropRanges m_ranges;  //!< Drops and ranges of drops found in the current detection
+};
+
+}  // namespace Utilities
+
+#endif
@@ -0,0 +1,24 @@
+// ======================================================================
+// \title  ActiveDropDetectorTestMain.cpp
+// \author starchmd
+// \brief  cpp file for ActiveDropDetector component test main function
+// ======================================================================
+
+#include "ActiveDropDetectorTester.hpp"
+#include "STest/Random/Random.hpp"
+
+TEST_F(ActiveDropHarness, Drops) {
+    Utilities::ActiveDropDetectorTester tester;
+    tester.test_drops(*this);
+}
+
+TEST_F(ActiveDropHarness, Cancel) {
+    Utilities::ActiveDropDetectorTester tester;
+    tester.test_cancel(*this);
+}
+
+int main(int argc, char** argv) {
+    STest::Random::seed();
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
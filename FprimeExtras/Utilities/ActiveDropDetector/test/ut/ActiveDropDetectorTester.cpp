@@ -0,0 +1,146 @@
+// ======================================================================
+// \title  ActiveDropDetectorTester.cpp
+// \author starchmd
+// \brief  cpp file for ActiveDropDetector component test harness implementation class
+// ======================================================================
+
+#include "ActiveDropDetectorTester.hpp"
+#include "ExtrasConfig/DropDetectorConfig.hpp"
+#include "FprimeExtras/Utilities/DropBitmap/test/ut/DropRangesHelper.hpp"
+#include "Os/FileSystem.hpp"
+#include "STest/Pick/Pick.hpp"
+
+void ActiveDropHarness ::SetUp() {
+    TEST_PACKET_SIZE = STest::Pick::lowerUpper(1, 2 * Utilities::DROP_DETECTOR_FILE_READ_BUFFER_SIZE);
+    // Ensure the scan spans more than three batches
+    this->packets = STest::Pick::lowerUpper(3 * Utilities::DROP_DETECTOR_ACTIVE_PACKETS_PER_BATCH + 1,
+                                            5 * Utilities::DROP_DETECTOR_ACTIVE_PACKETS_PER_BATCH);
+    Os::File file;
+    ASSERT_EQ(file.open(this->TEST_FILE_NAME, Os::File::OPEN_CREATE, Os::FileInterface::OverwriteType::OVERWRITE),
+              Os::File::OP_OK);
+    U8* buffer = new U8[this->TEST_PACKET_SIZE];
+    for (U32 i = 0; i < this->packets; i++) {
+        const bool drop = STest::Pick::lowerUpper(0, 9) == 0;
+        // Fill buffer with non-zero data, or zeros for a drop
+        for (FwSizeType j = 0; j < this->TEST_PACKET_SIZE; j++) {
+            buffer[j] = drop ? 0 : static_cast<U8>(STest::Pick::lowerUpper(1, 255));
+        }
+        if (drop) {
+            this->drop_indices.push_back(i + 1);  // one-based index
+        }
+        FwSizeType bytes_written = this->TEST_PACKET_SIZE;
+        ASSERT_EQ(file.write(buffer, bytes_written), Os::File::OP_OK);
+    }
+    delete[] buffer;
+    file.close();
+}
+
+void ActiveDropHarness ::TearDown() {
+    Os::FileSystem::removeFile(this->TEST_FILE_NAME);
+}
+
+std::vector<std::pair<FwSizeType, FwSizeType>> ActiveDropHarness ::drop_ranges() const {
+    return coalesce_drops(this->drop_indices);
+}
+
+namespace Utilities {
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+ActiveDropDetectorTester ::ActiveDropDetectorTester()
+    : ActiveDropDetectorGTestBase("ActiveDropDetectorTester", ActiveDropDetectorTester::MAX_HISTORY_SIZE),
+      component("ActiveDropDetector") {
+    this->initComponents();
+    this->connectPorts();
+}
+
+ActiveDropDetectorTester ::~ActiveDropDetectorTester() {}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void ActiveDropDetectorTester ::test_drops(ActiveDropHarness& harness) {
+    Fw::String fileStr(harness.TEST_FILE_NAME);
+    this->sendCmd_DETECT_DROPS(0, 0, fileStr, harness.TEST_PACKET_SIZE);
+    // Command plus one message per batch, including the batch that reaches the end of file
+    const FwSizeType dispatched = this->dispatchAll();
+    ASSERT_EQ(dispatched, 2 + (harness.packets / Utilities::DROP_DETECTOR_ACTIVE_PACKETS_PER_BATCH));
+    ASSERT_EVENTS_DetectingDrops_SIZE(1);
+    ASSERT_EVENTS_FileReadError_SIZE(0);
+    // Consecutive drops are reported as one range, up to the event throttle
+    const std::vector<std::pair<FwSizeType, FwSizeType>> ranges = harness.drop_ranges();
+    const FwSizeType reported =
+        FW_MIN(ranges.size(), static_cast<FwSizeType>(ActiveDropDetectorComponentBase::EVENTID_POSSIBLEDROPS_THROTTLE));
+    ASSERT_EVENTS_PossibleDrops_SIZE(reported);
+    for (FwSizeType i = 0; i < reported; i++) {
+        ASSERT_EVENTS_PossibleDrops(i, ranges[i].first, ranges[i].second);
+    }
+    ASSERT_EVENTS_DropSummary_SIZE(1);
+    ASSERT_EVENTS_DropSummary(0, harness.packets, harness.drop_indices.size(), ranges.size());
+    ASSERT_EVENTS_DetectingDropsCompleted_SIZE(1);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, ActiveDropDetector::OPCODE_DETECT_DROPS, 0, Fw::CmdResponse::OK);
+    // Progress is reported after every batch and at completion
+    ASSERT_TLM_PacketsScanned_SIZE(dispatched - 1);
+    ASSERT_TLM_PacketsScanned(dispatched - 2, harness.packets);
+}
+
+void ActiveDropDetectorTester ::test_cancel(ActiveDropHarness& harness) {
+    Fw::String fileStr(harness.TEST_FILE_NAME);
+    this->sendCmd_DETECT_DROPS(0, 0, fileStr, harness.TEST_PACKET_SIZE);
+    // Process the command and the first batch
+    ASSERT_EQ(this->component.doDispatch(), Fw::QueuedComponentBase::MSG_DISPATCH_OK);
+    ASSERT_EQ(this->component.doDispatch(), Fw::QueuedComponentBase::MSG_DISPATCH_OK);
+
+    // A second detection is rejected while the first is running. It is queued behind the second batch.
+    this->sendCmd_DETECT_DROPS(0, 1, fileStr, harness.TEST_PACKET_SIZE);
+    ASSERT_EQ(this->component.doDispatch(), Fw::QueuedComponentBase::MSG_DISPATCH_OK);
+    ASSERT_EQ(this->component.doDispatch(), Fw::QueuedComponentBase::MSG_DISPATCH_OK);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, ActiveDropDetector::OPCODE_DETECT_DROPS, 1, Fw::CmdResponse::BUSY);
+
+    // Cancel is prioritized over the third batch, which then finds no scan in progress
+    this->sendCmd_CANCEL_DETECT_DROPS(0, 2);
+    ASSERT_EQ(this->dispatchAll(), 2);
+    ASSERT_EVENTS_DetectingDropsCanceled_SIZE(1);
+    ASSERT_EVENTS_DetectingDropsCanceled(0, 2 * Utilities::DROP_DETECTOR_ACTIVE_PACKETS_PER_BATCH + 1);
+    ASSERT_EVENTS_DetectingDropsCompleted_SIZE(0);
+    ASSERT_EVENTS_DropSummary_SIZE(1);
+    ASSERT_CMD_RESPONSE_SIZE(3);
+    ASSERT_CMD_RESPONSE(1, ActiveDropDetector::OPCODE_DETECT_DROPS, 0, Fw::CmdResponse::EXECUTION_ERROR);
+    ASSERT_CMD_RESPONSE(2, ActiveDropDetector::OPCODE_CANCEL_DETECT_DROPS, 2, Fw::CmdResponse::OK);
+
+    // Canceling when idle succeeds without effect
+    this->sendCmd_CANCEL_DETECT_DROPS(0, 3);
+    ASSERT_EQ(this->dispatchAll(), 1);
+    ASSERT_EVENTS_DetectingDropsCanceled_SIZE(1);
+    ASSERT_CMD_RESPONSE(3, ActiveDropDetector::OPCODE_CANCEL_DETECT_DROPS, 3, Fw::CmdResponse::OK);
+
+    // A new detection runs to completion after a cancel
+    this->clearHistory();
+    this->sendCmd_DETECT_DROPS(0, 4, fileStr, harness.TEST_PACKET_SIZE);
+    this->dispatchAll();
+    ASSERT_EVENTS_DetectingDropsCompleted_SIZE(1);
+    ASSERT_EVENTS_DropSummary_SIZE(1);
+    ASSERT_EVENTS_DropSummary(0, harness.packets, harness.drop_indices.size(), harness.drop_ranges().size());
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, ActiveDropDetector::OPCODE_DETECT_DROPS, 4, Fw::CmdResponse::OK);
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+FwSizeType ActiveDropDetectorTester ::dispatchAll() {
+    FwSizeType dispatched = 0;
+    while (this->component.m_queue.getMessagesAvailable() > 0) {
+        EXPECT_EQ(this->component.doDispatch(), Fw::QueuedComponentBase::MSG_DISPATCH_OK);
+        dispatched++;
+    }
+    return dispatched;
+}
+
+}  // namespace Utilities
@@ -0,0 +1,96 @@
+// ======================================================================
+// \title  ActiveDropDetectorTester.hpp
+// \author starchmd
+// \brief  hpp file for ActiveDropDetector component test harness implementation class
+// ======================================================================
+
+#ifndef Utilities_ActiveDropDetectorTester_HPP
+#define Utilities_ActiveDropDetectorTester_HPP
+
+#include "FprimeExtras/Utilities/ActiveDropDetector/ActiveDropDetector.hpp"
+#include "FprimeExtras/Utilities/ActiveDropDetector/ActiveDropDetectorGTestBase.hpp"
+#include <utility>
+#include <vector>
+
+class ActiveDropHarness : public testing::Test {
+  public:
+    //! \brief set up test harness, file, etc
+    void SetUp() override;
+
+    //! \brief teardown test harness, file, etc
+    void TearDown() override;
+
+    //! \brief get the expected [first, last] ranges of drops as one-based indices
+    std::vector<std::pair<FwSizeType, FwSizeType>> drop_ranges() const;
+
+    U32 packets = 0;
+    const char* TEST_FILE_NAME = "test_active_file.bin";
+    FwSizeType TEST_PACKET_SIZE;
+    std::vector<U32> drop_indices;
+};
+
+namespace Utilities {
+
+class ActiveDropDetectorTester final : public ActiveDropDetectorGTestBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants
+    // ----------------------------------------------------------------------
+
+    // Maximum size of histories storing events, telemetry, and port outputs
+    static const FwSizeType MAX_HISTORY_SIZE = 3000;
+
+    // Instance ID supplied to the component instance under test
+    static const FwEnumStoreType TEST_INSTANCE_ID = 0;
+
+    // Queue depth supplied to the component instance under test
+    static const FwSizeType TEST_INSTANCE_QUEUE_DEPTH = 10;
+
+  public:
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object ActiveDropDetectorTester
+    ActiveDropDetectorTester();
+
+    //! Destroy object ActiveDropDetectorTester
+    ~ActiveDropDetectorTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    //! Test file with drops
+    void test_drops(ActiveDropHarness& harness);
+
+    //! Test canceling a detection in progress
+    void test_cancel(ActiveDropHarness& harness);
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Dispatch messages until the queue is empty, returning the number dispatched
+    FwSizeType dispatchAll();
+
+    //! Connect ports
+    void connectPorts();
+
+    //! Initialize components
+    void initComponents();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Member variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    ActiveDropDetector component;
+};
+
+}  // namespace Utilities
+
+#endif
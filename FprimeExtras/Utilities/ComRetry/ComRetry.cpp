@@ -15,14 +15,24 @@ namespace Svc {
 ComRetry ::ComRetry(const char* const compName)
     : ComRetryComponentBase(compName),
       m_num_retries(3),
-      m_retry_count(0),
-      m_retry_state(RetryState::WAITING_FOR_SEND),
-      m_bufferState(Fw::Buffer::OwnershipState::OWNED) {}
+      m_window(1),
+      m_head(0),
+      m_count(0),
+      m_sent_count(0),
+      m_returned_head(0),
+      m_returned_count(0),
+      m_status_owed(true) {}
 
 ComRetry ::~ComRetry() {}
 
-void ComRetry::configure(U32 num_retries) {
+void ComRetry::configure(U32 num_retries, FwSizeType window) {
+    FW_ASSERT((window > 0) && (window <= COM_RETRY_MAX_WINDOW), static_cast<FwAssertArgType>(window));
+    Os::ScopeLock lock(this->m_lock);
+    // The ring is indexed modulo the window, so it may only change while empty
+    FW_ASSERT(this->m_count == 0, static_cast<FwAssertArgType>(this->m_count));
     this->m_num_retries = num_retries;
+    this->m_window = window;
+    this->m_head = 0;
 }
 
 // ----------------------------------------------------------------------
@@ -30,64 +40,182 @@ void ComRetry::configure(U32 num_retries) {
 // ----------------------------------------------------------------------
 
 void ComRetry ::comStatusIn_handler(FwIndexType portNum, Fw::Success& condition) {
-    RetryState current = this->m_retry_state.load();
-    FW_ASSERT(this->m_bufferState == Fw::Buffer::OwnershipState::OWNED);
-    // When waiting for send, just pass the status up the stack as the buffer should be above
-    if (current == RetryState::WAITING_FOR_SEND) {
-        FW_ASSERT(!this->m_buffer.isValid());
-        this->comStatusOut_out(0, condition);
+    Actions actions;
+    {
+        Os::ScopeLock lock(this->m_lock);
+        this->handleStatus(condition, actions);
     }
-    // When waiting for status, and "success", this is nominal and everything is passed back up the stack
-    else if ((current == RetryState::WAITING_FOR_STATUS) && (condition == Fw::Success::SUCCESS)) {
-        FW_ASSERT(this->m_buffer.isValid());
-        // Successful transmission, reset state
-        this->m_retry_state = RetryState::WAITING_FOR_SEND;
-        this->dataReturnOut_out(0, this->m_buffer, this->m_context);
-        this->m_buffer = Fw::Buffer(); // Clear buffer
-        this->comStatusOut_out(0, condition);
+    this->performActions(actions);
+}
+
+void ComRetry ::dataIn_handler(FwIndexType portNum, Fw::Buffer& buffer, const ComCfg::FrameContext& context) {
+    Actions actions;
+    {
+        Os::ScopeLock lock(this->m_lock);
+        // Frames are only requested from upstream while the window has room
+        FW_ASSERT(this->m_count < this->m_window, static_cast<FwAssertArgType>(this->m_count));
+        const FwSizeType slot = (this->m_head + this->m_count) % this->m_window;
+        Frame& frame = this->m_frames[slot];
+        FW_ASSERT(frame.m_retry_state == RetryState::WAITING_FOR_SEND);
+        FW_ASSERT(frame.m_bufferState == Fw::Buffer::OwnershipState::OWNED);
+        frame.m_buffer = buffer;
+        frame.m_context = context;
+        frame.m_retry_count = 0;
+        this->m_count += 1;
+        // A full window withholds the status requesting the next frame until a frame is released. Upstream may send its
+        // first frame without awaiting readiness, which is then no longer owed.
+        const bool full = (this->m_count == this->m_window);
+        this->m_status_owed = full;
+        this->sendFrame(slot, actions);
+        if (!full) {
+            actions.m_status = true;
+            actions.m_condition = Fw::Success::SUCCESS;
+        }
     }
-    // When retrying, and "success", this is the send retry case
-    else if ((current == RetryState::RETRYING) && (condition == Fw::Success::SUCCESS)) {
-        FW_ASSERT(this->m_buffer.isValid());
-        // Successful transmission, reset state
-        this->m_retry_state = RetryState::WAITING_FOR_STATUS;
-        this->m_retry_count += 1;
-        this->m_bufferState = Fw::Buffer::OwnershipState::NOT_OWNED;
-        this->dataOut_out(0, this->m_buffer, this->m_context);
-    } else {
-        // When a failure has been seen, it can **only** be in WAITING_FOR_STATUS state
-        FW_ASSERT(current == RetryState::WAITING_FOR_STATUS);
-        FW_ASSERT(condition == Fw::Success::FAILURE);
-        
-        // If we have retries left store switch to RETRYING and wait for success
-        if (this->m_retry_count < this->m_num_retries) {
-            this->m_retry_state = RetryState::RETRYING;
+    this->performActions(actions);
+}
+
+void ComRetry ::dataReturnIn_handler(FwIndexType portNum, Fw::Buffer& buffer, const ComCfg::FrameContext& context) {
+    Os::ScopeLock lock(this->m_lock);
+    // Frames in flight are matched by buffer data, as they may be returned in any order
+    for (FwSizeType i = 0; i < this->m_count; i++) {
+        const FwSizeType slot = (this->m_head + i) % this->m_window;
+        Frame& frame = this->m_frames[slot];
+        if ((frame.m_bufferState == Fw::Buffer::OwnershipState::NOT_OWNED) &&
+            (frame.m_buffer.getData() == buffer.getData())) {
+            FW_ASSERT(RetryState::WAITING_FOR_STATUS == frame.m_retry_state);
+            FW_ASSERT(this->m_returned_count < this->m_sent_count,
+                      static_cast<FwAssertArgType>(this->m_returned_count));
+            frame.m_bufferState = Fw::Buffer::OwnershipState::OWNED;
+            frame.m_buffer = buffer;
+            frame.m_context = context;
+            this->m_returned[(this->m_returned_head + this->m_returned_count) % COM_RETRY_MAX_WINDOW] = slot;
+            this->m_returned_count += 1;
+            return;
         }
-        // If no retries left, pass failure back up the stack and reset state
+    }
+    FW_ASSERT(0);  // Returned buffer was never sent, or was already returned
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+void ComRetry ::handleStatus(Fw::Success& condition, Actions& actions) {
+    FwSizeType retry_slot = 0;
+    // Downstream returns each buffer before reporting its status, so when no returned frame is waiting for status the
+    // status reports whether downstream is ready, even while other frames are in flight
+    if (this->m_returned_count == 0) {
+        // When retrying, and "success", this is the send retry case
+        if ((condition == Fw::Success::SUCCESS) && this->findRetrying(retry_slot)) {
+            this->m_frames[retry_slot].m_retry_count += 1;
+            this->sendFrame(retry_slot, actions);
+        }
+        // Otherwise readiness is passed up the stack only while upstream awaits a status, as it does before its first
+        // frame and after a failure. Frames in flight already hold the frames requested from upstream to the window.
         else {
-            this->dataReturnOut_out(0, this->m_buffer, this->m_context);
-            this->m_buffer = Fw::Buffer(); // Clear buffer
-            this->m_retry_state = RetryState::WAITING_FOR_SEND;
-            this->comStatusOut_out(0, condition);
+            (void)this->releaseStatus(condition, actions);
+        }
+        return;
+    }
+    // Statuses arrive in the order buffers were returned
+    const FwSizeType slot = this->m_returned[this->m_returned_head];
+    this->m_returned_head = (this->m_returned_head + 1) % COM_RETRY_MAX_WINDOW;
+    this->m_returned_count -= 1;
+    this->m_sent_count -= 1;
+    Frame& frame = this->m_frames[slot];
+    FW_ASSERT(frame.m_retry_state == RetryState::WAITING_FOR_STATUS);
+    FW_ASSERT(frame.m_bufferState == Fw::Buffer::OwnershipState::OWNED);
+
+    // When waiting for status, and "success", this is nominal and everything is passed back up the stack
+    if (condition == Fw::Success::SUCCESS) {
+        this->completeFrame(slot, actions);
+        // Delivery shows downstream is ready, so the oldest failed frame is resent ahead of any new frame
+        if (this->findRetrying(retry_slot)) {
+            this->m_frames[retry_slot].m_retry_count += 1;
+            this->sendFrame(retry_slot, actions);
+        }
+        (void)this->releaseStatus(condition, actions);
+    }
+    // If we have retries left store switch to RETRYING and wait for success
+    else if (frame.m_retry_count < this->m_num_retries) {
+        frame.m_retry_state = RetryState::RETRYING;
+    }
+    // If no retries left, release the frame and pass failure back up the stack as the withheld status. When upstream
+    // is owed no status, as the window already requested the next frame, the drop is reported by event instead.
+    else {
+        const U32 retries = frame.m_retry_count;
+        this->completeFrame(slot, actions);
+        if (!this->releaseStatus(condition, actions)) {
+            actions.m_dropped = true;
+            actions.m_retries = retries;
         }
     }
 }
 
-void ComRetry ::dataIn_handler(FwIndexType portNum, Fw::Buffer& buffer, const ComCfg::FrameContext& context) {
-    FW_ASSERT(RetryState::WAITING_FOR_SEND == this->m_retry_state);
-    FW_ASSERT(this->m_bufferState == Fw::Buffer::OwnershipState::OWNED);
-    this->m_retry_state = RetryState::WAITING_FOR_STATUS;
-    this->m_bufferState = Fw::Buffer::OwnershipState::NOT_OWNED;
-    this->m_retry_count = 0;
-    this->dataOut_out(0, buffer, context);
+void ComRetry ::sendFrame(FwSizeType slot, Actions& actions) {
+    Frame& frame = this->m_frames[slot];
+    FW_ASSERT(!actions.m_send);
+    FW_ASSERT(this->m_sent_count < this->m_window, static_cast<FwAssertArgType>(this->m_sent_count));
+    this->m_sent_count += 1;
+    frame.m_retry_state = RetryState::WAITING_FOR_STATUS;
+    frame.m_bufferState = Fw::Buffer::OwnershipState::NOT_OWNED;
+    // Downstream may return and report on the frame before dataOut returns, so the frame is passed as a copy
+    actions.m_send = true;
+    actions.m_sendBuffer = frame.m_buffer;
+    actions.m_sendContext = frame.m_context;
 }
 
-void ComRetry ::dataReturnIn_handler(FwIndexType portNum, Fw::Buffer& buffer, const ComCfg::FrameContext& context) {
-    FW_ASSERT(this->m_bufferState == Fw::Buffer::OwnershipState::NOT_OWNED);
-    FW_ASSERT(RetryState::WAITING_FOR_STATUS == this->m_retry_state);
-    this->m_bufferState = Fw::Buffer::OwnershipState::OWNED;
-    this->m_buffer = buffer;
-    this->m_context = context;
+void ComRetry ::completeFrame(FwSizeType slot, Actions& actions) {
+    Frame& frame = this->m_frames[slot];
+    FW_ASSERT(!actions.m_return);
+    actions.m_return = true;
+    actions.m_returnBuffer = frame.m_buffer;
+    actions.m_returnContext = frame.m_context;
+    frame.m_buffer = Fw::Buffer();  // Clear buffer
+    frame.m_retry_state = RetryState::WAITING_FOR_SEND;
+    // Frames may complete out of order, the window only advances past the oldest once it completes
+    while ((this->m_count > 0) && (this->m_frames[this->m_head].m_retry_state == RetryState::WAITING_FOR_SEND)) {
+        this->m_head = (this->m_head + 1) % this->m_window;
+        this->m_count -= 1;
+    }
+}
+
+bool ComRetry ::releaseStatus(Fw::Success& condition, Actions& actions) {
+    if (this->m_status_owed && (this->m_count < this->m_window)) {
+        // Upstream waits for a SUCCESS status after a FAILURE before sending, so the status remains owed until then
+        this->m_status_owed = (condition != Fw::Success::SUCCESS);
+        actions.m_status = true;
+        actions.m_condition = condition;
+        return true;
+    }
+    return false;
+}
+
+bool ComRetry ::findRetrying(FwSizeType& slot) const {
+    for (FwSizeType i = 0; i < this->m_count; i++) {
+        const FwSizeType candidate = (this->m_head + i) % this->m_window;
+        if (this->m_frames[candidate].m_retry_state == RetryState::RETRYING) {
+            slot = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ComRetry ::performActions(Actions& actions) {
+    if (actions.m_return) {
+        this->dataReturnOut_out(0, actions.m_returnBuffer, actions.m_returnContext);
+    }
+    if (actions.m_send) {
+        this->dataOut_out(0, actions.m_sendBuffer, actions.m_sendContext);
+    }
+    if (actions.m_status) {
+        this->comStatusOut_out(0, actions.m_condition);
+    }
+    if (actions.m_dropped) {
+        this->log_WARNING_HI_FrameDropped(actions.m_retries);
+    }
 }
 
 }  // namespace Svc
@@ -7,8 +7,9 @@
 #ifndef Svc_ComRetry_HPP
 #define Svc_ComRetry_HPP
 
+#include "ExtrasConfig/FppConstantsAc.hpp"
 #include "FprimeExtras/Utilities/ComRetry/ComRetryComponentAc.hpp"
-#include <atomic>
+#include "Os/Mutex.hpp"
 
 namespace Svc {
 
@@ -30,8 +31,13 @@ class ComRetry final : public ComRetryComponentBase {
     //! Destroy ComRetry object
     ~ComRetry();
 
-    //! Configure the number of retries
-    void configure(U32 num_retries  //!< Number of retries allowed
+    //! Configure the number of retries and the window of frames held in flight
+    //!
+    //! A window of 1 holds each frame until it is delivered or out of retries before the next is requested. Larger
+    //! windows request the next frame while up to window frames await delivery. Must be configured before any frame is
+    //! received.
+    void configure(U32 num_retries,        //!< Number of retries allowed
+                   FwSizeType window = 1  //!< Frames held in flight, at most COM_RETRY_MAX_WINDOW
     );
 
   private:
@@ -60,16 +66,96 @@ class ComRetry final : public ComRetryComponentBase {
                               Fw::Buffer& data,
                               const ComCfg::FrameContext& context) override;
 
+  private:
+    //! Port calls decided while holding m_lock, made once it is released such that downstream, which may call back
+    //! into the component before dataOut returns, and other threads never see the window mid-update
+    struct Actions {
+        Actions()
+            : m_return(false),
+              m_send(false),
+              m_status(false),
+              m_condition(Fw::Success::SUCCESS),
+              m_dropped(false),
+              m_retries(0) {}
+
+        bool m_return;                         //!< Return m_returnBuffer upstream
+        Fw::Buffer m_returnBuffer;             //!< Buffer of the completed frame
+        ComCfg::FrameContext m_returnContext;  //!< Context of the completed frame
+        bool m_send;                           //!< Send m_sendBuffer downstream
+        Fw::Buffer m_sendBuffer;               //!< Buffer of the frame to send
+        ComCfg::FrameContext m_sendContext;    //!< Context of the frame to send
+        bool m_status;                         //!< Send m_condition upstream
+        Fw::Success m_condition;               //!< Status to send upstream
+        bool m_dropped;                        //!< Report a frame dropped without a status upstream
+        U32 m_retries;                         //!< Retries of the dropped frame
+    };
+
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Handle a status from downstream, deciding the resulting port calls
+    void handleStatus(Fw::Success& condition,  //!< Condition success/failure
+                      Actions& actions          //!< Port calls to make
+    );
+
+    //! Queue the frame in slot to be sent downstream, counting it in flight until its status
+    void sendFrame(FwSizeType slot,  //!< Slot of the frame to send
+                   Actions& actions  //!< Port calls to make
+    );
+
+    //! Release the frame in slot, queueing its buffer to be returned upstream
+    void completeFrame(FwSizeType slot,  //!< Slot of the frame to complete
+                       Actions& actions  //!< Port calls to make
+    );
+
+    //! Queue the status upstream awaits, withheld while the window was full, once the window has room
+    //!
+    //! \return true when the status is queued
+    bool releaseStatus(Fw::Success& condition,  //!< Condition of the frame completed
+                       Actions& actions          //!< Port calls to make
+    );
+
+    //! Find the oldest frame waiting to be resent
+    //!
+    //! \return true when a frame is waiting, with slot set to its slot
+    bool findRetrying(FwSizeType& slot  //!< Set to the slot of the frame found
+    ) const;
+
+    //! Make the port calls decided by a handler, without holding m_lock
+    void performActions(Actions& actions  //!< Port calls to make
+    );
+
   private:
     // ----------------------------------------------------------------------
     // Member variables
     // ----------------------------------------------------------------------
-    U32 m_num_retries;                                  //!< Maximum number of retries
-    U32 m_retry_count;                                  //!< Track number of attempted retries
-    std::atomic<RetryState> m_retry_state;              //!< Current retry state
-    ComCfg::FrameContext m_context;                     //!< Context for the current frame
-    Fw::Buffer m_buffer;                                //!< Store incoming buffer
-    Fw::Buffer::OwnershipState m_bufferState;           //!< Track ownership of stored buffer
+
+    //! Frame retained until delivered or out of retries
+    struct Frame {
+        Frame()
+            : m_retry_count(0),
+              m_retry_state(RetryState::WAITING_FOR_SEND),
+              m_bufferState(Fw::Buffer::OwnershipState::OWNED) {}
+
+        Fw::Buffer m_buffer;                       //!< Store incoming buffer
+        ComCfg::FrameContext m_context;            //!< Context for the frame
+        U32 m_retry_count;                         //!< Track number of attempted retries
+        RetryState m_retry_state;                  //!< Current retry state, WAITING_FOR_SEND when the slot is free
+        Fw::Buffer::OwnershipState m_bufferState;  //!< Track ownership of stored buffer
+    };
+
+    Os::Mutex m_lock;                             //!< Guards the window, as ports may be called from several threads
+    U32 m_num_retries;                            //!< Maximum number of retries
+    FwSizeType m_window;                          //!< Number of frames held in flight
+    Frame m_frames[COM_RETRY_MAX_WINDOW];         //!< Ring of retained frames in the order received
+    FwSizeType m_head;                            //!< Slot of the oldest retained frame
+    FwSizeType m_count;                           //!< Slots from m_head to the newest retained frame
+    FwSizeType m_sent_count;                      //!< Number of frames sent and awaiting a status
+    FwSizeType m_returned[COM_RETRY_MAX_WINDOW];  //!< Ring of slots returned and awaiting a status, in return order
+    FwSizeType m_returned_head;                   //!< Index in m_returned of the frame the next status is for
+    FwSizeType m_returned_count;                  //!< Number of frames returned and awaiting a status
+    bool m_status_owed;                           //!< Upstream awaits a SUCCESS, withheld while the window is full
 };
 
 }  // namespace Svc
@@ -21,6 +21,21 @@ TEST(Nominal, RetryTillFailure) {
     tester.testBufferRetryTillFailure();
 }
 
+TEST(Window, Send) {
+    Svc::ComRetryTester tester;
+    tester.testWindowSend();
+}
+
+TEST(Window, Retry) {
+    Svc::ComRetryTester tester;
+    tester.testWindowRetry();
+}
+
+TEST(Window, Ready) {
+    Svc::ComRetryTester tester;
+    tester.testWindowReady();
+}
+
 int main(int argc, char** argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
@@ -20,8 +20,8 @@ ComRetryTester ::ComRetryTester()
 
 ComRetryTester ::~ComRetryTester() {}
 
-void ComRetryTester ::configure(U32 num_retries=1) {
-    component.configure(num_retries);
+void ComRetryTester ::configure(U32 num_retries, FwSizeType window) {
+    component.configure(num_retries, window);
 }
 
 void ComRetryTester ::receiveBuffer(Fw::Buffer &buffer, ComCfg::FrameContext &context) {
@@ -29,6 +29,11 @@ void ComRetryTester ::receiveBuffer(Fw::Buffer &buffer, ComCfg::FrameContext &co
     invoke_to_dataReturnIn(0, buffer, context);
 }
 
+void ComRetryTester ::returnBuffer(Fw::Buffer &buffer, ComCfg::FrameContext &context, Fw::Success status) {
+    invoke_to_dataReturnIn(0, buffer, context);
+    invoke_to_comStatusIn(0, status);
+}
+
 void ComRetryTester ::checkDataOut(FwIndexType expectedIndex, U8* expectedData, FwSizeType expectedDataSize) {
     Fw::Buffer emittedBuffer = this->fromPortHistory_dataOut->at(expectedIndex).data;
     ASSERT_EQ(expectedDataSize, emittedBuffer.getSize());
@@ -75,10 +80,14 @@ void ComRetryTester ::testBufferRetry() {
 
     receiveBuffer(buffer_a, nullContext);
     invoke_to_comStatusIn(0, state);
-    invoke_to_dataReturnIn(0, buffer_a, nullContext);
+    ASSERT_from_dataReturnOut_SIZE(0);
+    ASSERT_from_comStatusOut_SIZE(0);
 
+    // The retry is sent once downstream reports it is ready
     state = Fw::Success::SUCCESS;
     invoke_to_comStatusIn(0, state);
+    ASSERT_from_dataOut_SIZE(2);
+    returnBuffer(buffer_a, nullContext, state);
     ASSERT_from_dataReturnOut(0, buffer_a, nullContext);
     ASSERT_from_comStatusOut(0, state);
 
@@ -99,6 +108,7 @@ void ComRetryTester ::testBufferRetryTillFailure() {
     Fw::Buffer buffer_b(&data_b[0], sizeof(data_b));
     ComCfg::FrameContext nullContext;
     Fw::Success state = Fw::Success::FAILURE;
+    Fw::Success ready = Fw::Success::SUCCESS;
 
     FwIndexType num_retries = 3;
     configure(num_retries);
@@ -108,9 +118,10 @@ void ComRetryTester ::testBufferRetryTillFailure() {
     checkDataOut(0, buffer_a.getData(), buffer_a.getSize());
 
     for (FwIndexType i = 1; i <= num_retries; i++) {
-        invoke_to_dataReturnIn(0, buffer_a, nullContext);
-        invoke_to_comStatusIn(0, state);
+        ASSERT_from_dataReturnOut_SIZE(0);
+        invoke_to_comStatusIn(0, ready);
         checkDataOut(i, buffer_a.getData(), buffer_a.getSize());
+        returnBuffer(buffer_a, nullContext, state);
     }
 
     ASSERT_from_dataReturnOut(0, buffer_a, nullContext);
@@ -124,4 +135,138 @@ void ComRetryTester ::testBufferRetryTillFailure() {
     checkDataOut(num_retries + 1, buffer_b.getData(), buffer_b.getSize());
 }
 
+void ComRetryTester ::testWindowSend() {
+    U8 data_a[BUFFER_LENGTH] = DATA_A;
+    U8 data_b[BUFFER_LENGTH] = DATA_B;
+    U8 data_c[BUFFER_LENGTH] = DATA_C;
+    Fw::Buffer buffer_a(&data_a[0], sizeof(data_a));
+    Fw::Buffer buffer_b(&data_b[0], sizeof(data_b));
+    Fw::Buffer buffer_c(&data_c[0], sizeof(data_c));
+    ComCfg::FrameContext nullContext;
+    Fw::Success state = Fw::Success::SUCCESS;
+    configure(1, 2);
+
+    // The next frame is requested at once while the window has room, and withheld once full
+    invoke_to_dataIn(0, buffer_a, nullContext);
+    ASSERT_from_comStatusOut(0, state);
+    invoke_to_dataIn(0, buffer_b, nullContext);
+    ASSERT_from_dataOut_SIZE(2);
+    ASSERT_from_comStatusOut_SIZE(1);
+
+    // Buffers are returned upstream as they complete, the window opening as the oldest completes
+    returnBuffer(buffer_a, nullContext, state);
+    ASSERT_from_dataReturnOut(0, buffer_a, nullContext);
+    ASSERT_from_comStatusOut(1, state);
+    invoke_to_dataIn(0, buffer_c, nullContext);
+    ASSERT_from_comStatusOut_SIZE(2);
+    returnBuffer(buffer_b, nullContext, state);
+    ASSERT_from_dataReturnOut(1, buffer_b, nullContext);
+    ASSERT_from_comStatusOut(2, state);
+    returnBuffer(buffer_c, nullContext, state);
+    ASSERT_from_dataReturnOut(2, buffer_c, nullContext);
+    ASSERT_from_comStatusOut_SIZE(3);
+
+    checkDataOut(0, buffer_a.getData(), buffer_a.getSize());
+    checkDataOut(1, buffer_b.getData(), buffer_b.getSize());
+    checkDataOut(2, buffer_c.getData(), buffer_c.getSize());
+}
+
+void ComRetryTester ::testWindowRetry() {
+    U8 data_a[BUFFER_LENGTH] = DATA_A;
+    U8 data_b[BUFFER_LENGTH] = DATA_B;
+    U8 data_c[BUFFER_LENGTH] = DATA_C;
+    Fw::Buffer buffer_a(&data_a[0], sizeof(data_a));
+    Fw::Buffer buffer_b(&data_b[0], sizeof(data_b));
+    Fw::Buffer buffer_c(&data_c[0], sizeof(data_c));
+    ComCfg::FrameContext nullContext;
+    Fw::Success failure = Fw::Success::FAILURE;
+    Fw::Success success = Fw::Success::SUCCESS;
+    configure(1, 3);
+
+    invoke_to_dataIn(0, buffer_a, nullContext);
+    invoke_to_dataIn(0, buffer_b, nullContext);
+    invoke_to_dataIn(0, buffer_c, nullContext);
+    ASSERT_from_comStatusOut_SIZE(2);
+
+    // Failed frames are retained while later frames complete, then resent in the order received
+    returnBuffer(buffer_a, nullContext, failure);
+    returnBuffer(buffer_b, nullContext, failure);
+    returnBuffer(buffer_c, nullContext, success);
+    ASSERT_from_dataReturnOut(0, buffer_c, nullContext);
+    ASSERT_from_comStatusOut_SIZE(2);
+    checkDataOut(3, buffer_a.getData(), buffer_a.getSize());
+    returnBuffer(buffer_a, nullContext, success);
+    ASSERT_from_dataReturnOut(1, buffer_a, nullContext);
+    checkDataOut(4, buffer_b.getData(), buffer_b.getSize());
+    ASSERT_from_comStatusOut(2, success);
+
+    // Once out of retries the frame is returned, and as its status was already sent when the window opened the drop is
+    // reported by event
+    returnBuffer(buffer_b, nullContext, failure);
+    ASSERT_from_dataReturnOut(2, buffer_b, nullContext);
+    ASSERT_from_comStatusOut_SIZE(3);
+    ASSERT_EVENTS_FrameDropped_SIZE(1);
+    ASSERT_EVENTS_FrameDropped(0, 1);
+    ASSERT_from_dataOut_SIZE(5);
+}
+
+void ComRetryTester ::testWindowReady() {
+    U8 data_a[BUFFER_LENGTH] = DATA_A;
+    U8 data_b[BUFFER_LENGTH] = DATA_B;
+    Fw::Buffer buffer_a(&data_a[0], sizeof(data_a));
+    Fw::Buffer buffer_b(&data_b[0], sizeof(data_b));
+    ComCfg::FrameContext nullContext;
+    Fw::Success failure = Fw::Success::FAILURE;
+    Fw::Success success = Fw::Success::SUCCESS;
+    configure(1, 2);
+
+    invoke_to_dataIn(0, buffer_a, nullContext);
+    invoke_to_dataIn(0, buffer_b, nullContext);
+    ASSERT_from_comStatusOut_SIZE(1);
+
+    // Downstream reporting it is ready while frames are in flight completes no frame and requests none from upstream
+    invoke_to_comStatusIn(0, success);
+    ASSERT_from_dataReturnOut_SIZE(0);
+    ASSERT_from_comStatusOut_SIZE(1);
+    ASSERT_from_dataOut_SIZE(2);
+
+    // A failed frame is resent when downstream is ready, though another frame is still in flight
+    returnBuffer(buffer_a, nullContext, failure);
+    invoke_to_comStatusIn(0, success);
+    ASSERT_from_dataOut_SIZE(3);
+    checkDataOut(2, buffer_a.getData(), buffer_a.getSize());
+
+    // Statuses follow the returned buffers, not the order frames were sent
+    returnBuffer(buffer_b, nullContext, success);
+    ASSERT_from_dataReturnOut(0, buffer_b, nullContext);
+    ASSERT_from_comStatusOut_SIZE(1);
+
+    // The frame out of retries is returned, opening the window, and its failure is the withheld status
+    returnBuffer(buffer_a, nullContext, failure);
+    ASSERT_from_dataReturnOut(1, buffer_a, nullContext);
+    ASSERT_from_comStatusOut(1, failure);
+    ASSERT_from_comStatusOut_SIZE(2);
+    ASSERT_EVENTS_FrameDropped_SIZE(0);
+
+    // Upstream awaits readiness after the failure, which is passed upstream once
+    invoke_to_comStatusIn(0, success);
+    ASSERT_from_comStatusOut(2, success);
+    ASSERT_from_dataOut_SIZE(3);
+    invoke_to_comStatusIn(0, success);
+    ASSERT_from_comStatusOut_SIZE(3);
+
+    // Readiness awaited after a failure is passed upstream even while another frame is in flight
+    invoke_to_dataIn(0, buffer_a, nullContext);
+    invoke_to_dataIn(0, buffer_b, nullContext);
+    ASSERT_from_comStatusOut_SIZE(4);
+    returnBuffer(buffer_a, nullContext, failure);
+    invoke_to_comStatusIn(0, success);
+    ASSERT_from_dataOut_SIZE(6);
+    returnBuffer(buffer_a, nullContext, failure);
+    ASSERT_from_comStatusOut(4, failure);
+    invoke_to_comStatusIn(0, success);
+    ASSERT_from_comStatusOut(5, success);
+    ASSERT_from_comStatusOut_SIZE(6);
+}
+
 }  // namespace Svc
@@ -8,11 +8,12 @@
 #define Svc_ComRetryTester_HPP
 
 #include "ComRetryGTestBase.hpp"
-#include "Svc/ComRetry/ComRetry.hpp"
+#include "FprimeExtras/Utilities/ComRetry/ComRetry.hpp"
 
 #define BUFFER_LENGTH 3u
 #define DATA_A {0xad, 0xbe, 0xde}
 #define DATA_B {0xde, 0xef, 0xf0}
+#define DATA_C {0xca, 0xfe, 0x42}
 
 namespace Svc {
 
@@ -43,10 +44,12 @@ class ComRetryTester final : public ComRetryGTestBase {
     // ----------------------------------------------------------------------
     // Helpers
     // ----------------------------------------------------------------------
-    void configure(U32 num_retries);
+    void configure(U32 num_retries = 1, FwSizeType window = 1);
 
     void receiveBuffer(Fw::Buffer &buffer, ComCfg::FrameContext &context);
 
+    void returnBuffer(Fw::Buffer &buffer, ComCfg::FrameContext &context, Fw::Success status);
+
     void checkDataOut(FwIndexType expectedIndex, U8* expectedData, FwSizeType expectedDataSize);
 
     // ----------------------------------------------------------------------
@@ -59,6 +62,12 @@ class ComRetryTester final : public ComRetryGTestBase {
 
     void testBufferRetryTillFailure();
 
+    void testWindowSend();
+
+    void testWindowRetry();
+
+    void testWindowReady();
+
   private:
     // ----------------------------------------------------------------------
     // Helper functions
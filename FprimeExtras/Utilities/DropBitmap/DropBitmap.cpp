@@ -0,0 +1,137 @@
+// ======================================================================
+// \title  DropBitmap.cpp
+// \author starchmd
+// \brief  cpp file for DropBitmapWriter missing packet bitmap file writer
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#include "FprimeExtras/Utilities/DropBitmap/DropBitmap.hpp"
+
+#include <cstring>
+
+#include "FprimeExtras/Utilities/FileHelper/FileHelper.hpp"
+#include "Fw/Types/Assert.hpp"
+
+namespace Utilities {
+
+constexpr U32 DropBitmapWriter::DROP_BITMAP_MAGIC;
+constexpr FwSizeType DropBitmapWriter::HEADER_SIZE;
+
+//! Bits held by the staging buffer
+constexpr FwSizeType BUFFER_BITS = Utilities::DROP_DETECTOR_BITMAP_BUFFER_SIZE * 8;
+
+DropBitmapWriter ::DropBitmapWriter() : m_packetSize(0), m_count(0), m_written(0), m_ended(false) {
+    (void)::memset(this->m_buffer, 0, sizeof(this->m_buffer));
+}
+
+DropBitmapWriter ::~DropBitmapWriter() {
+    (void)this->close();
+}
+
+Os::File::Status DropBitmapWriter ::open(const CHAR* path, FwSizeType packetSize) {
+    FW_ASSERT(path != nullptr);
+    FW_ASSERT(!this->isOpen());
+    Os::File::Status status = this->m_file.open(path, Os::File::OPEN_CREATE, Os::File::OverwriteType::OVERWRITE);
+    if (status == Os::File::OP_OK) {
+        this->m_packetSize = packetSize;
+        this->m_count = 0;
+        this->m_written = 0;
+        this->m_ended = false;
+        (void)::memset(this->m_buffer, 0, sizeof(this->m_buffer));
+        // The packet count is unknown until close, a zero count marks the file as incomplete until then
+        status = this->writeHeader();
+        if (status != Os::File::OP_OK) {
+            this->m_file.close();
+        }
+    }
+    return status;
+}
+
+Os::File::Status DropBitmapWriter ::record(bool drop) {
+    FW_ASSERT(this->isOpen());
+    // A full buffer left by a failed write is written again before the next bit is staged
+    if ((this->m_count - this->m_written) == BUFFER_BITS) {
+        const Os::File::Status status = this->flush();
+        if (status != Os::File::OP_OK) {
+            return status;
+        }
+    }
+    const FwSizeType bit = this->m_count - this->m_written;
+    if (drop) {
+        this->m_buffer[bit / 8] = static_cast<U8>(this->m_buffer[bit / 8] | (0x80 >> (bit % 8)));
+    }
+    this->m_count += 1;
+    Os::File::Status status = Os::File::OP_OK;
+    if ((bit + 1) == BUFFER_BITS) {
+        status = this->flush();
+    }
+    return status;
+}
+
+Os::File::Status DropBitmapWriter ::recordOrEnd(bool drop) {
+    FW_ASSERT(this->isOpen());
+    if (this->m_ended) {
+        return Os::File::OP_OK;
+    }
+    const FwSizeType count = this->m_count;
+    const Os::File::Status status = this->record(drop);
+    this->m_ended = (this->m_count == count);
+    return status;
+}
+
+Os::File::Status DropBitmapWriter ::close() {
+    Os::File::Status status = Os::File::OP_OK;
+    if (this->isOpen()) {
+        status = this->flush();
+        if (status == Os::File::OP_OK) {
+            status = this->m_file.seek(0, Os::File::SeekType::ABSOLUTE);
+        }
+        if (status == Os::File::OP_OK) {
+            status = this->writeHeader();
+        }
+        this->m_file.close();
+    }
+    return status;
+}
+
+bool DropBitmapWriter ::isOpen() const {
+    return this->m_file.isOpen();
+}
+
+FwSizeType DropBitmapWriter ::getPacketCount() const {
+    return this->m_count;
+}
+
+Os::File::Status DropBitmapWriter ::writeHeader() {
+    Os::File::Status status = FileHelper::writeToFile(this->m_file, DropBitmapWriter::DROP_BITMAP_MAGIC);
+    if (status == Os::File::OP_OK) {
+        status = FileHelper::writeToFile(this->m_file, static_cast<U64>(this->m_packetSize));
+    }
+    if (status == Os::File::OP_OK) {
+        status = FileHelper::writeToFile(this->m_file, static_cast<U64>(this->m_count));
+    }
+    return status;
+}
+
+Os::File::Status DropBitmapWriter ::flush() {
+    const FwSizeType size = ((this->m_count - this->m_written) + 7) / 8;
+    Os::File::Status status = Os::File::OP_OK;
+    if (size > 0) {
+        // Written bits always end on a byte boundary. Seeking to them first discards any part of a failed write.
+        status = this->m_file.seek(static_cast<FwSignedSizeType>(DropBitmapWriter::HEADER_SIZE + (this->m_written / 8)),
+                                   Os::File::SeekType::ABSOLUTE);
+        FwSizeType written = size;
+        if (status == Os::File::OP_OK) {
+            status = this->m_file.write(this->m_buffer, written);
+        }
+        if ((status == Os::File::OP_OK) && (written != size)) {
+            status = Os::File::BAD_SIZE;
+        }
+        if (status == Os::File::OP_OK) {
+            this->m_written = this->m_count;
+            (void)::memset(this->m_buffer, 0, sizeof(this->m_buffer));
+        }
+    }
+    return status;
+}
+
+}  // namespace Utilities
@@ -0,0 +1,107 @@
+// ======================================================================
+// \title  DropBitmap.hpp
+// \author starchmd
+// \brief  hpp file for DropBitmapWriter missing packet bitmap file writer
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#ifndef FprimeExtras_Utilities_DropBitmap_HPP
+#define FprimeExtras_Utilities_DropBitmap_HPP
+
+#include "ExtrasConfig/DropDetectorConfig.hpp"
+#include "Fw/FPrimeBasicTypes.hpp"
+#include "Os/File.hpp"
+
+namespace Utilities {
+
+//! \brief writes a one-bit-per-packet bitmap of possibly dropped packets to a file
+//!
+//! The file consists of a header followed by the bitmap. All header fields are big-endian:
+//!
+//! | Field        | Type | Description                                        |
+//! |--------------|------|----------------------------------------------------|
+//! | magic        | U32  | DROP_BITMAP_MAGIC                                  |
+//! | packet size  | U64  | Size of each packet in the scanned file            |
+//! | packet count | U64  | Number of packets scanned, and of bits that follow |
+//!
+//! Bit n of the bitmap is set when packet n of the scanned file is a possible drop. Packet n is reported with the
+//! one-based index n + 1 in events. Bits are packed most significant bit first, and the final byte is padded with zero
+//! bits. The packet count is written when the file is closed and is zero in files that were not closed.
+class DropBitmapWriter {
+  public:
+    //! Magic number identifying a drop bitmap file: "DRPB"
+    static constexpr U32 DROP_BITMAP_MAGIC = 0x44525042;
+
+    //! Size of the file header
+    static constexpr FwSizeType HEADER_SIZE = sizeof(U32) + sizeof(U64) + sizeof(U64);
+
+    //! Construct a closed writer
+    DropBitmapWriter();
+
+    //! Destroy the writer, closing any open file
+    ~DropBitmapWriter();
+
+    //! \brief create the bitmap file at path, overwriting any existing file
+    //!
+    //! \warning It is invalid to open a writer that is already open or to supply a null path and results in an
+    //!          assertion failure.
+    //!
+    //! \param path path of the bitmap file
+    //! \param packetSize size of each packet in the scanned file
+    //! \return status of creating the file and writing the header
+    Os::File::Status open(const CHAR* path, FwSizeType packetSize);
+
+    //! \brief append the bit for the next packet
+    //!
+    //! Bits are kept in the staging buffer until they are written successfully. A failed write of a full buffer is
+    //! retried by the next call before its bit is staged. When the retry fails too, the error is returned and the
+    //! packet is not recorded.
+    //!
+    //! \warning It is invalid to call this function on a writer that is not open and results in an assertion failure.
+    //!
+    //! \param drop true when the packet is a possible drop
+    //! \return status of writing the staging buffer, when it was full
+    Os::File::Status record(bool drop);
+
+    //! \brief append the bit for the next packet, ending the bitmap rather than leaving a gap in it
+    //!
+    //! As record, except that a packet that cannot be recorded ends the bitmap. Neither it nor any later packet is
+    //! recorded, such that every bit written stays aligned with its packet and the packet count covers only the packets
+    //! before the gap. Until then a failed write of a full buffer is retried by each call, and by close.
+    //!
+    //! \warning It is invalid to call this function on a writer that is not open and results in an assertion failure.
+    //!
+    //! \param drop true when the packet is a possible drop
+    //! \return status of writing the staging buffer, OP_OK once the bitmap has ended
+    Os::File::Status recordOrEnd(bool drop);
+
+    //! \brief write any buffered bits and the final header, then close the file
+    //!
+    //! Closing a writer that is not open has no effect and returns OP_OK. The file is closed even when writing fails.
+    //!
+    //! \return status of the final writes
+    Os::File::Status close();
+
+    //! \brief check if a bitmap file is open
+    bool isOpen() const;
+
+    //! \brief get the number of packets recorded since the file was opened
+    FwSizeType getPacketCount() const;
+
+  private:
+    //! \brief write the header with the current packet count at the current file position
+    Os::File::Status writeHeader();
+
+    //! \brief write the staged bits at their position in the file, clearing the staging buffer once written
+    Os::File::Status flush();
+
+    Os::File m_file;          //!< Bitmap file
+    FwSizeType m_packetSize;  //!< Size of each packet in the scanned file
+    FwSizeType m_count;       //!< Packets recorded
+    FwSizeType m_written;     //!< Packets whose bits have been written to the file, the rest are staged
+    bool m_ended;             //!< A packet could not be recorded by recordOrEnd, no later packet is recorded
+    U8 m_buffer[Utilities::DROP_DETECTOR_BITMAP_BUFFER_SIZE];  //!< Bits not yet written to the file
+};
+
+}  // namespace Utilities
+
+#endif  // FprimeExtras_Utilities_DropBitmap_HPP
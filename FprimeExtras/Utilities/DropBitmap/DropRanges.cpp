@@ -0,0 +1,75 @@
+// ======================================================================
+// \title  DropRanges.cpp
+// \author starchmd
+// \brief  cpp file for DropRanges coalescing of consecutive possibly dropped packets
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#include "FprimeExtras/Utilities/DropBitmap/DropRanges.hpp"
+
+#include "Fw/Types/Assert.hpp"
+
+namespace Utilities {
+
+DropRanges ::DropRanges() : m_drops(0), m_ranges(0), m_inRange(false), m_rangeFirst(0) {}
+
+void DropRanges ::reset() {
+    this->restore(0, 0, false, 0);
+}
+
+void DropRanges ::restore(FwSizeType drops, FwSizeType ranges, bool inRange, FwSizeType rangeFirst) {
+    this->m_drops = drops;
+    this->m_ranges = ranges;
+    this->m_inRange = inRange;
+    this->m_rangeFirst = rangeFirst;
+}
+
+bool DropRanges ::record(FwSizeType index, bool drop, Range& range) {
+    FW_ASSERT(!this->m_inRange || (this->m_rangeFirst < index), static_cast<FwAssertArgType>(this->m_rangeFirst),
+              static_cast<FwAssertArgType>(index));
+    if (drop) {
+        this->m_drops += 1;
+        if (!this->m_inRange) {
+            this->m_inRange = true;
+            this->m_rangeFirst = index;
+        }
+    } else if (this->m_inRange) {
+        this->endRange(index - 1, range);
+        return true;
+    }
+    return false;
+}
+
+bool DropRanges ::finish(FwSizeType packets, Range& range) {
+    if (this->m_inRange) {
+        this->endRange(packets - 1, range);
+        return true;
+    }
+    return false;
+}
+
+FwSizeType DropRanges ::getDrops() const {
+    return this->m_drops;
+}
+
+FwSizeType DropRanges ::getRanges() const {
+    return this->m_ranges;
+}
+
+bool DropRanges ::isInRange() const {
+    return this->m_inRange;
+}
+
+FwSizeType DropRanges ::getRangeFirst() const {
+    return this->m_rangeFirst;
+}
+
+void DropRanges ::endRange(FwSizeType last, Range& range) {
+    FW_ASSERT(this->m_rangeFirst <= last, static_cast<FwAssertArgType>(this->m_rangeFirst),
+              static_cast<FwAssertArgType>(last));
+    range.first = this->m_rangeFirst;
+    range.last = last;
+    this->m_ranges += 1;
+    this->m_inRange = false;
+}
+
+}  // namespace Utilities
@@ -0,0 +1,80 @@
+// ======================================================================
+// \title  DropRanges.hpp
+// \author starchmd
+// \brief  hpp file for DropRanges coalescing of consecutive possibly dropped packets
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#ifndef FprimeExtras_Utilities_DropRanges_HPP
+#define FprimeExtras_Utilities_DropRanges_HPP
+
+#include "Fw/FPrimeBasicTypes.hpp"
+
+namespace Utilities {
+
+//! \brief coalesces consecutive possibly dropped packets into ranges and counts the drops and ranges of a detection
+//!
+//! Packets are recorded in order of their zero-based index. A range is returned once it ends, either at the first
+//! packet that is not a drop or when the detection is finished, such that the caller reports each range once.
+class DropRanges {
+  public:
+    //! \brief range of consecutive drops, as zero-based packet indices
+    struct Range {
+        FwSizeType first;  //!< Index of the first drop in the range
+        FwSizeType last;   //!< Index of the last drop in the range
+    };
+
+    //! Construct with no drops recorded
+    DropRanges();
+
+    //! \brief forget every drop and range to start a new detection
+    void reset();
+
+    //! \brief restore the state of a detection saved from the getters, such as by a checkpoint
+    //!
+    //! \warning A range in progress must start before the next packet recorded, otherwise record fails an assertion.
+    void restore(FwSizeType drops,      //!< Drops found
+                 FwSizeType ranges,     //!< Ranges of drops ended
+                 bool inRange,          //!< A range of drops is in progress
+                 FwSizeType rangeFirst  //!< Index of the first drop in the range in progress
+    );
+
+    //! \brief record the next packet
+    //!
+    //! \param index zero-based index of the packet, one past the previous packet recorded
+    //! \param drop true when the packet is a possible drop
+    //! \param range set to the range that ended at the previous packet, when one did
+    //! \return true when a range ended and was set in range
+    bool record(FwSizeType index, bool drop, Range& range);
+
+    //! \brief end any range in progress at the last packet of the detection
+    //!
+    //! \param packets zero-based index one past the last packet recorded
+    //! \param range set to the range that ended, when one did
+    //! \return true when a range ended and was set in range
+    bool finish(FwSizeType packets, Range& range);
+
+    //! \brief get the number of drops found
+    FwSizeType getDrops() const;
+
+    //! \brief get the number of ranges of drops ended
+    FwSizeType getRanges() const;
+
+    //! \brief check if a range of drops is in progress
+    bool isInRange() const;
+
+    //! \brief get the zero-based index of the first drop in the range in progress
+    FwSizeType getRangeFirst() const;
+
+  private:
+    //! \brief end the range in progress at last, counting it
+    void endRange(FwSizeType last, Range& range);
+
+    FwSizeType m_drops;       //!< Drops found
+    FwSizeType m_ranges;      //!< Ranges of drops ended
+    bool m_inRange;           //!< A range of drops is in progress
+    FwSizeType m_rangeFirst;  //!< Zero-based index of the first drop in the range in progress
+};
+
+}  // namespace Utilities
+
+#endif  // FprimeExtras_Utilities_DropRanges_HPP
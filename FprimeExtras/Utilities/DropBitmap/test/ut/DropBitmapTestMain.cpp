@@ -0,0 +1,211 @@
+// ======================================================================
+// \title  DropBitmapTestMain.cpp
+// \author starchmd
+// \brief  cpp file for DropBitmapWriter and DropRanges unit tests
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include "ExtrasConfig/DropDetectorConfig.hpp"
+#include "FprimeExtras/Utilities/DropBitmap/DropBitmap.hpp"
+#include "FprimeExtras/Utilities/DropBitmap/DropRanges.hpp"
+#include "FprimeExtras/Utilities/FileHelper/FileHelper.hpp"
+#include "Os/FileSystem.hpp"
+#include "STest/Pick/Pick.hpp"
+#include "STest/Random/Random.hpp"
+
+#if defined(__linux__)
+#include <signal.h>
+#include <sys/resource.h>
+#endif
+
+const CHAR* TEST_FILEPATH = "test_bitmap_file.bin";
+
+//! \brief read the bitmap file and check it against the expected packet size and drops
+void checkBitmapFile(FwSizeType packetSize, const std::vector<bool>& drops) {
+    FwSizeType file_size = 0;
+    ASSERT_EQ(Os::FileSystem::getFileSize(TEST_FILEPATH, file_size), Os::FileSystem::OP_OK);
+    ASSERT_EQ(file_size, Utilities::DropBitmapWriter::HEADER_SIZE + ((drops.size() + 7) / 8));
+
+    Os::File file;
+    ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_READ), Os::File::OP_OK);
+    U32 magic = 0;
+    U64 packet_size = 0;
+    U64 packet_count = 0;
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(file, magic), Os::File::OP_OK);
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(file, packet_size), Os::File::OP_OK);
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(file, packet_count), Os::File::OP_OK);
+    ASSERT_EQ(magic, Utilities::DropBitmapWriter::DROP_BITMAP_MAGIC);
+    ASSERT_EQ(packet_size, packetSize);
+    ASSERT_EQ(packet_count, drops.size());
+
+    U8 byte = 0;
+    for (FwSizeType i = 0; i < drops.size(); i++) {
+        if ((i % 8) == 0) {
+            ASSERT_EQ(Utilities::FileHelper::readFromFile(file, byte), Os::File::OP_OK);
+        }
+        ASSERT_EQ(((byte >> (7 - (i % 8))) & 0x1) == 1, drops[i]) << "Mismatch at packet " << i;
+    }
+    // Padding bits are zero
+    if ((drops.size() % 8) != 0) {
+        ASSERT_EQ(byte & (0xFF >> (drops.size() % 8)), 0);
+    }
+}
+
+TEST(DropBitmapTest, RandomBitmap) {
+    for (FwSizeType i = 0; i < 10; i++) {
+        // Cover bitmaps both smaller and larger than the staging buffer
+        const FwSizeType packets =
+            STest::Pick::lowerUpper(0, 3 * 8 * Utilities::DROP_DETECTOR_BITMAP_BUFFER_SIZE);
+        const FwSizeType packet_size = STest::Pick::lowerUpper(1, 4096);
+        std::vector<bool> drops;
+        Utilities::DropBitmapWriter writer;
+        ASSERT_EQ(writer.open(TEST_FILEPATH, packet_size), Os::File::OP_OK);
+        for (FwSizeType j = 0; j < packets; j++) {
+            drops.push_back(STest::Pick::lowerUpper(0, 3) == 0);
+            ASSERT_EQ(writer.record(drops.back()), Os::File::OP_OK);
+        }
+        ASSERT_EQ(writer.getPacketCount(), packets);
+        ASSERT_EQ(writer.close(), Os::File::OP_OK);
+        ASSERT_FALSE(writer.isOpen());
+        checkBitmapFile(packet_size, drops);
+    }
+}
+
+TEST(DropBitmapTest, FullBuffer) {
+    // A bitmap ending exactly on the staging buffer boundary must not write a trailing byte
+    std::vector<bool> drops(8 * Utilities::DROP_DETECTOR_BITMAP_BUFFER_SIZE, true);
+    Utilities::DropBitmapWriter writer;
+    ASSERT_EQ(writer.open(TEST_FILEPATH, 10), Os::File::OP_OK);
+    for (FwSizeType j = 0; j < drops.size(); j++) {
+        ASSERT_EQ(writer.record(drops[j]), Os::File::OP_OK);
+    }
+    ASSERT_EQ(writer.close(), Os::File::OP_OK);
+    checkBitmapFile(10, drops);
+}
+
+#if defined(__linux__)
+TEST(DropBitmapTest, FailedWriteKeepsBits) {
+    const FwSizeType buffer_bits = 8 * Utilities::DROP_DETECTOR_BITMAP_BUFFER_SIZE;
+    std::vector<bool> drops;
+    Utilities::DropBitmapWriter writer;
+    ASSERT_EQ(writer.open(TEST_FILEPATH, 10), Os::File::OP_OK);
+    // Limit the file to its header such that writing the staged bits fails, reporting EFBIG rather than signaling
+    struct rlimit original;
+    ASSERT_EQ(::getrlimit(RLIMIT_FSIZE, &original), 0);
+    struct rlimit limited = original;
+    limited.rlim_cur = Utilities::DropBitmapWriter::HEADER_SIZE;
+    void (*handler)(int) = ::signal(SIGXFSZ, SIG_IGN);
+    ASSERT_EQ(::setrlimit(RLIMIT_FSIZE, &limited), 0);
+    for (FwSizeType j = 0; j < (buffer_bits - 1); j++) {
+        drops.push_back(STest::Pick::lowerUpper(0, 1) == 0);
+        ASSERT_EQ(writer.record(drops.back()), Os::File::OP_OK);
+    }
+    drops.push_back(true);
+    const Os::File::Status full = writer.record(drops.back());
+    // A packet cannot be recorded while the full buffer cannot be written
+    const Os::File::Status retry = writer.record(false);
+    ASSERT_EQ(::setrlimit(RLIMIT_FSIZE, &original), 0);
+    (void)::signal(SIGXFSZ, handler);
+    ASSERT_NE(full, Os::File::OP_OK);
+    ASSERT_NE(retry, Os::File::OP_OK);
+    ASSERT_EQ(writer.getPacketCount(), buffer_bits);
+    // Once writes succeed again the kept bits are written ahead of the next packet
+    drops.push_back(true);
+    ASSERT_EQ(writer.record(drops.back()), Os::File::OP_OK);
+    ASSERT_EQ(writer.close(), Os::File::OP_OK);
+    checkBitmapFile(10, drops);
+}
+
+TEST(DropBitmapTest, FailedWriteEndsBitmap) {
+    const FwSizeType buffer_bits = 8 * Utilities::DROP_DETECTOR_BITMAP_BUFFER_SIZE;
+    std::vector<bool> drops;
+    Utilities::DropBitmapWriter writer;
+    ASSERT_EQ(writer.open(TEST_FILEPATH, 10), Os::File::OP_OK);
+    struct rlimit original;
+    ASSERT_EQ(::getrlimit(RLIMIT_FSIZE, &original), 0);
+    struct rlimit limited = original;
+    limited.rlim_cur = Utilities::DropBitmapWriter::HEADER_SIZE;
+    void (*handler)(int) = ::signal(SIGXFSZ, SIG_IGN);
+    ASSERT_EQ(::setrlimit(RLIMIT_FSIZE, &limited), 0);
+    for (FwSizeType j = 0; j < buffer_bits; j++) {
+        drops.push_back(STest::Pick::lowerUpper(0, 1) == 0);
+        const Os::File::Status status = writer.recordOrEnd(drops.back());
+        // The packet filling the buffer is recorded although the buffer cannot be written
+        if (j < (buffer_bits - 1)) {
+            ASSERT_EQ(status, Os::File::OP_OK);
+        } else {
+            ASSERT_NE(status, Os::File::OP_OK);
+        }
+    }
+    // The retry fails too, so the packet is not recorded and the bitmap ends before it
+    const Os::File::Status retry = writer.recordOrEnd(true);
+    ASSERT_EQ(::setrlimit(RLIMIT_FSIZE, &original), 0);
+    (void)::signal(SIGXFSZ, handler);
+    ASSERT_NE(retry, Os::File::OP_OK);
+    ASSERT_EQ(writer.recordOrEnd(false), Os::File::OP_OK);
+    ASSERT_EQ(writer.getPacketCount(), buffer_bits);
+    // Closing writes the staged bits, with the packet count of the bits recorded
+    ASSERT_EQ(writer.close(), Os::File::OP_OK);
+    checkBitmapFile(10, drops);
+}
+#endif
+
+TEST(DropBitmapTest, CloseWhenClosed) {
+    Utilities::DropBitmapWriter writer;
+    ASSERT_EQ(writer.close(), Os::File::OP_OK);
+}
+
+TEST(DropRangesTest, CoalesceRanges) {
+    // Drops at 1-3, 5, and 8-9 of ten packets, the last range ending with the detection
+    const bool drops[] = {false, true, true, true, false, true, false, false, true, true};
+    const FwSizeType packets = sizeof(drops) / sizeof(drops[0]);
+    Utilities::DropRanges ranges;
+    Utilities::DropRanges::Range range;
+    std::vector<std::pair<FwSizeType, FwSizeType>> ended;
+    for (FwSizeType i = 0; i < packets; i++) {
+        if (ranges.record(i, drops[i], range)) {
+            ended.push_back(std::make_pair(range.first, range.last));
+        }
+    }
+    ASSERT_TRUE(ranges.isInRange());
+    ASSERT_EQ(ranges.getRangeFirst(), 8);
+    ASSERT_TRUE(ranges.finish(packets, range));
+    ended.push_back(std::make_pair(range.first, range.last));
+    ASSERT_FALSE(ranges.finish(packets, range));
+
+    const std::vector<std::pair<FwSizeType, FwSizeType>> expected = {{1, 3}, {5, 5}, {8, 9}};
+    ASSERT_EQ(ended, expected);
+    ASSERT_EQ(ranges.getDrops(), 6);
+    ASSERT_EQ(ranges.getRanges(), 3);
+
+    ranges.reset();
+    ASSERT_FALSE(ranges.finish(packets, range));
+    ASSERT_EQ(ranges.getDrops(), 0);
+    ASSERT_EQ(ranges.getRanges(), 0);
+}
+
+TEST(DropRangesTest, RestoreRange) {
+    // A range in progress at a checkpoint continues once restored
+    Utilities::DropRanges ranges;
+    Utilities::DropRanges::Range range;
+    ranges.restore(4, 2, true, 7);
+    ASSERT_FALSE(ranges.record(9, true, range));
+    ASSERT_TRUE(ranges.record(10, false, range));
+    ASSERT_EQ(range.first, 7);
+    ASSERT_EQ(range.last, 9);
+    ASSERT_EQ(ranges.getDrops(), 5);
+    ASSERT_EQ(ranges.getRanges(), 3);
+    ASSERT_FALSE(ranges.isInRange());
+}
+
+int main(int argc, char* argv[]) {
+    STest::Random::seed();
+    ::testing::InitGoogleTest(&argc, argv);
+    int status = RUN_ALL_TESTS();
+    (void)Os::FileSystem::removeFile(TEST_FILEPATH);
+    return status;
+}
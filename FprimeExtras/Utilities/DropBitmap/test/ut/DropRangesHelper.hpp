@@ -0,0 +1,39 @@
+// ======================================================================
+// \title  DropRangesHelper.hpp
+// \author starchmd
+// \brief  hpp file for the drop range expectations shared by the drop detector unit tests
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#ifndef FprimeExtras_Utilities_DropRangesHelper_HPP
+#define FprimeExtras_Utilities_DropRangesHelper_HPP
+
+#include <utility>
+#include <vector>
+
+#include "FprimeExtras/Utilities/DropBitmap/DropRanges.hpp"
+
+//! \brief coalesce ascending one-based drop indices into [first, last] ranges of consecutive drops
+//!
+//! Ranges are coalesced by the DropRanges shared with the detectors, whose own coalescing is tested in DropBitmap.
+template <typename T>
+std::vector<std::pair<FwSizeType, FwSizeType>> coalesce_drops(const std::vector<T>& drops) {
+    std::vector<std::pair<FwSizeType, FwSizeType>> ranges;
+    Utilities::DropRanges coalescer;
+    Utilities::DropRanges::Range range;
+    // Packets after the last drop cannot change the ranges and are not recorded
+    const FwSizeType packets = drops.empty() ? 0 : static_cast<FwSizeType>(drops.back());
+    FwSizeType next = 0;
+    for (FwSizeType i = 0; i < packets; i++) {
+        const bool drop = (next < drops.size()) && (static_cast<FwSizeType>(drops[next]) == (i + 1));
+        next += drop ? 1 : 0;
+        if (coalescer.record(i, drop, range)) {
+            ranges.push_back(std::make_pair(range.first + 1, range.last + 1));
+        }
+    }
+    if (coalescer.finish(packets, range)) {
+        ranges.push_back(std::make_pair(range.first + 1, range.last + 1));
+    }
+    return ranges;
+}
+
+#endif  // FprimeExtras_Utilities_DropRangesHelper_HPP
@@ -7,80 +7,120 @@
 
 #include "FprimeExtras/Utilities/DropDetector/DropDetector.hpp"
 #include "ExtrasConfig/DropDetectorConfig.hpp"
+#include "FprimeExtras/Utilities/FileHelper/FileHelper.hpp"
+#include "Os/FileSystem.hpp"
+
+#include <limits>
+
 namespace Utilities {
 
 // ----------------------------------------------------------------------
 // Component construction and destruction
 // ----------------------------------------------------------------------
 
-DropDetector ::DropDetector(const char* const compName) : DropDetectorComponentBase(compName), m_packetSize(0), m_index(0), m_opCode(0), m_cmdSeq(0) {}
+DropDetector ::DropDetector(const char* const compName)
+    : DropDetectorComponentBase(compName),
+      m_opCode(0),
+      m_cmdSeq(0),
+      m_packetSize(0),
+      m_firstIndex(0),
+      m_checkpointIndex(0) {}
 
 DropDetector ::~DropDetector() {}
 
+void DropDetector ::configure(const CHAR* checkpointFile) {
+    FW_ASSERT(checkpointFile != nullptr);
+    this->m_checkpointFile = checkpointFile;
+    this->m_checkpointTemp.format("%s.tmp", checkpointFile);
+}
+
+FwSizeType DropDetector ::configureParallel(FwSizeType threads,
+                                            FwEnumStoreType identifier,
+                                            Fw::MemAllocator& allocator) {
+    return this->m_scanner.configure(threads, identifier, allocator);
+}
+
+void DropDetector ::cleanup() {
+    this->m_scanner.cleanup();
+}
+
 // ----------------------------------------------------------------------
 // Handler implementations for typed input ports
 // ----------------------------------------------------------------------
 
-DropDetector::PacketStatus DropDetector ::readPacket(Os::File::Status& fileStatus) {
-    DropDetector::PacketStatus result = PacketStatus::POSSIBLE_DROP;
-    fileStatus = Os::File::OP_OK;
-    U8 buffer[Utilities::DROP_DETECTOR_FILE_READ_BUFFER_SIZE];
-    constexpr FwSizeType BOUND = std::numeric_limits<FwSizeType>::max() - Utilities::DROP_DETECTOR_FILE_READ_BUFFER_SIZE;
-
-    // Loop for enough chunks to cover the packet size
-    for (FwSizeType i = 0; i < this->m_packetSize && i < BOUND; i += Utilities::DROP_DETECTOR_FILE_READ_BUFFER_SIZE) {
-        FwSizeType to_read = FW_MIN(Utilities::DROP_DETECTOR_FILE_READ_BUFFER_SIZE, this->m_packetSize - i);
-        fileStatus = this->m_file.read(buffer, to_read);
-        if (fileStatus != Os::File::OP_OK) {
-            return PacketStatus::FILE_ERROR;
-        }
-        // Check for end of file
-        if (to_read == 0) {
-            return PacketStatus::FILE_EOF;
+void DropDetector ::schedIn_handler(FwIndexType portNum, U32 context) {
+    if (this->m_scanner.isOpen()) {
+        // Budgets that are invalid or not yet loaded are treated as disabled
+        Fw::ParamValid byte_valid = Fw::ParamValid::INVALID;
+        Fw::ParamValid time_valid = Fw::ParamValid::INVALID;
+        FwSizeType byte_budget = this->paramGet_TICK_BYTE_BUDGET(byte_valid);
+        U32 time_budget = this->paramGet_TICK_TIME_BUDGET(time_valid);
+        if ((byte_valid != Fw::ParamValid::VALID) && (byte_valid != Fw::ParamValid::DEFAULT)) {
+            byte_budget = 0;
         }
-        // Check for any non-zero byte in the buffer, if it exists, this is not a drop.
-        for (FwSizeType j = 0; j < to_read; j++) {
-            if (buffer[j] != 0) {
-                return PacketStatus::GOOD;
-            }
+        if ((time_valid != Fw::ParamValid::VALID) && (time_valid != Fw::ParamValid::DEFAULT)) {
+            time_budget = 0;
         }
-    }
-    return result;
-}
+        const FwSizeType max_chunks = ((byte_budget == 0) && (time_budget == 0))
+                                          ? Utilities::DROP_DETECTOR_CHUNKS_PER_RATE_TICK
+                                          : Utilities::DROP_DETECTOR_MAX_CHUNKS_PER_RATE_TICK;
+        const Fw::Time start_time = this->getTime();
+        const FwSizeType start_bytes = this->m_scanner.getBytesScanned();
+        FwSizeType tick_bytes = 0;
 
-void DropDetector ::schedIn_handler(FwIndexType portNum, U32 context) {
-    if (this->m_file.isOpen()) {
-        for (FwSizeType i = 0; i < Utilities::DROP_DETECTOR_CHUNKS_PER_RATE_TICK; i++) {
-            PacketStatus status = PacketStatus::POSSIBLE_DROP;
-            FW_ASSERT(static_cast<FwSizeType>(std::numeric_limits<FwSignedSizeType>::max()) / this->m_packetSize > this->m_index);
+        for (FwSizeType i = 0; i < max_chunks; i++) {
+            DropScanner::PacketStatus status = DropScanner::PacketStatus::POSSIBLE_DROP;
+            const FwSizeType index = this->m_scanner.getIndex();
             Os::File::Status fileStatus = Os::File::OP_OK;
-            status = this->readPacket(fileStatus);
+            status = this->m_scanner.readPacket(fileStatus);
+            tick_bytes = this->m_scanner.getBytesScanned() - start_bytes;
+            // The parallel workers have not reached the packet, it is collected on a later tick
+            if (status == DropScanner::PacketStatus::NOT_READY) {
+                break;
+            }
             // Check for file errors in the seek/read
             if (fileStatus != Os::File::OP_OK) {
                 // File packets are reported as a one-based index because the no-data start packet is zero
-                this->log_WARNING_HI_FileReadError(this->m_index + 1, Os::FileStatus(static_cast<Os::FileStatus::T>(fileStatus)));
-                this->m_file.close();
-                this->m_index = 0;
+                this->log_WARNING_HI_FileReadError(index + 1, Os::FileStatus(static_cast<Os::FileStatus::T>(fileStatus)));
+                this->finishDetection();
                 this->cmdResponse_out(this->m_opCode, this->m_cmdSeq, Fw::CmdResponse::OK);
                 break;
             }
-            // Report event
-            if (status == PacketStatus::POSSIBLE_DROP) {
-                // File packets are reported as a one-based index because the no-data start packet is zero
-                this->log_ACTIVITY_HI_PossibleDrop(this->m_index + 1);
-            }
             // Check for end of file and hanldle completion
-            if (status == PacketStatus::FILE_EOF) {
+            if (status == DropScanner::PacketStatus::FILE_EOF) {
                 // Close the file and send command response
+                this->finishDetection();
                 this->log_ACTIVITY_HI_DetectingDropsCompleted();
-                this->m_file.close();
-                this->m_index = 0;
                 this->cmdResponse_out(this->m_opCode, this->m_cmdSeq, Fw::CmdResponse::OK);
                 break;
             }
-            this->m_index += 1;
+            this->recordPacket(index, status == DropScanner::PacketStatus::POSSIBLE_DROP);
+            // Stop this tick once either budget has been consumed
+            if ((byte_budget != 0) && (tick_bytes >= byte_budget)) {
+                break;
+            }
+            if ((time_budget != 0) &&
+                (DropDetector::elapsedMicroseconds(start_time, this->getTime()) >= time_budget)) {
+                break;
+            }
+        }
+        if (this->m_scanner.isOpen() &&
+            ((this->m_scanner.getIndex() - this->m_checkpointIndex) >= Utilities::DROP_DETECTOR_CHECKPOINT_INTERVAL)) {
+            this->writeCheckpoint();
         }
+        this->tlmWrite_BytesScanned(tick_bytes);
+        this->tlmWrite_ScanTime(DropDetector::elapsedMicroseconds(start_time, this->getTime()));
+    }
+}
+
+U32 DropDetector ::elapsedMicroseconds(const Fw::Time& start, const Fw::Time& stop) {
+    // Time may be unavailable, from differing time bases, or may step backwards. Treat these as no time elapsed.
+    if (Fw::Time::compare(stop, start) != Fw::Time::GT) {
+        return 0;
     }
+    const Fw::Time elapsed = Fw::Time::sub(stop, start);
+    const U64 microseconds = static_cast<U64>(elapsed.getSeconds()) * 1000000 + elapsed.getUSeconds();
+    return static_cast<U32>(FW_MIN(microseconds, static_cast<U64>(std::numeric_limits<U32>::max())));
 }
 
 // ----------------------------------------------------------------------
@@ -91,26 +131,222 @@ void DropDetector ::DETECT_DROPS_cmdHandler(FwOpcodeType opCode,
                                             U32 cmdSeq,
                                             const Fw::CmdStringArg& file,
                                             FwSizeType packet_size) {
-    // Check if the component is already busy                                                
-    if (this->m_file.isOpen()) {
+    this->startDetection(opCode, cmdSeq, file, packet_size, nullptr, nullptr);
+}
+
+void DropDetector ::DETECT_DROPS_BITMAP_cmdHandler(FwOpcodeType opCode,
+                                                   U32 cmdSeq,
+                                                   const Fw::CmdStringArg& file,
+                                                   FwSizeType packet_size,
+                                                   const Fw::CmdStringArg& bitmap) {
+    this->startDetection(opCode, cmdSeq, file, packet_size, &bitmap, nullptr);
+}
+
+void DropDetector ::RESUME_DETECT_DROPS_cmdHandler(FwOpcodeType opCode, U32 cmdSeq) {
+    DropCheckpoint checkpoint;
+    if (!this->loadCheckpoint(checkpoint)) {
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::VALIDATION_ERROR);
+    } else if (this->startDetection(opCode, cmdSeq, checkpoint.get_file(), checkpoint.get_packet_size(), nullptr,
+                                    (checkpoint.get_manifest().length() > 0) ? &checkpoint.get_manifest() : nullptr)) {
+        this->resumeDetection(checkpoint.get_first_index(), checkpoint.get_index());
+        this->m_ranges.restore(checkpoint.get_drops(), checkpoint.get_ranges(), checkpoint.get_in_range(),
+                               checkpoint.get_range_first());
+    }
+}
+
+void DropDetector ::DETECT_NEW_DROPS_cmdHandler(FwOpcodeType opCode,
+                                                U32 cmdSeq,
+                                                const Fw::CmdStringArg& file,
+                                                FwSizeType packet_size) {
+    DropCheckpoint checkpoint;
+    if (!this->loadCheckpoint(checkpoint)) {
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::VALIDATION_ERROR);
+    } else if (!(file == checkpoint.get_file()) || (packet_size != checkpoint.get_packet_size())) {
+        this->log_WARNING_LO_CheckpointMismatch();
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::VALIDATION_ERROR);
+    } else if (this->startDetection(opCode, cmdSeq, file, packet_size, nullptr,
+                                    (checkpoint.get_manifest().length() > 0) ? &checkpoint.get_manifest() : nullptr)) {
+        // A short final packet at the checkpoint may have been completed by appended data and is scanned again
+        const FwSizeType index = FW_MIN(checkpoint.get_index(), checkpoint.get_file_size() / packet_size);
+        this->resumeDetection(index, index);
+    }
+}
+
+void DropDetector ::DETECT_DROPS_MANIFEST_cmdHandler(FwOpcodeType opCode,
+                                                     U32 cmdSeq,
+                                                     const Fw::CmdStringArg& file,
+                                                     FwSizeType packet_size,
+                                                     const Fw::CmdStringArg& manifest) {
+    this->startDetection(opCode, cmdSeq, file, packet_size, nullptr, &manifest);
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+bool DropDetector ::startDetection(FwOpcodeType opCode,
+                                   U32 cmdSeq,
+                                   const Fw::StringBase& file,
+                                   FwSizeType packet_size,
+                                   const Fw::StringBase* bitmap,
+                                   const Fw::StringBase* manifest) {
+    // Check if the component is already busy
+    if (this->m_scanner.isOpen()) {
         this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::BUSY);
     }
     // Check for valid packet size
     else if (packet_size == 0) {
         this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::VALIDATION_ERROR);
     }
-    // Check if the supplied file can be opened
-    else if (this->m_file.open(file.toChar(), Os::File::OPEN_READ) != Os::File::OP_OK) {
+    // Check if the supplied file and manifest can be opened
+    else if (this->openScanner(file, packet_size, manifest) != Os::File::OP_OK) {
+        this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::VALIDATION_ERROR);
+    }
+    // Check if the supplied bitmap file can be created
+    else if ((bitmap != nullptr) && (this->m_bitmap.open(bitmap->toChar(), packet_size) != Os::File::OP_OK)) {
+        this->m_scanner.close();
         this->cmdResponse_out(opCode, cmdSeq, Fw::CmdResponse::VALIDATION_ERROR);
     }
     // Start the drop detection
     else {
         this->log_ACTIVITY_HI_DetectingDrops();
-        this->m_packetSize = packet_size;
-        this->m_index = 0;
+        this->log_ACTIVITY_HI_PossibleDrops_ThrottleClear();
         this->m_opCode = opCode;
         this->m_cmdSeq = cmdSeq;
+        this->m_ranges.reset();
+        this->m_file = file;
+        this->m_manifest = (manifest != nullptr) ? manifest->toChar() : "";
+        this->m_packetSize = packet_size;
+        this->m_firstIndex = 0;
+        this->m_checkpointIndex = 0;
+        return true;
+    }
+    return false;
+}
+
+void DropDetector ::resumeDetection(FwSizeType first_index, FwSizeType index) {
+    FW_ASSERT(first_index <= index, static_cast<FwAssertArgType>(first_index), static_cast<FwAssertArgType>(index));
+    this->m_scanner.setIndex(index);
+    this->m_firstIndex = first_index;
+    this->m_checkpointIndex = index;
+    // File packets are reported as a one-based index because the no-data start packet is zero
+    this->log_ACTIVITY_HI_ResumingDetection(index + 1);
+}
+
+bool DropDetector ::loadCheckpoint(DropCheckpoint& checkpoint) {
+    if (this->m_checkpointFile.length() == 0) {
+        this->log_WARNING_LO_CheckpointReadError(Os::FileStatus::NOT_SUPPORTED);
+        return false;
+    }
+    Os::File::Status status = Utilities::FileHelper::readFromFile(this->m_checkpointFile.toChar(), checkpoint);
+    if (status != Os::File::OP_OK) {
+        this->log_WARNING_LO_CheckpointReadError(Os::FileStatus(static_cast<Os::FileStatus::T>(status)));
+        return false;
+    }
+    // The file must still exist, may only have grown, and must hold every packet the checkpoint claims was scanned
+    const FwSizeType packet_size = checkpoint.get_packet_size();
+    const FwSizeType file_size = checkpoint.get_file_size();
+    const FwSizeType index = checkpoint.get_index();
+    FwSizeType current_size = 0;
+    if ((packet_size == 0) ||
+        (Os::FileSystem::getFileSize(checkpoint.get_file().toChar(), current_size) != Os::FileSystem::OP_OK) ||
+        (current_size < file_size) ||
+        (index > ((file_size / packet_size) + (((file_size % packet_size) != 0) ? 1 : 0))) ||
+        (checkpoint.get_first_index() > index) ||
+        (checkpoint.get_in_range() && (checkpoint.get_range_first() >= index))) {
+        this->log_WARNING_LO_CheckpointMismatch();
+        return false;
+    }
+    return true;
+}
+
+void DropDetector ::writeCheckpoint() {
+    const FwSizeType index = this->m_scanner.getIndex();
+    this->m_checkpointIndex = index;
+    if (this->m_checkpointFile.length() == 0) {
+        return;
+    }
+    // The size lets a later DETECT_NEW_DROPS find the packets that were complete at this checkpoint. Checkpoints are
+    // best-effort, so the previous checkpoint is kept when the size is unavailable.
+    FwSizeType file_size = 0;
+    if (Os::FileSystem::getFileSize(this->m_file.toChar(), file_size) != Os::FileSystem::OP_OK) {
+        return;
+    }
+    DropCheckpoint checkpoint(this->m_file, file_size, this->m_packetSize, this->m_manifest, this->m_firstIndex, index,
+                              this->m_ranges.getDrops(), this->m_ranges.getRanges(), this->m_ranges.isInRange(),
+                              this->m_ranges.getRangeFirst());
+    // The checkpoint is renamed into place such that an interrupted write leaves the previous checkpoint intact
+    Os::File::Status status = Utilities::FileHelper::writeToFile(this->m_checkpointTemp.toChar(), checkpoint);
+    if (status != Os::File::OP_OK) {
+        this->log_WARNING_LO_CheckpointWriteError(Os::FileStatus(static_cast<Os::FileStatus::T>(status)));
+        return;
+    }
+    Os::FileSystem::Status rename_status =
+        Os::FileSystem::rename(this->m_checkpointTemp.toChar(), this->m_checkpointFile.toChar());
+    if (rename_status != Os::FileSystem::OP_OK) {
+        this->log_WARNING_LO_CheckpointRenameError(
+            Os::FileSystemStatus(static_cast<Os::FileSystemStatus::T>(rename_status)));
+    }
+}
+
+void DropDetector ::recordPacket(FwSizeType index, bool drop) {
+    // The bitmap is left open on a failed write such that its staged bits are written again, it is closed on finishing
+    if (this->m_bitmap.isOpen()) {
+        Os::File::Status status = this->m_bitmap.recordOrEnd(drop);
+        if (status != Os::File::OP_OK) {
+            this->log_WARNING_HI_BitmapWriteError(Os::FileStatus(static_cast<Os::FileStatus::T>(status)));
+        }
+    }
+    // Consecutive drops are coalesced into a range reported when the range ends
+    DropRanges::Range range;
+    if (this->m_ranges.record(index, drop, range)) {
+        this->reportRange(range);
+    }
+}
+
+void DropDetector ::reportRange(const DropRanges::Range& range) {
+    // File packets are reported as a one-based index because the no-data start packet is zero
+    this->log_ACTIVITY_HI_PossibleDrops(range.first + 1, range.last + 1);
+}
+
+void DropDetector ::finishDetection() {
+    const FwSizeType packets = this->m_scanner.getIndex();
+    DropRanges::Range range;
+    if (this->m_ranges.finish(packets, range)) {
+        this->reportRange(range);
+    }
+    this->log_ACTIVITY_HI_DropSummary(packets - this->m_firstIndex, this->m_ranges.getDrops(),
+                                      this->m_ranges.getRanges());
+    this->writeCheckpoint();
+    if (this->m_bitmap.isOpen()) {
+        Os::File::Status status = this->m_bitmap.close();
+        if (status != Os::File::OP_OK) {
+            this->log_WARNING_HI_BitmapWriteError(Os::FileStatus(static_cast<Os::FileStatus::T>(status)));
+        }
+    }
+    this->m_scanner.close();
+}
+
+Os::File::Status DropDetector ::openScanner(const Fw::StringBase& file,
+                                            FwSizeType packet_size,
+                                            const Fw::StringBase* manifest) {
+    // Manifests are verified sequentially, in-place when the file can be mapped
+    if (manifest != nullptr) {
+        Os::File::Status status = this->m_scanner.open(file.toChar(), packet_size);
+        if (status == Os::File::OP_OK) {
+            status = this->m_scanner.openManifest(manifest->toChar());
+            if (status != Os::File::OP_OK) {
+                this->m_scanner.close();
+            }
+        }
+        return status;
+    }
+    Fw::ParamValid valid = Fw::ParamValid::INVALID;
+    const U8 threads = this->paramGet_SCAN_THREADS(valid);
+    if (((valid == Fw::ParamValid::VALID) || (valid == Fw::ParamValid::DEFAULT)) && (threads > 1)) {
+        return this->m_scanner.open(file.toChar(), packet_size, DropScanner::Mode::PARALLEL_READ, threads);
     }
+    return this->m_scanner.open(file.toChar(), packet_size);
 }
 
 }  // namespace Utilities
@@ -8,21 +8,18 @@
 #ifndef Utilities_DropDetector_HPP
 #define Utilities_DropDetector_HPP
 
+#include "FprimeExtras/Utilities/DropBitmap/DropBitmap.hpp"
+#include "FprimeExtras/Utilities/DropBitmap/DropRanges.hpp"
+#include "FprimeExtras/Utilities/DropDetector/DropCheckpointSerializableAc.hpp"
 #include "FprimeExtras/Utilities/DropDetector/DropDetectorComponentAc.hpp"
-#include "Os/File.hpp"
+#include "FprimeExtras/Utilities/DropScanner/DropScanner.hpp"
+#include "Fw/Types/FileNameString.hpp"
 
 
 namespace Utilities {
 
 class DropDetector final : public DropDetectorComponentBase {
   public:
-    //! \brief Packet status enumeration for read packet function
-    enum PacketStatus {
-        GOOD, //!< No drop detected
-        POSSIBLE_DROP, //!< Possible drop detected (all zeros)
-        FILE_ERROR, //!< File read error occurred, check i/o parameter
-        FILE_EOF //!< End of file reached
-    };
     // ----------------------------------------------------------------------
     // Component construction and destruction
     // ----------------------------------------------------------------------
@@ -34,8 +31,29 @@ class DropDetector final : public DropDetectorComponentBase {
     //! Destroy DropDetector object
     ~DropDetector();
 
-    //! Read a packet from the file and determine if it is a drop
-    PacketStatus readPacket(Os::File::Status& fileStatus); 
+    //! \brief configure the checkpoint file of drop detections
+    //!
+    //! Detections write their progress to checkpointFile such that RESUME_DETECT_DROPS and DETECT_NEW_DROPS may
+    //! continue them. The checkpoint is first written to checkpointFile with a ".tmp" suffix and then renamed such that
+    //! an interrupted write keeps the previous checkpoint. Checkpoints are disabled until configured.
+    void configure(const CHAR* checkpointFile  //!< Path of the checkpoint file
+    );
+
+    //! \brief allocate and start the worker threads used when SCAN_THREADS is greater than 1
+    //!
+    //! Worker memory is drawn from allocator only when called, detections scan sequentially until configured. At most
+    //! DROP_DETECTOR_PARALLEL_MAX_THREADS threads are supported. The threads scan ahead of the rate group, which only
+    //! collects their results within the tick budgets. A tick reaching a packet not yet scanned ends early without
+    //! waiting, and the packet is collected on a later tick.
+    //!
+    //! \return number of worker threads started
+    FwSizeType configureParallel(FwSizeType threads,           //!< Worker threads, at most the configured maximum
+                                 FwEnumStoreType identifier,  //!< Identifier passed to the allocator
+                                 Fw::MemAllocator& allocator  //!< Allocator of the worker memory
+    );
+
+    //! \brief stop the worker threads and return their memory to the allocator
+    void cleanup();
 
   private:
     // ----------------------------------------------------------------------
@@ -49,6 +67,57 @@ class DropDetector final : public DropDetectorComponentBase {
                          U32 context           //!< The call order
                          ) override;
 
+  private:
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Compute the microseconds elapsed between two times, saturating at the U32 limit
+    static U32 elapsedMicroseconds(const Fw::Time& start,  //!< Time at the start of the interval
+                                   const Fw::Time& stop    //!< Time at the end of the interval
+    );
+
+    //! Open the scanner on file in the mode selected by the SCAN_THREADS parameter, or sequentially with a manifest
+    Os::File::Status openScanner(const Fw::StringBase& file,     //!< The file to scan
+                                 FwSizeType packet_size,         //!< The packet size
+                                 const Fw::StringBase* manifest  //!< The manifest to verify against, nullptr for none
+    );
+
+    //! Validate the detection arguments and start scanning from packet zero, responding to the command on failure
+    //! \return true when the detection was started
+    bool startDetection(FwOpcodeType opCode,            //!< The opcode
+                        U32 cmdSeq,                     //!< The command sequence number
+                        const Fw::StringBase& file,     //!< The file to scan
+                        FwSizeType packet_size,         //!< The packet size
+                        const Fw::StringBase* bitmap,   //!< The bitmap file to write, nullptr for none
+                        const Fw::StringBase* manifest  //!< The manifest to verify against, nullptr for none
+    );
+
+    //! Move the started detection to index, counting the summary from first_index
+    void resumeDetection(FwSizeType first_index,  //!< Zero-based index of the first packet of the detection
+                         FwSizeType index         //!< Zero-based index of the next packet to scan
+    );
+
+    //! Read the checkpoint file and check it is consistent with the file it records, logging any failure
+    //! \return true when the checkpoint may be resumed
+    bool loadCheckpoint(DropCheckpoint& checkpoint  //!< Checkpoint read from the checkpoint file
+    );
+
+    //! Write the progress of the current detection to the checkpoint file, if configured
+    void writeCheckpoint();
+
+    //! Record a scanned packet in the bitmap file and the current range of drops
+    void recordPacket(FwSizeType index,  //!< Zero-based index of the packet
+                      bool drop          //!< The packet is a possible drop
+    );
+
+    //! Report a range of drops that ended
+    void reportRange(const DropRanges::Range& range  //!< Range of drops, as zero-based indices
+    );
+
+    //! Report the final range and summary, write the checkpoint, then close the bitmap file and scanner
+    void finishDetection();
+
   private:
     // ----------------------------------------------------------------------
     // Handler implementations for commands
@@ -56,19 +125,69 @@ class DropDetector final : public DropDetectorComponentBase {
 
     //! Handler implementation for command DETECT_DROPS
     //!
-    //! Search the specified file for sequences of zeros of length packet_size and report their
-    //! one-based indices via events.
+    //! Search the specified file for sequences of zeros of length packet_size and report ranges of
+    //! their one-based indices via events.
     void DETECT_DROPS_cmdHandler(FwOpcodeType opCode,  //!< The opcode
                                  U32 cmdSeq,           //!< The command sequence number
                                  const Fw::CmdStringArg& file,
                                  FwSizeType packet_size) override;
-    Os::File m_file;
-    FwSizeType m_packetSize;
-    FwSizeType m_index;
+
+    //! Handler implementation for command DETECT_DROPS_BITMAP
+    //!
+    //! Search the specified file for sequences of zeros of length packet_size as DETECT_DROPS does, additionally
+    //! writing a one-bit-per-packet bitmap of the possible drops to the bitmap file.
+    void DETECT_DROPS_BITMAP_cmdHandler(FwOpcodeType opCode,  //!< The opcode
+                                        U32 cmdSeq,           //!< The command sequence number
+                                        const Fw::CmdStringArg& file,
+                                        FwSizeType packet_size,
+                                        const Fw::CmdStringArg& bitmap) override;
+
+    //! Handler implementation for command RESUME_DETECT_DROPS
+    //!
+    //! Resume the drop detection recorded in the checkpoint file at the packet following the checkpoint, as after a
+    //! reboot. Drops found before the checkpoint are included in the summary.
+    void RESUME_DETECT_DROPS_cmdHandler(FwOpcodeType opCode,  //!< The opcode
+                                        U32 cmdSeq            //!< The command sequence number
+                                        ) override;
+
+    //! Handler implementation for command DETECT_NEW_DROPS
+    //!
+    //! Search only the packets of the specified file that were not complete at the checkpoint, as after more data
+    //! has been appended to a file that was already scanned. The file and packet_size must match the checkpoint.
+    //! The summary covers only the packets scanned by this command.
+    void DETECT_NEW_DROPS_cmdHandler(FwOpcodeType opCode,  //!< The opcode
+                                     U32 cmdSeq,           //!< The command sequence number
+                                     const Fw::CmdStringArg& file,
+                                     FwSizeType packet_size) override;
+
+    //! Handler implementation for command DETECT_DROPS_MANIFEST
+    //!
+    //! Verify each packet of the specified file against the manifest file of per-packet CRC32 values rather than
+    //! searching for zeros, reporting ranges of the one-based indices of packets that do not match as DETECT_DROPS
+    //! does. The manifest holds one big-endian CRC32 per packet in index order. Packets listed in the manifest but
+    //! missing from the end of the file are reported as drops.
+    void DETECT_DROPS_MANIFEST_cmdHandler(FwOpcodeType opCode,  //!< The opcode
+                                          U32 cmdSeq,           //!< The command sequence number
+                                          const Fw::CmdStringArg& file,
+                                          FwSizeType packet_size,
+                                          const Fw::CmdStringArg& manifest) override;
+
+    DropScanner m_scanner;
+    DropBitmapWriter m_bitmap;
 
     FwOpcodeType m_opCode;
     U32 m_cmdSeq;
 
+    Fw::FileNameString m_file;            //!< File of the current detection
+    Fw::FileNameString m_manifest;        //!< Manifest of the current detection, empty when detecting zeros
+    FwSizeType m_packetSize;              //!< Packet size of the current detection
+    FwSizeType m_firstIndex;              //!< Zero-based index of the first packet of the current detection
+    Fw::FileNameString m_checkpointFile;  //!< Checkpoint file, empty when checkpoints are disabled
+    Fw::FileNameString m_checkpointTemp;  //!< Checkpoint file written before being renamed to m_checkpointFile
+    FwSizeType m_checkpointIndex;         //!< Index of the next packet when the checkpoint was last written
+
+    DropRanges m_ranges;  //!< Drops and ranges of drops found in the current detection
+
 };
 
 }  // namespace Utilities
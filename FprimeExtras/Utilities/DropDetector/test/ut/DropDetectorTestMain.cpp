@@ -17,6 +17,41 @@ TEST_F(DropHarness, Drops) {
     tester.test_drops(*this);
 }
 
+TEST_F(DropHarness, ByteBudget) {
+    Utilities::DropDetectorTester tester;
+    tester.test_byte_budget(*this);
+}
+
+TEST_F(DropHarness, TimeBudget) {
+    Utilities::DropDetectorTester tester;
+    tester.test_time_budget(*this);
+}
+
+TEST_F(DropHarness, ParallelDrops) {
+    Utilities::DropDetectorTester tester;
+    tester.test_parallel_drops(*this);
+}
+
+TEST_F(DropHarness, Bitmap) {
+    Utilities::DropDetectorTester tester;
+    tester.test_bitmap(*this);
+}
+
+TEST_F(DropHarness, Manifest) {
+    Utilities::DropDetectorTester tester;
+    tester.test_manifest(*this);
+}
+
+TEST_F(DropHarness, Resume) {
+    Utilities::DropDetectorTester tester;
+    tester.test_resume(*this);
+}
+
+TEST_F(DropHarness, NewDrops) {
+    Utilities::DropDetectorTester tester;
+    tester.test_new_drops(*this);
+}
+
 int main(int argc, char** argv) {
     STest::Random::seed();
     ::testing::InitGoogleTest(&argc, argv);
@@ -7,7 +7,11 @@
 #include "DropDetectorTester.hpp"
 #include "STest/Pick/Pick.hpp"
 #include "ExtrasConfig/DropDetectorConfig.hpp"
+#include "FprimeExtras/Utilities/DropBitmap/test/ut/DropRangesHelper.hpp"
+#include "FprimeExtras/Utilities/FileHelper/Crc32.hpp"
+#include "FprimeExtras/Utilities/FileHelper/FileHelper.hpp"
 #include "Os/FileSystem.hpp"
+#include "Os/Task.hpp"
 #include <algorithm>
 
 void DropDetectorTestHarness ::SetUp() {
@@ -58,6 +62,17 @@ void DropHarness ::SetUp() {
     file.close();
 }
 
+std::vector<std::pair<FwSizeType, FwSizeType>> DropHarness ::drop_ranges() const {
+    return coalesce_drops(this->drop_indices);
+}
+
+//! \brief get the number of packets in a file including a short final packet
+FwSizeType file_packets(const char* path, FwSizeType packet_size) {
+    FwSizeType size = 0;
+    EXPECT_EQ(Os::FileSystem::getFileSize(path, size), Os::FileSystem::OP_OK);
+    return (size / packet_size) + (((size % packet_size) != 0) ? 1 : 0);
+}
+
 namespace Utilities {
 
 // ----------------------------------------------------------------------
@@ -65,9 +80,14 @@ namespace Utilities {
 // ----------------------------------------------------------------------
 
 DropDetectorTester ::DropDetectorTester()
-    : DropDetectorGTestBase("DropDetectorTester", DropDetectorTester::MAX_HISTORY_SIZE), component("DropDetector") {
+    : DropDetectorGTestBase("DropDetectorTester", DropDetectorTester::MAX_HISTORY_SIZE),
+      component("DropDetector"),
+      m_clockTime(1, 0),
+      m_clockStep(0) {
     this->initComponents();
     this->connectPorts();
+    this->m_clock.init();
+    this->m_clock.addCallComp(this, DropDetectorTester::from_clock_static);
 }
 
 DropDetectorTester ::~DropDetectorTester() {}
@@ -77,20 +97,319 @@ DropDetectorTester ::~DropDetectorTester() {}
 // ----------------------------------------------------------------------
 
 void DropDetectorTester ::test_drops(DropHarness& harness) {
-    FwSizeType expected_drops = 0;
     Fw::String fileStr(harness.TEST_FILE_NAME);
     this->sendCmd_DETECT_DROPS(0, 0, fileStr, harness.TEST_PACKET_SIZE);
     ASSERT_EVENTS_DetectingDrops_SIZE(1);
     for (FwSizeType i = 0; i < harness.packets; i++) {
         this->invoke_to_schedIn(0, 0);
-        if (std::find(harness.drop_indices.begin(), harness.drop_indices.end(), i + 1) != harness.drop_indices.end()) {
-            expected_drops++;
-            ASSERT_EVENTS_PossibleDrop(expected_drops - 1, i + 1);
+    }
+    this->assertDropEvents(harness);
+    ASSERT_EVENTS_FileReadError_SIZE(0);
+    ASSERT_EVENTS_DetectingDropsCompleted_SIZE(1);
+}
+
+void DropDetectorTester ::test_byte_budget(DropHarness& harness) {
+    const FwSizeType budget = 5 * harness.TEST_PACKET_SIZE;
+    this->paramSet_TICK_BYTE_BUDGET(budget, Fw::ParamValid::VALID);
+    this->component.loadParameters();
+
+    Fw::String fileStr(harness.TEST_FILE_NAME);
+    this->sendCmd_DETECT_DROPS(0, 0, fileStr, harness.TEST_PACKET_SIZE);
+    ASSERT_EVENTS_DetectingDrops_SIZE(1);
+    FwSizeType ticks = 0;
+    while ((this->eventsSize_DetectingDropsCompleted == 0) && (ticks <= harness.packets)) {
+        this->invoke_to_schedIn(0, 0);
+        ticks++;
+    }
+    ASSERT_EVENTS_DetectingDropsCompleted_SIZE(1);
+    ASSERT_EVENTS_FileReadError_SIZE(0);
+    this->assertDropEvents(harness);
+    // Every tick but the last must have consumed the full budget, and no tick may run on past the budget by more than
+    // the single packet that crossed it
+    ASSERT_TLM_BytesScanned_SIZE(ticks);
+    ASSERT_TLM_ScanTime_SIZE(ticks);
+    for (FwSizeType i = 0; i < ticks; i++) {
+        const FwSizeType bytes = this->tlmHistory_BytesScanned->at(i).arg;
+        ASSERT_LT(bytes, budget + harness.TEST_PACKET_SIZE);
+        if (i < (ticks - 1)) {
+            ASSERT_GE(bytes, budget);
         }
     }
-    ASSERT_EVENTS_PossibleDrop_SIZE(expected_drops);
+}
+
+void DropDetectorTester ::test_time_budget(DropHarness& harness) {
+    // Each time query advances the clock by one step. The detector queries time once per packet scanned, and events
+    // query time for their time tags, so no tick may scan more packets than fit the budget.
+    const U32 step = 100;
+    const FwSizeType packets_per_tick = 5;
+    const U32 budget = static_cast<U32>(packets_per_tick) * step;
+    this->m_clockStep = step;
+    this->component.set_timeCaller_OutputPort(0, &this->m_clock);
+    this->paramSet_TICK_TIME_BUDGET(budget, Fw::ParamValid::VALID);
+    this->component.loadParameters();
+
+    Fw::String fileStr(harness.TEST_FILE_NAME);
+    this->sendCmd_DETECT_DROPS(0, 0, fileStr, harness.TEST_PACKET_SIZE);
+    ASSERT_EVENTS_DetectingDrops_SIZE(1);
+    FwSizeType ticks = 0;
+    while ((this->eventsSize_DetectingDropsCompleted == 0) && (ticks <= harness.packets)) {
+        this->invoke_to_schedIn(0, 0);
+        ticks++;
+    }
+    ASSERT_EVENTS_DetectingDropsCompleted_SIZE(1);
     ASSERT_EVENTS_FileReadError_SIZE(0);
+    this->assertDropEvents(harness);
+    // Every tick scans at most the packets fitting the budget, the final tick also finds the end of file
+    const FwSizeType packets = file_packets(harness.TEST_FILE_NAME, harness.TEST_PACKET_SIZE);
+    ASSERT_GE(ticks, (packets / packets_per_tick) + 1);
+    ASSERT_TLM_ScanTime_SIZE(ticks);
+    for (FwSizeType i = 0; i < (ticks - 1); i++) {
+        ASSERT_GE(this->tlmHistory_ScanTime->at(i).arg, budget);
+    }
+}
+
+void DropDetectorTester ::test_parallel_drops(DropHarness& harness) {
+    ASSERT_EQ(this->component.configureParallel(Utilities::DROP_DETECTOR_PARALLEL_MAX_THREADS, 0, this->m_allocator),
+              Utilities::DROP_DETECTOR_PARALLEL_MAX_THREADS);
+    this->paramSet_SCAN_THREADS(static_cast<U8>(Utilities::DROP_DETECTOR_PARALLEL_MAX_THREADS), Fw::ParamValid::VALID);
+    this->component.loadParameters();
+
+    Fw::String fileStr(harness.TEST_FILE_NAME);
+    this->sendCmd_DETECT_DROPS(0, 0, fileStr, harness.TEST_PACKET_SIZE);
+    ASSERT_EVENTS_DetectingDrops_SIZE(1);
+    FwSizeType ticks = 0;
+    while ((this->eventsSize_DetectingDropsCompleted == 0) && (ticks <= harness.packets)) {
+        this->invoke_to_schedIn(0, 0);
+        ticks++;
+        // Ticks do not wait on the workers, pace them as a rate group would
+        Os::Task::delay(Fw::TimeInterval(0, 100));
+    }
+    // Events must match those of a sequential scan
+    ASSERT_EVENTS_DetectingDropsCompleted_SIZE(1);
+    ASSERT_EVENTS_FileReadError_SIZE(0);
+    this->assertDropEvents(harness);
+    ASSERT_CMD_RESPONSE_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, DropDetector::OPCODE_DETECT_DROPS, 0, Fw::CmdResponse::OK);
+}
+
+void DropDetectorTester ::test_bitmap(DropHarness& harness) {
+    const char* const BITMAP_FILE_NAME = "test_bitmap.bin";
+    Fw::String fileStr(harness.TEST_FILE_NAME);
+    Fw::String bitmapStr(BITMAP_FILE_NAME);
+    this->sendCmd_DETECT_DROPS_BITMAP(0, 0, fileStr, harness.TEST_PACKET_SIZE, bitmapStr);
+    ASSERT_EVENTS_DetectingDrops_SIZE(1);
+    FwSizeType ticks = 0;
+    while ((this->eventsSize_DetectingDropsCompleted == 0) && (ticks <= harness.packets)) {
+        this->invoke_to_schedIn(0, 0);
+        ticks++;
+    }
     ASSERT_EVENTS_DetectingDropsCompleted_SIZE(1);
+    ASSERT_EVENTS_BitmapWriteError_SIZE(0);
+    this->assertDropEvents(harness);
+    ASSERT_CMD_RESPONSE(0, DropDetector::OPCODE_DETECT_DROPS_BITMAP, 0, Fw::CmdResponse::OK);
+
+    // Header fields
+    Os::File file;
+    ASSERT_EQ(file.open(BITMAP_FILE_NAME, Os::File::OPEN_READ), Os::File::OP_OK);
+    U32 magic = 0;
+    U64 packet_size = 0;
+    U64 packet_count = 0;
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(file, magic), Os::File::OP_OK);
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(file, packet_size), Os::File::OP_OK);
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(file, packet_count), Os::File::OP_OK);
+    ASSERT_EQ(magic, DropBitmapWriter::DROP_BITMAP_MAGIC);
+    ASSERT_EQ(packet_size, harness.TEST_PACKET_SIZE);
+    ASSERT_EQ(packet_count, this->eventHistory_DropSummary->at(0).packets);
+
+    // One bit per packet, set for each drop
+    U8 byte = 0;
+    for (FwSizeType i = 0; i < packet_count; i++) {
+        if ((i % 8) == 0) {
+            ASSERT_EQ(Utilities::FileHelper::readFromFile(file, byte), Os::File::OP_OK);
+        }
+        const bool expected = std::find(harness.drop_indices.begin(), harness.drop_indices.end(), i + 1) !=
+                              harness.drop_indices.end();
+        ASSERT_EQ(((byte >> (7 - (i % 8))) & 0x1) == 1, expected) << "Mismatch at packet " << i;
+    }
+    file.close();
+    (void)Os::FileSystem::removeFile(BITMAP_FILE_NAME);
+}
+
+void DropDetectorTester ::test_manifest(DropHarness& harness) {
+    const char* const MANIFEST_FILE_NAME = "test_manifest.bin";
+    // Manifest the file as sent, such that the zeroed packets no longer match
+    Os::File file;
+    Os::File manifest;
+    ASSERT_EQ(file.open(harness.TEST_FILE_NAME, Os::File::OPEN_READ), Os::File::OP_OK);
+    ASSERT_EQ(manifest.open(MANIFEST_FILE_NAME, Os::File::OPEN_CREATE, Os::File::OVERWRITE), Os::File::OP_OK);
+    std::vector<U8> packet(harness.TEST_PACKET_SIZE);
+    for (U32 i = 1; true; i++) {
+        FwSizeType size = packet.size();
+        ASSERT_EQ(file.read(packet.data(), size), Os::File::OP_OK);
+        if (size == 0) {
+            break;
+        }
+        U32 crc = Utilities::FileHelper::crc32(packet.data(), size);
+        if (std::find(harness.drop_indices.begin(), harness.drop_indices.end(), i) != harness.drop_indices.end()) {
+            crc ^= 1;
+        }
+        ASSERT_EQ(Utilities::FileHelper::writeToFile(manifest, crc), Os::File::OP_OK);
+    }
+    file.close();
+    manifest.close();
+
+    Fw::String fileStr(harness.TEST_FILE_NAME);
+    Fw::String manifestStr(MANIFEST_FILE_NAME);
+    this->sendCmd_DETECT_DROPS_MANIFEST(0, 0, fileStr, harness.TEST_PACKET_SIZE, manifestStr);
+    ASSERT_EVENTS_DetectingDrops_SIZE(1);
+    FwSizeType ticks = 0;
+    while ((this->eventsSize_DetectingDropsCompleted == 0) && (ticks <= harness.packets)) {
+        this->invoke_to_schedIn(0, 0);
+        ticks++;
+    }
+    ASSERT_EVENTS_DetectingDropsCompleted_SIZE(1);
+    ASSERT_EVENTS_FileReadError_SIZE(0);
+    this->assertDropEvents(harness);
+    ASSERT_CMD_RESPONSE(0, DropDetector::OPCODE_DETECT_DROPS_MANIFEST, 0, Fw::CmdResponse::OK);
+
+    // A missing manifest is rejected
+    Fw::String missingStr("does_not_exist.bin");
+    this->sendCmd_DETECT_DROPS_MANIFEST(0, 0, fileStr, harness.TEST_PACKET_SIZE, missingStr);
+    ASSERT_CMD_RESPONSE(1, DropDetector::OPCODE_DETECT_DROPS_MANIFEST, 0, Fw::CmdResponse::VALIDATION_ERROR);
+    (void)Os::FileSystem::removeFile(MANIFEST_FILE_NAME);
+}
+
+void DropDetectorTester ::test_resume(DropHarness& harness) {
+    const char* const CHECKPOINT_FILE_NAME = "test_checkpoint.bin";
+    (void)Os::FileSystem::removeFile(CHECKPOINT_FILE_NAME);
+    // Resuming requires a configured checkpoint file
+    this->sendCmd_RESUME_DETECT_DROPS(0, 0);
+    ASSERT_EVENTS_CheckpointReadError_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, DropDetector::OPCODE_RESUME_DETECT_DROPS, 0, Fw::CmdResponse::VALIDATION_ERROR);
+    this->component.configure(CHECKPOINT_FILE_NAME);
+    this->clearHistory();
+
+    // Checkpoint the detection as if interrupted before the packet at a random zero-based index
+    FwSizeType file_size = 0;
+    ASSERT_EQ(Os::FileSystem::getFileSize(harness.TEST_FILE_NAME, file_size), Os::FileSystem::OP_OK);
+    const FwSizeType packets = file_packets(harness.TEST_FILE_NAME, harness.TEST_PACKET_SIZE);
+    const FwSizeType index = STest::Pick::lowerUpper(0, static_cast<U32>(packets));
+    const std::vector<std::pair<FwSizeType, FwSizeType>> ranges = harness.drop_ranges();
+    std::vector<std::pair<FwSizeType, FwSizeType>> remaining;
+    FwSizeType drops = 0;
+    FwSizeType reported = 0;
+    bool in_range = false;
+    FwSizeType range_first = 0;
+    for (const std::pair<FwSizeType, FwSizeType>& range : ranges) {
+        // One-based ranges ending before the zero-based index were reported before the checkpoint
+        if (range.second < index) {
+            reported += 1;
+        } else {
+            remaining.push_back(range);
+            if (range.first <= index) {
+                in_range = true;
+                range_first = range.first - 1;
+            }
+        }
+        drops += (FW_MIN(range.second, index) >= range.first) ? (FW_MIN(range.second, index) - range.first + 1) : 0;
+    }
+    Fw::String fileStr(harness.TEST_FILE_NAME);
+    DropCheckpoint checkpoint(fileStr, file_size, harness.TEST_PACKET_SIZE, Fw::String(""), 0, index, drops, reported,
+                              in_range, range_first);
+    ASSERT_EQ(Utilities::FileHelper::writeToFile(CHECKPOINT_FILE_NAME, checkpoint), Os::File::OP_OK);
+
+    this->sendCmd_RESUME_DETECT_DROPS(0, 0);
+    ASSERT_EVENTS_ResumingDetection_SIZE(1);
+    ASSERT_EVENTS_ResumingDetection(0, index + 1);
+    FwSizeType ticks = 0;
+    while ((this->eventsSize_DetectingDropsCompleted == 0) && (ticks <= harness.packets)) {
+        this->invoke_to_schedIn(0, 0);
+        ticks++;
+    }
+    ASSERT_EVENTS_DetectingDropsCompleted_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, DropDetector::OPCODE_RESUME_DETECT_DROPS, 0, Fw::CmdResponse::OK);
+    // Only ranges not reported before the checkpoint are reported, the summary covers the whole file
+    this->assertRangeEvents(remaining);
+    ASSERT_EVENTS_DropSummary_SIZE(1);
+    ASSERT_EVENTS_DropSummary(0, packets, harness.drop_indices.size(), ranges.size());
+
+    // The checkpoint written on completion records the whole file
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(CHECKPOINT_FILE_NAME, checkpoint), Os::File::OP_OK);
+    ASSERT_EQ(checkpoint.get_index(), packets);
+    ASSERT_EQ(checkpoint.get_file_size(), file_size);
+    ASSERT_EQ(checkpoint.get_drops(), harness.drop_indices.size());
+    ASSERT_EQ(checkpoint.get_ranges(), ranges.size());
+    ASSERT_FALSE(checkpoint.get_in_range());
+    (void)Os::FileSystem::removeFile(CHECKPOINT_FILE_NAME);
+}
+
+void DropDetectorTester ::test_new_drops(DropHarness& harness) {
+    const char* const CHECKPOINT_FILE_NAME = "test_checkpoint.bin";
+    this->component.configure(CHECKPOINT_FILE_NAME);
+    Fw::String fileStr(harness.TEST_FILE_NAME);
+    this->sendCmd_DETECT_DROPS(0, 0, fileStr, harness.TEST_PACKET_SIZE);
+    FwSizeType ticks = 0;
+    while ((this->eventsSize_DetectingDropsCompleted == 0) && (ticks <= harness.packets)) {
+        this->invoke_to_schedIn(0, 0);
+        ticks++;
+    }
+    ASSERT_EVENTS_DetectingDropsCompleted_SIZE(1);
+    this->assertDropEvents(harness);
+
+    // Append packets to the file, completing any short final packet
+    FwSizeType file_size = 0;
+    ASSERT_EQ(Os::FileSystem::getFileSize(harness.TEST_FILE_NAME, file_size), Os::FileSystem::OP_OK);
+    Os::File file;
+    ASSERT_EQ(file.open(harness.TEST_FILE_NAME, Os::File::OPEN_APPEND), Os::File::OP_OK);
+    std::vector<U8> packet(harness.TEST_PACKET_SIZE);
+    const FwSizeType appended = STest::Pick::lowerUpper(1, 500);
+    for (FwSizeType i = 0; i < appended; i++) {
+        const bool drop = STest::Pick::lowerUpper(0, 3) == 0;
+        std::fill(packet.begin(), packet.end(), drop ? 0 : 0xFF);
+        FwSizeType size = packet.size();
+        ASSERT_EQ(file.write(packet.data(), size), Os::File::OP_OK);
+    }
+    file.close();
+
+    // Expected one-based drops from the first packet that was not complete at the checkpoint
+    const FwSizeType first = file_size / harness.TEST_PACKET_SIZE;
+    const FwSizeType packets = file_packets(harness.TEST_FILE_NAME, harness.TEST_PACKET_SIZE);
+    std::vector<FwSizeType> drops;
+    ASSERT_EQ(file.open(harness.TEST_FILE_NAME, Os::File::OPEN_READ), Os::File::OP_OK);
+    ASSERT_EQ(file.seek(static_cast<FwSignedSizeType>(first * harness.TEST_PACKET_SIZE), Os::File::ABSOLUTE),
+              Os::File::OP_OK);
+    for (FwSizeType i = first; i < packets; i++) {
+        FwSizeType size = packet.size();
+        ASSERT_EQ(file.read(packet.data(), size), Os::File::OP_OK);
+        if (std::all_of(packet.begin(), packet.begin() + size, [](U8 byte) { return byte == 0; })) {
+            drops.push_back(i + 1);
+        }
+    }
+    file.close();
+
+    // A mismatched packet size is rejected
+    this->clearHistory();
+    this->sendCmd_DETECT_NEW_DROPS(0, 0, fileStr, harness.TEST_PACKET_SIZE + 1);
+    ASSERT_EVENTS_CheckpointMismatch_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, DropDetector::OPCODE_DETECT_NEW_DROPS, 0, Fw::CmdResponse::VALIDATION_ERROR);
+
+    this->clearHistory();
+    this->sendCmd_DETECT_NEW_DROPS(0, 0, fileStr, harness.TEST_PACKET_SIZE);
+    ASSERT_EVENTS_ResumingDetection_SIZE(1);
+    ASSERT_EVENTS_ResumingDetection(0, first + 1);
+    ticks = 0;
+    while ((this->eventsSize_DetectingDropsCompleted == 0) && (ticks <= packets)) {
+        this->invoke_to_schedIn(0, 0);
+        ticks++;
+    }
+    ASSERT_EVENTS_DetectingDropsCompleted_SIZE(1);
+    ASSERT_CMD_RESPONSE(0, DropDetector::OPCODE_DETECT_NEW_DROPS, 0, Fw::CmdResponse::OK);
+    // Only the new packets are scanned and summarized
+    const std::vector<std::pair<FwSizeType, FwSizeType>> ranges = coalesce_drops(drops);
+    this->assertRangeEvents(ranges);
+    ASSERT_EVENTS_DropSummary_SIZE(1);
+    ASSERT_EVENTS_DropSummary(0, packets - first, drops.size(), ranges.size());
+    (void)Os::FileSystem::removeFile(CHECKPOINT_FILE_NAME);
 }
 
 void DropDetectorTester ::test_no_drops(NoDropHarness& harness) {
@@ -100,9 +419,40 @@ void DropDetectorTester ::test_no_drops(NoDropHarness& harness) {
     for (FwSizeType i = 0; i < harness.packets; i++) {
         this->invoke_to_schedIn(0, 0);
     }
-    ASSERT_EVENTS_PossibleDrop_SIZE(0);
+    ASSERT_EVENTS_PossibleDrops_SIZE(0);
     ASSERT_EVENTS_FileReadError_SIZE(0);
     ASSERT_EVENTS_DetectingDropsCompleted_SIZE(1);
 }
 
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+void DropDetectorTester ::from_clock_static(Fw::PassiveComponentBase* const callComp,
+                                            FwIndexType portNum,
+                                            Fw::Time& time) {
+    DropDetectorTester* tester = static_cast<DropDetectorTester*>(callComp);
+    time = tester->m_clockTime;
+    tester->m_clockTime = Fw::Time::add(tester->m_clockTime, Fw::Time(0, tester->m_clockStep));
+}
+
+void DropDetectorTester ::assertRangeEvents(const std::vector<std::pair<FwSizeType, FwSizeType>>& ranges) {
+    // Range events beyond the throttle are suppressed
+    const FwSizeType reported =
+        FW_MIN(ranges.size(), static_cast<FwSizeType>(DropDetectorComponentBase::EVENTID_POSSIBLEDROPS_THROTTLE));
+    ASSERT_EVENTS_PossibleDrops_SIZE(reported);
+    for (FwSizeType i = 0; i < reported; i++) {
+        ASSERT_EVENTS_PossibleDrops(i, ranges[i].first, ranges[i].second);
+    }
+}
+
+void DropDetectorTester ::assertDropEvents(const DropHarness& harness) {
+    const std::vector<std::pair<FwSizeType, FwSizeType>> ranges = harness.drop_ranges();
+    // The summary still counts every range when range events are throttled
+    this->assertRangeEvents(ranges);
+    ASSERT_EVENTS_DropSummary_SIZE(1);
+    ASSERT_EQ(this->eventHistory_DropSummary->at(0).drops, harness.drop_indices.size());
+    ASSERT_EQ(this->eventHistory_DropSummary->at(0).ranges, ranges.size());
+}
+
 }  // namespace Utilities
@@ -9,6 +9,8 @@
 
 #include "FprimeExtras/Utilities/DropDetector/DropDetector.hpp"
 #include "FprimeExtras/Utilities/DropDetector/DropDetectorGTestBase.hpp"
+#include "Fw/Types/MallocAllocator.hpp"
+#include <utility>
 #include <vector>
 
 
@@ -33,6 +35,9 @@ class DropHarness : public DropDetectorTestHarness {
     //! \brief set up test harness, file, etc
     void SetUp() override;
 
+    //! \brief get the expected [first, last] ranges of drops as one-based indices
+    std::vector<std::pair<FwSizeType, FwSizeType>> drop_ranges() const;
+
     //! \brief teardown test harness, file, etc
     std::vector<U32> drop_indices;
 
@@ -74,24 +79,66 @@ class DropDetectorTester final : public DropDetectorGTestBase {
     //! Test file with drops
     void test_drops(DropHarness& harness);
 
+    //! Test file with drops scanned under a per-tick byte budget
+    void test_byte_budget(DropHarness& harness);
+
+    //! Test file with drops scanned under a per-tick time budget
+    void test_time_budget(DropHarness& harness);
+
+    //! Test file with drops scanned in parallel
+    void test_parallel_drops(DropHarness& harness);
+
+    //! Test file with drops recorded to a bitmap file
+    void test_bitmap(DropHarness& harness);
+
+    //! Test file with drops verified against a CRC manifest
+    void test_manifest(DropHarness& harness);
+
+    //! Test file with drops resumed from a checkpoint
+    void test_resume(DropHarness& harness);
+
+    //! Test file with drops scanned again after data is appended
+    void test_new_drops(DropHarness& harness);
+
   private:
     // ----------------------------------------------------------------------
     // Helper functions
     // ----------------------------------------------------------------------
 
+    //! Assert the drop range events match the expected one-based ranges, allowing for the event throttle
+    void assertRangeEvents(const std::vector<std::pair<FwSizeType, FwSizeType>>& ranges);
+
+    //! Assert the drop range and summary events of a completed detection match the harness drops
+    void assertDropEvents(const DropHarness& harness);
+
     //! Connect ports
     void connectPorts();
 
     //! Initialize components
     void initComponents();
 
+    //! Handler for the clock port, returning the clock time then advancing it by the clock step
+    static void from_clock_static(Fw::PassiveComponentBase* const callComp, FwIndexType portNum, Fw::Time& time);
+
   private:
     // ----------------------------------------------------------------------
     // Member variables
     // ----------------------------------------------------------------------
 
+    //! Allocator of the scanner workers, declared first such that it outlives the component
+    Fw::MallocAllocator m_allocator;
+
     //! The component under test
     DropDetector component;
+
+    //! Time port advancing on each call, connected in place of the tester time port to model time passing
+    Fw::InputTimePort m_clock;
+
+    //! Time returned by the next call to the clock port
+    Fw::Time m_clockTime;
+
+    //! Microseconds the clock advances on each call
+    U32 m_clockStep;
 };
 
 }  // namespace Utilities
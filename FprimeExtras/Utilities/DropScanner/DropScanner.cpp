@@ -0,0 +1,727 @@
+// ======================================================================
+// \title  DropScanner.cpp
+// \author starchmd
+// \brief  cpp file for DropScanner packet scanning helper class
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#include "FprimeExtras/Utilities/DropScanner/DropScanner.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <new>
+
+#include "ExtrasConfig/DropDetectorConfig.hpp"
+#include "FprimeExtras/Utilities/FileHelper/Crc32.hpp"
+#include "FprimeExtras/Utilities/ZeroScan/ZeroScan.hpp"
+#include "Fw/Types/Assert.hpp"
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Utilities {
+
+static_assert((Utilities::DROP_DETECTOR_MANIFEST_BUFFER_SIZE >= sizeof(U32)) &&
+                  ((Utilities::DROP_DETECTOR_MANIFEST_BUFFER_SIZE % sizeof(U32)) == 0),
+              "Manifest buffer must hold a whole number of CRC32 entries");
+
+DropScanner::Worker ::Worker(DropScanner& scanner)
+    : m_scanner(scanner),
+      m_state(ShareState::IDLE),
+      m_busy(false),
+      m_share(0),
+      m_packetSize(0),
+      m_first(0),
+      m_count(0),
+      m_completed(0),
+      m_bytes(0),
+      m_stop(PacketStatus::GOOD),
+      m_fileStatus(Os::File::OP_OK) {}
+
+DropScanner ::DropScanner()
+    : m_mode(Mode::FILE_READ),
+      m_packetSize(0),
+      m_index(0),
+      m_bytesScanned(0),
+      m_descriptor(-1),
+      m_fileSize(0),
+      m_window(nullptr),
+      m_windowOffset(0),
+      m_windowSize(0),
+      m_holeDescriptor(-1),
+      m_holeFileSize(0),
+      m_holeStart(0),
+      m_holeEnd(0),
+      m_seekPending(false),
+      m_manifestEntries(0),
+      m_manifestFirst(0),
+      m_manifestCount(0),
+      m_workers(nullptr),
+      m_workerCount(0),
+      m_threads(0),
+      m_shareBase(0),
+      m_sharePackets(1),
+      m_stopping(false) {}
+
+DropScanner ::~DropScanner() {
+    this->cleanup();
+}
+
+FwSizeType DropScanner ::configure(FwSizeType threads, FwEnumStoreType identifier, Fw::MemAllocator& allocator) {
+    static_assert(alignof(Worker) <= alignof(std::max_align_t), "Allocated memory must be aligned for workers");
+    FW_ASSERT((threads > 0) && (threads <= Utilities::DROP_DETECTOR_PARALLEL_MAX_THREADS),
+              static_cast<FwAssertArgType>(threads));
+    FW_ASSERT(!this->isOpen());
+    FW_ASSERT(this->m_workers == nullptr);
+    if (!this->m_workerMemory.allocate(allocator, identifier, threads * sizeof(Worker))) {
+        return 0;
+    }
+    this->m_workers = reinterpret_cast<Worker*>(this->m_workerMemory.getData());
+    FwSizeType started = 0;
+    for (FwSizeType i = 0; i < threads; i++) {
+        (void)new (&this->m_workers[started]) Worker(*this);
+        Os::Task::Arguments arguments(Os::TaskString("DropScanWorker"), DropScanner::workerRoutine,
+                                      &this->m_workers[started]);
+        // Workers are started in order, such that the first m_workerCount workers are those to join
+        if (this->m_workers[started].m_task.start(arguments) == Os::Task::OP_OK) {
+            started++;
+        } else {
+            this->m_workers[started].~Worker();
+        }
+    }
+    this->m_workerCount = started;
+    if (started == 0) {
+        this->m_workers = nullptr;
+        this->m_workerMemory.release();
+    }
+    return started;
+}
+
+void DropScanner ::cleanup() {
+    this->close();
+    {
+        Os::ScopeLock lock(this->m_lock);
+        this->m_stopping = true;
+        this->m_changed.notifyAll();
+    }
+    for (FwSizeType i = 0; i < this->m_workerCount; i++) {
+        (void)this->m_workers[i].m_task.join();
+        this->m_workers[i].~Worker();
+    }
+    this->m_workers = nullptr;
+    this->m_workerCount = 0;
+    this->m_workerMemory.release();
+    this->m_stopping = false;
+}
+
+Os::File::Status DropScanner ::open(const CHAR* path, FwSizeType packetSize, Mode preferred, FwSizeType threads) {
+    FW_ASSERT(path != nullptr);
+    FW_ASSERT(packetSize > 0);
+    FW_ASSERT(threads > 0);
+    FW_ASSERT(!this->isOpen());
+    Os::File::Status status = this->m_file.open(path, Os::File::OPEN_READ);
+    if (status == Os::File::OP_OK) {
+        this->m_packetSize = packetSize;
+        this->m_index = 0;
+        this->m_bytesScanned = 0;
+        this->m_seekPending = false;
+        if ((preferred == Mode::PARALLEL_READ) && (this->m_workerCount > 0)) {
+            this->m_mode = Mode::PARALLEL_READ;
+            this->m_threads = FW_MIN(threads, this->m_workerCount);
+            this->m_sharePackets =
+                FW_MAX(1, FW_MIN(Utilities::DROP_DETECTOR_PARALLEL_MAX_PACKETS_PER_SHARE,
+                                 Utilities::DROP_DETECTOR_PARALLEL_BYTES_PER_SHARE / packetSize));
+            // Each worker reads through its own handle such that no file position is shared between threads
+            for (FwSizeType i = 0; (i < this->m_threads) && (status == Os::File::OP_OK); i++) {
+                status = this->m_workers[i].m_file.open(path, Os::File::OPEN_READ);
+            }
+            if (status != Os::File::OP_OK) {
+                this->close();
+            } else {
+                Os::ScopeLock lock(this->m_lock);
+                this->m_shareBase = 0;
+                this->assignShares();
+            }
+        } else {
+            // Mapping is best-effort, any failure falls back to reading through the already opened file
+            this->m_mode = ((preferred != Mode::FILE_READ) && this->mapFile(path)) ? Mode::MEMORY_MAP : Mode::FILE_READ;
+            this->openHoles(path);
+        }
+    }
+    return status;
+}
+
+Os::File::Status DropScanner ::openManifest(const CHAR* path) {
+    FW_ASSERT(path != nullptr);
+    FW_ASSERT(this->isOpen());
+    FW_ASSERT(this->m_mode != Mode::PARALLEL_READ);
+    FW_ASSERT(!this->m_manifest.isOpen());
+    Os::File::Status status = this->m_manifest.open(path, Os::File::OPEN_READ);
+    if (status == Os::File::OP_OK) {
+        FwSizeType size = 0;
+        status = this->m_manifest.size(size);
+        if (status != Os::File::OP_OK) {
+            this->m_manifest.close();
+            return status;
+        }
+        this->m_manifestEntries = size / sizeof(U32);
+        this->m_manifestFirst = 0;
+        this->m_manifestCount = 0;
+    }
+    return status;
+}
+
+void DropScanner ::close() {
+    this->unmapFile();
+    this->closeHoles();
+    this->m_manifest.close();
+    this->m_manifestEntries = 0;
+    this->m_manifestFirst = 0;
+    this->m_manifestCount = 0;
+    this->releaseShares();
+    for (FwSizeType i = 0; i < this->m_workerCount; i++) {
+        this->m_workers[i].m_file.close();
+    }
+    this->m_threads = 0;
+    this->m_file.close();
+    this->m_mode = Mode::FILE_READ;
+    this->m_index = 0;
+}
+
+bool DropScanner ::isOpen() const {
+    return this->m_file.isOpen();
+}
+
+DropScanner::Mode DropScanner ::getMode() const {
+    return this->m_mode;
+}
+
+FwSizeType DropScanner ::getIndex() const {
+    return this->m_index;
+}
+
+void DropScanner ::setIndex(FwSizeType index) {
+    FW_ASSERT(this->isOpen());
+    this->m_index = index;
+    // Reads continue from the new index in every mode and the next hole is located again from the new offset
+    this->m_seekPending = true;
+    this->m_holeStart = 0;
+    this->m_holeEnd = 0;
+    if (this->m_mode == Mode::PARALLEL_READ) {
+        Os::ScopeLock lock(this->m_lock);
+        this->m_shareBase = index;
+        this->assignShares();
+    }
+}
+
+FwSizeType DropScanner ::getBytesScanned() const {
+    return this->m_bytesScanned;
+}
+
+DropScanner::PacketStatus DropScanner ::readPacket(Os::File::Status& fileStatus) {
+    FW_ASSERT(this->isOpen());
+    FW_ASSERT(static_cast<FwSizeType>(std::numeric_limits<FwSignedSizeType>::max()) / this->m_packetSize > this->m_index);
+    PacketStatus status = PacketStatus::FILE_ERROR;
+    if (this->m_manifest.isOpen()) {
+        status = this->readPacketVerified(fileStatus);
+    }
+    // Packets entirely within a hole are all zeros and are not read
+    else if (this->isHolePacket()) {
+        fileStatus = Os::File::OP_OK;
+        status = PacketStatus::POSSIBLE_DROP;
+        this->m_seekPending = true;
+    } else {
+        switch (this->m_mode) {
+            case Mode::MEMORY_MAP:
+                status = this->readPacketMapped(fileStatus);
+                break;
+            case Mode::PARALLEL_READ:
+                status = this->readPacketParallel(fileStatus);
+                break;
+            default:
+                status = this->readPacketFile(fileStatus);
+                break;
+        }
+    }
+    if ((status == PacketStatus::GOOD) || (status == PacketStatus::POSSIBLE_DROP)) {
+        this->m_index += 1;
+    }
+    return status;
+}
+
+DropScanner::PacketStatus DropScanner ::readPacketFile(Os::File::Status& fileStatus) {
+    PacketStatus result = PacketStatus::POSSIBLE_DROP;
+    fileStatus = Os::File::OP_OK;
+    U8 buffer[Utilities::DROP_DETECTOR_FILE_READ_BUFFER_SIZE];
+    constexpr FwSizeType BOUND = std::numeric_limits<FwSizeType>::max() - Utilities::DROP_DETECTOR_FILE_READ_BUFFER_SIZE;
+
+    // Skipped hole packets leave the file position behind the current packet
+    if (this->m_seekPending) {
+        fileStatus = this->m_file.seek(static_cast<FwSignedSizeType>(this->m_index * this->m_packetSize),
+                                       Os::File::SeekType::ABSOLUTE);
+        if (fileStatus != Os::File::OP_OK) {
+            return PacketStatus::FILE_ERROR;
+        }
+        this->m_seekPending = false;
+    }
+
+    // Loop for enough chunks to cover the packet size
+    for (FwSizeType i = 0; i < this->m_packetSize && i < BOUND; i += Utilities::DROP_DETECTOR_FILE_READ_BUFFER_SIZE) {
+        FwSizeType to_read = FW_MIN(Utilities::DROP_DETECTOR_FILE_READ_BUFFER_SIZE, this->m_packetSize - i);
+        fileStatus = this->m_file.read(buffer, to_read);
+        if (fileStatus != Os::File::OP_OK) {
+            return PacketStatus::FILE_ERROR;
+        }
+        // Check for end of file, a short final packet that was all zeros up to the end of file is a possible drop
+        if (to_read == 0) {
+            return (i == 0) ? PacketStatus::FILE_EOF : PacketStatus::POSSIBLE_DROP;
+        }
+        this->m_bytesScanned += to_read;
+        // Check for any non-zero byte in the buffer, if it exists, this is not a drop.
+        if (!Utilities::ZeroScan::isZero(buffer, to_read)) {
+            // Skip the unread remainder of the packet such that the next read starts on the next packet boundary
+            if ((i + to_read) < this->m_packetSize) {
+                fileStatus = this->m_file.seek(static_cast<FwSignedSizeType>((this->m_index + 1) * this->m_packetSize),
+                                               Os::File::SeekType::ABSOLUTE);
+                if (fileStatus != Os::File::OP_OK) {
+                    return PacketStatus::FILE_ERROR;
+                }
+            }
+            return PacketStatus::GOOD;
+        }
+    }
+    return result;
+}
+
+DropScanner::PacketStatus DropScanner ::readPacketMapped(Os::File::Status& fileStatus) {
+    fileStatus = Os::File::OP_OK;
+    const FwSizeType start = this->m_index * this->m_packetSize;
+    if (start >= this->m_fileSize) {
+        return PacketStatus::FILE_EOF;
+    }
+    // The final packet may be short, only the bytes present in the file are checked
+    const FwSizeType end = start + FW_MIN(this->m_packetSize, this->m_fileSize - start);
+    for (FwSizeType offset = start; offset < end;) {
+        // Slide the window forward when the offset is not covered by the current window
+        if ((offset < this->m_windowOffset) || (offset >= (this->m_windowOffset + this->m_windowSize))) {
+            // Mapping failures fall back to reading, the current packet is read again from its start
+            if (!this->mapWindow(offset)) {
+                this->fallBackToRead();
+                return this->readPacketFile(fileStatus);
+            }
+        }
+        const FwSizeType available = FW_MIN(end, this->m_windowOffset + this->m_windowSize) - offset;
+        const FwSizeType non_zero =
+            Utilities::ZeroScan::findNonZero(this->m_window + (offset - this->m_windowOffset), available);
+        // The remainder of the packet is mapped whether or not it is inspected, so the whole packet is counted
+        if (non_zero != available) {
+            this->m_bytesScanned += end - offset;
+            return PacketStatus::GOOD;
+        }
+        this->m_bytesScanned += available;
+        offset += available;
+    }
+    return PacketStatus::POSSIBLE_DROP;
+}
+
+DropScanner::PacketStatus DropScanner ::readPacketVerified(Os::File::Status& fileStatus) {
+    const bool listed = this->m_index < this->m_manifestEntries;
+    U32 expected = 0;
+    if (listed) {
+        fileStatus = this->readManifestEntry(this->m_index, expected);
+        if (fileStatus != Os::File::OP_OK) {
+            return PacketStatus::FILE_ERROR;
+        }
+    }
+    U32 crc = 0;
+    FwSizeType size = 0;
+    fileStatus = (this->m_mode == Mode::MEMORY_MAP) ? this->crcPacketMapped(crc, size) : this->crcPacketFile(crc, size);
+    // Mapping failures fall back to reading, the current packet is read again from its start
+    if ((fileStatus != Os::File::OP_OK) && (this->m_mode == Mode::MEMORY_MAP)) {
+        this->fallBackToRead();
+        fileStatus = this->crcPacketFile(crc, size);
+    }
+    if (fileStatus != Os::File::OP_OK) {
+        return PacketStatus::FILE_ERROR;
+    }
+    // Packets listed in the manifest but missing from the end of the file were never received
+    if (size == 0) {
+        return listed ? PacketStatus::POSSIBLE_DROP : PacketStatus::FILE_EOF;
+    }
+    return (listed && (crc == expected)) ? PacketStatus::GOOD : PacketStatus::POSSIBLE_DROP;
+}
+
+Os::File::Status DropScanner ::crcPacketFile(U32& crc, FwSizeType& size) {
+    U8 buffer[Utilities::DROP_DETECTOR_FILE_READ_BUFFER_SIZE];
+    Os::File::Status status = Os::File::OP_OK;
+    crc = 0;
+    size = 0;
+    if (this->m_seekPending) {
+        status = this->m_file.seek(static_cast<FwSignedSizeType>(this->m_index * this->m_packetSize),
+                                   Os::File::SeekType::ABSOLUTE);
+        if (status != Os::File::OP_OK) {
+            return status;
+        }
+        this->m_seekPending = false;
+    }
+    while (size < this->m_packetSize) {
+        FwSizeType to_read = FW_MIN(sizeof(buffer), this->m_packetSize - size);
+        status = this->m_file.read(buffer, to_read);
+        if ((status != Os::File::OP_OK) || (to_read == 0)) {
+            break;
+        }
+        crc = Utilities::FileHelper::crc32(buffer, to_read, crc);
+        size += to_read;
+        this->m_bytesScanned += to_read;
+    }
+    return status;
+}
+
+Os::File::Status DropScanner ::crcPacketMapped(U32& crc, FwSizeType& size) {
+    crc = 0;
+    size = 0;
+    const FwSizeType start = this->m_index * this->m_packetSize;
+    if (start >= this->m_fileSize) {
+        return Os::File::OP_OK;
+    }
+    const FwSizeType end = start + FW_MIN(this->m_packetSize, this->m_fileSize - start);
+    for (FwSizeType offset = start; offset < end;) {
+        if ((offset < this->m_windowOffset) || (offset >= (this->m_windowOffset + this->m_windowSize))) {
+            if (!this->mapWindow(offset)) {
+                return Os::File::OTHER_ERROR;
+            }
+        }
+        const FwSizeType available = FW_MIN(end, this->m_windowOffset + this->m_windowSize) - offset;
+        crc = Utilities::FileHelper::crc32(this->m_window + (offset - this->m_windowOffset), available, crc);
+        this->m_bytesScanned += available;
+        offset += available;
+    }
+    size = end - start;
+    return Os::File::OP_OK;
+}
+
+Os::File::Status DropScanner ::readManifestEntry(FwSizeType index, U32& crc) {
+    FW_ASSERT(index < this->m_manifestEntries);
+    if ((index < this->m_manifestFirst) || (index >= (this->m_manifestFirst + this->m_manifestCount))) {
+        Os::File::Status status = this->m_manifest.seek(static_cast<FwSignedSizeType>(index * sizeof(U32)),
+                                                        Os::File::SeekType::ABSOLUTE);
+        if (status != Os::File::OP_OK) {
+            return status;
+        }
+        const FwSizeType expected =
+            FW_MIN(sizeof(this->m_manifestBuffer), (this->m_manifestEntries - index) * sizeof(U32));
+        FwSizeType to_read = expected;
+        status = this->m_manifest.read(this->m_manifestBuffer, to_read);
+        if (status != Os::File::OP_OK) {
+            return status;
+        }
+        // The manifest was truncated since it was opened
+        if (to_read != expected) {
+            return Os::File::BAD_SIZE;
+        }
+        this->m_manifestFirst = index;
+        this->m_manifestCount = to_read / sizeof(U32);
+    }
+    const U8* entry = this->m_manifestBuffer + ((index - this->m_manifestFirst) * sizeof(U32));
+    crc = (static_cast<U32>(entry[0]) << 24) | (static_cast<U32>(entry[1]) << 16) | (static_cast<U32>(entry[2]) << 8) |
+          static_cast<U32>(entry[3]);
+    return Os::File::OP_OK;
+}
+
+DropScanner::PacketStatus DropScanner ::readPacketParallel(Os::File::Status& fileStatus) {
+    fileStatus = Os::File::OP_OK;
+    // Shares are collected in order, so share s is always held by worker s modulo the workers in use
+    const FwSizeType share = (this->m_index - this->m_shareBase) / this->m_sharePackets;
+    const FwSizeType offset = (this->m_index - this->m_shareBase) % this->m_sharePackets;
+    Worker& worker = this->m_workers[share % this->m_threads];
+    Os::ScopeLock lock(this->m_lock);
+    FW_ASSERT(worker.m_share == share, static_cast<FwAssertArgType>(worker.m_share),
+              static_cast<FwAssertArgType>(share));
+    // The caller may be a rate group, so it is never held waiting on the worker
+    if (worker.m_state != ShareState::READY) {
+        return PacketStatus::NOT_READY;
+    }
+    // The share stopped before this packet, the stop is reported until the scanner is closed or moved
+    if (offset >= worker.m_completed) {
+        FW_ASSERT(worker.m_stop != PacketStatus::GOOD);
+        fileStatus = worker.m_fileStatus;
+        return worker.m_stop;
+    }
+    // Packets are charged as collected such that tick budgets apply however far the workers have read ahead
+    this->m_bytesScanned += FW_MIN(this->m_packetSize, worker.m_bytes - (offset * this->m_packetSize));
+    const PacketStatus status = (worker.m_drops[offset] != 0) ? PacketStatus::POSSIBLE_DROP : PacketStatus::GOOD;
+    // A fully collected share frees the worker to scan its next share
+    if ((offset + 1) == this->m_sharePackets) {
+        worker.m_share += this->m_threads;
+        worker.m_state = ShareState::ASSIGNED;
+        this->m_changed.notifyAll();
+    }
+    return status;
+}
+
+void DropScanner ::assignShares() {
+    for (FwSizeType i = 0; i < this->m_threads; i++) {
+        // Workers part way through a share rescan from their new share once the read in progress finishes
+        this->m_workers[i].m_share = i;
+        this->m_workers[i].m_state = ShareState::ASSIGNED;
+    }
+    this->m_changed.notifyAll();
+}
+
+void DropScanner ::releaseShares() {
+    Os::ScopeLock lock(this->m_lock);
+    for (FwSizeType i = 0; i < this->m_workerCount; i++) {
+        this->m_workers[i].m_state = ShareState::IDLE;
+    }
+    // Worker file handles may only be closed once no worker is reading through them
+    for (FwSizeType i = 0; i < this->m_workerCount; i++) {
+        while (this->m_workers[i].m_busy) {
+            this->m_changed.wait(this->m_lock);
+        }
+    }
+}
+
+void DropScanner ::scanShare(Worker& worker) {
+    worker.m_completed = 0;
+    worker.m_bytes = 0;
+    worker.m_stop = PacketStatus::GOOD;
+    worker.m_fileStatus = Os::File::OP_OK;
+    // No file extends beyond the largest seekable offset, shares starting past it are past the end of file
+    if (worker.m_first >= static_cast<FwSizeType>(std::numeric_limits<FwSignedSizeType>::max()) / worker.m_packetSize) {
+        worker.m_stop = PacketStatus::FILE_EOF;
+        return;
+    }
+    worker.m_fileStatus =
+        worker.m_file.seek(static_cast<FwSignedSizeType>(worker.m_first * worker.m_packetSize), Os::File::ABSOLUTE);
+    if (worker.m_fileStatus != Os::File::OP_OK) {
+        worker.m_stop = PacketStatus::FILE_ERROR;
+        return;
+    }
+    FwSizeType offset = 0;  // Offset into the current packet
+    bool drop = true;       // Current packet is all zeros so far
+    while (worker.m_completed < worker.m_count) {
+        // Reads stop at the end of the share
+        FwSizeType to_read = FW_MIN(sizeof(worker.m_buffer),
+                                    ((worker.m_count - worker.m_completed) * worker.m_packetSize) - offset);
+        worker.m_fileStatus = worker.m_file.read(worker.m_buffer, to_read);
+        if (worker.m_fileStatus != Os::File::OP_OK) {
+            worker.m_stop = PacketStatus::FILE_ERROR;
+            return;
+        }
+        // Check for end of file, a short final packet is reported before the end of file as in the other modes
+        if (to_read == 0) {
+            if (offset > 0) {
+                worker.m_drops[worker.m_completed] = drop ? 1 : 0;
+                worker.m_completed += 1;
+            }
+            worker.m_stop = PacketStatus::FILE_EOF;
+            return;
+        }
+        worker.m_bytes += to_read;
+        for (FwSizeType position = 0; position < to_read;) {
+            const FwSizeType available = FW_MIN(to_read - position, worker.m_packetSize - offset);
+            drop = drop && Utilities::ZeroScan::isZero(worker.m_buffer + position, available);
+            position += available;
+            offset += available;
+            if (offset == worker.m_packetSize) {
+                worker.m_drops[worker.m_completed] = drop ? 1 : 0;
+                worker.m_completed += 1;
+                offset = 0;
+                drop = true;
+            }
+        }
+    }
+}
+
+void DropScanner ::work(Worker& worker) {
+    this->m_lock.lock();
+    while (true) {
+        while ((worker.m_state != ShareState::ASSIGNED) && !this->m_stopping) {
+            this->m_changed.wait(this->m_lock);
+        }
+        if (this->m_stopping) {
+            break;
+        }
+        worker.m_state = ShareState::SCANNING;
+        worker.m_busy = true;
+        worker.m_packetSize = this->m_packetSize;
+        worker.m_first = this->m_shareBase + (worker.m_share * this->m_sharePackets);
+        worker.m_count = this->m_sharePackets;
+        // The lock is released while reading such that the caller only waits on the share it is collecting
+        this->m_lock.unLock();
+        DropScanner::scanShare(worker);
+        this->m_lock.lock();
+        worker.m_busy = false;
+        // Shares reassigned or released while scanning are discarded
+        if (worker.m_state == ShareState::SCANNING) {
+            worker.m_state = ShareState::READY;
+        }
+        this->m_changed.notifyAll();
+    }
+    this->m_lock.unLock();
+}
+
+void DropScanner ::workerRoutine(void* worker) {
+    FW_ASSERT(worker != nullptr);
+    Worker* const self = static_cast<Worker*>(worker);
+    self->m_scanner.work(*self);
+}
+
+bool DropScanner ::isHolePacket() {
+    if (this->m_holeDescriptor < 0) {
+        return false;
+    }
+    const FwSizeType start = this->m_index * this->m_packetSize;
+    // The end of file is reported by reading
+    if (start >= this->m_holeFileSize) {
+        return false;
+    }
+    // Locate the next hole once the previous one has been passed
+    if ((start >= this->m_holeEnd) && !this->findHole(start)) {
+        this->closeHoles();
+        return false;
+    }
+    const FwSizeType end = start + FW_MIN(this->m_packetSize, this->m_holeFileSize - start);
+    return (start >= this->m_holeStart) && (end <= this->m_holeEnd);
+}
+
+#if defined(__linux__) && defined(SEEK_HOLE) && defined(SEEK_DATA)
+void DropScanner ::openHoles(const CHAR* path) {
+    if (!Utilities::DROP_DETECTOR_HOLE_DETECTION) {
+        return;
+    }
+    this->m_holeDescriptor = ::open(path, O_RDONLY | O_CLOEXEC);
+    struct stat file_stat;
+    if ((this->m_holeDescriptor < 0) || (::fstat(this->m_holeDescriptor, &file_stat) != 0) ||
+        (file_stat.st_size <= 0)) {
+        this->closeHoles();
+        return;
+    }
+    this->m_holeFileSize = static_cast<FwSizeType>(file_stat.st_size);
+    this->m_holeStart = 0;
+    this->m_holeEnd = 0;
+}
+
+bool DropScanner ::findHole(FwSizeType offset) {
+    const off_t hole = ::lseek(this->m_holeDescriptor, static_cast<off_t>(offset), SEEK_HOLE);
+    if (hole < 0) {
+        return false;
+    }
+    // Every file ends in an implicit hole at its size, so no holes remain past the end of the file
+    if (static_cast<FwSizeType>(hole) >= this->m_holeFileSize) {
+        this->m_holeStart = std::numeric_limits<FwSizeType>::max();
+        this->m_holeEnd = std::numeric_limits<FwSizeType>::max();
+        return true;
+    }
+    // A hole without data after it extends to the end of the file
+    const off_t data = ::lseek(this->m_holeDescriptor, hole, SEEK_DATA);
+    this->m_holeStart = static_cast<FwSizeType>(hole);
+    this->m_holeEnd = (data < 0) ? this->m_holeFileSize : FW_MIN(static_cast<FwSizeType>(data), this->m_holeFileSize);
+    return true;
+}
+
+void DropScanner ::closeHoles() {
+    if (this->m_holeDescriptor >= 0) {
+        (void)::close(this->m_holeDescriptor);
+    }
+    this->m_holeDescriptor = -1;
+    this->m_holeFileSize = 0;
+    this->m_holeStart = 0;
+    this->m_holeEnd = 0;
+}
+#else
+void DropScanner ::openHoles(const CHAR* path) {
+    // Hole detection is only supported on Linux
+}
+
+bool DropScanner ::findHole(FwSizeType offset) {
+    return false;
+}
+
+void DropScanner ::closeHoles() {}
+#endif
+
+void DropScanner ::fallBackToRead() {
+    this->unmapFile();
+    this->m_mode = Mode::FILE_READ;
+    // Os::File reads have not advanced while mapped, the position must be set to the current packet
+    this->m_seekPending = true;
+}
+
+#if defined(__linux__)
+bool DropScanner ::mapFile(const CHAR* path) {
+    if (Utilities::DROP_DETECTOR_MAP_WINDOW_SIZE == 0) {
+        return false;
+    }
+    this->m_descriptor = ::open(path, O_RDONLY | O_CLOEXEC);
+    struct stat file_stat;
+    if ((this->m_descriptor < 0) || (::fstat(this->m_descriptor, &file_stat) != 0) || (file_stat.st_size <= 0)) {
+        this->unmapFile();
+        return false;
+    }
+    this->m_fileSize = static_cast<FwSizeType>(file_stat.st_size);
+    // Map the first window such that mapping failures fall back before any packet is scanned
+    if (!this->mapWindow(0)) {
+        this->unmapFile();
+        return false;
+    }
+    return true;
+}
+
+bool DropScanner ::mapWindow(FwSizeType offset) {
+    const FwSizeType page_size = static_cast<FwSizeType>(::sysconf(_SC_PAGESIZE));
+    const FwSizeType window_size =
+        FW_MAX(page_size, Utilities::DROP_DETECTOR_MAP_WINDOW_SIZE - (Utilities::DROP_DETECTOR_MAP_WINDOW_SIZE % page_size));
+    FW_ASSERT(offset < this->m_fileSize);
+
+    if (this->m_window != nullptr) {
+        (void)::munmap(this->m_window, this->m_windowSize);
+        this->m_window = nullptr;
+        this->m_windowSize = 0;
+    }
+    // Mappings must start on a page boundary
+    const FwSizeType window_offset = offset - (offset % page_size);
+    const FwSizeType length = FW_MIN(window_size, this->m_fileSize - window_offset);
+    void* mapped =
+        ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, this->m_descriptor, static_cast<off_t>(window_offset));
+    if (mapped == MAP_FAILED) {
+        return false;
+    }
+    // Packets are scanned front-to-back, hint the kernel to read ahead aggressively
+    (void)::madvise(mapped, length, MADV_SEQUENTIAL);
+    this->m_window = static_cast<U8*>(mapped);
+    this->m_windowOffset = window_offset;
+    this->m_windowSize = length;
+    return true;
+}
+
+void DropScanner ::unmapFile() {
+    if (this->m_window != nullptr) {
+        (void)::munmap(this->m_window, this->m_windowSize);
+    }
+    if (this->m_descriptor >= 0) {
+        (void)::close(this->m_descriptor);
+    }
+    this->m_descriptor = -1;
+    this->m_fileSize = 0;
+    this->m_window = nullptr;
+    this->m_windowOffset = 0;
+    this->m_windowSize = 0;
+}
+#else
+bool DropScanner ::mapFile(const CHAR* path) {
+    // Memory-mapped scanning is only supported on Linux
+    return false;
+}
+
+bool DropScanner ::mapWindow(FwSizeType offset) {
+    return false;
+}
+
+void DropScanner ::unmapFile() {}
+#endif
+
+}  // namespace Utilities
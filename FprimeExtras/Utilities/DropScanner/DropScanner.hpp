@@ -0,0 +1,295 @@
+// ======================================================================
+// \title  DropScanner.hpp
+// \author starchmd
+// \brief  hpp file for DropScanner packet scanning helper class
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#ifndef FprimeExtras_Utilities_DropScanner_HPP
+#define FprimeExtras_Utilities_DropScanner_HPP
+
+#include "ExtrasConfig/DropDetectorConfig.hpp"
+#include "FprimeExtras/Utilities/FileHelper/AllocatedBuffer.hpp"
+#include "Fw/FPrimeBasicTypes.hpp"
+#include "Fw/Types/MemAllocator.hpp"
+#include "Os/Condition.hpp"
+#include "Os/File.hpp"
+#include "Os/Mutex.hpp"
+#include "Os/Task.hpp"
+
+namespace Utilities {
+
+//! \brief scans a file one fixed-size packet at a time looking for packets of all zeros
+//!
+//! The scanner reads packets in order starting at packet zero. On Linux the file is scanned in-place through a sliding
+//! memory-mapped window of DROP_DETECTOR_MAP_WINDOW_SIZE bytes, avoiding a copy of every byte into a read buffer.
+//! When mapping is disabled, unsupported, or fails, the scanner falls back to Os::File reads into a stack buffer of
+//! DROP_DETECTOR_FILE_READ_BUFFER_SIZE bytes. Once a read finds a non-zero byte, the scanner seeks to the next packet
+//! boundary such that the remainder of the packet is never read.
+//!
+//! On Linux, packets lying entirely within a hole of a sparse file are reported as possible drops without being read
+//! in the FILE_READ and MEMORY_MAP modes. Holes are located with SEEK_HOLE/SEEK_DATA, costing two calls per hole.
+//!
+//! In parallel mode, the file is split into packet-aligned shares of DROP_DETECTOR_PARALLEL_BYTES_PER_SHARE bytes
+//! scanned by worker tasks, each reading through its own file handle such that no file position is shared. Workers
+//! are allocated and started once by configure and scan ahead of the caller by one share each, taking the next share
+//! as the caller finishes collecting the previous one. The caller only collects results packet by packet in index
+//! order exactly as in the other modes. It never waits on the workers: a packet whose share has not been scanned yet
+//! is reported as NOT_READY, and the caller retries it later.
+//!
+//! With a manifest of per-packet CRC32 values open, the scanner verifies each packet against its manifest entry rather
+//! than checking it for zeros. Every byte of each packet is read, in-place when memory-mapped.
+//!
+//! \warning in memory-mapped mode, truncating the file while it is being scanned results in a SIGBUS.
+class DropScanner {
+  public:
+    //! \brief Packet status enumeration for read packet function
+    enum PacketStatus {
+        GOOD,           //!< No drop detected
+        POSSIBLE_DROP,  //!< Possible drop detected (all zeros)
+        FILE_ERROR,     //!< File read error occurred, check i/o parameter
+        FILE_EOF,       //!< End of file reached
+        NOT_READY       //!< Packet not yet scanned by the PARALLEL_READ workers, read it again later
+    };
+
+    //! \brief method used to access file data
+    enum Mode {
+        FILE_READ,      //!< Copy data through Os::File reads
+        MEMORY_MAP,     //!< Inspect data in-place through a memory-mapped window
+        PARALLEL_READ,  //!< Copy data through Os::File reads on multiple threads
+    };
+
+    //! Construct a closed scanner
+    DropScanner();
+
+    //! Destroy the scanner, closing any open file and stopping any workers
+    ~DropScanner();
+
+    //! \brief allocate and start the workers used in PARALLEL_READ mode
+    //!
+    //! Allocates threads workers, each holding a read buffer of DROP_DETECTOR_PARALLEL_READ_BUFFER_SIZE bytes, from
+    //! allocator and starts a task for each. The tasks wait for shares while no file is open in PARALLEL_READ mode.
+    //! Scanners never configured hold no worker memory. The allocator must outlive the scanner, or cleanup must be
+    //! called first.
+    //!
+    //! \warning It is invalid to configure a scanner that is open or already configured, or to supply a thread count
+    //!          of zero or greater than DROP_DETECTOR_PARALLEL_MAX_THREADS and results in an assertion failure.
+    //!
+    //! \param threads number of workers to start
+    //! \param identifier identifier passed to the allocator
+    //! \param allocator allocator of the worker memory
+    //! \return number of workers started, 0 when the allocation fails
+    FwSizeType configure(FwSizeType threads, FwEnumStoreType identifier, Fw::MemAllocator& allocator);
+
+    //! \brief stop the workers and return their memory to the allocator, if configured
+    //!
+    //! Closes any open file first.
+    void cleanup();
+
+    //! \brief open a file for scanning
+    //!
+    //! Opens the file and prepares to scan from packet zero. When preferred is MEMORY_MAP, the file is mapped if
+    //! possible and otherwise read through Os::File. When preferred is PARALLEL_READ, the file is scanned by threads
+    //! workers, limited to the workers started by configure. Without configured workers, PARALLEL_READ is treated as
+    //! MEMORY_MAP.
+    //!
+    //! \warning It is invalid to open a scanner that is already open, to supply a null path, or to supply a zero
+    //!          packet size or thread count and results in an assertion failure.
+    //!
+    //! \param path path of the file to scan
+    //! \param packetSize size of each packet in bytes
+    //! \param preferred preferred access mode
+    //! \param threads number of threads used in PARALLEL_READ mode, ignored otherwise
+    //! \return status of opening the file
+    Os::File::Status open(const CHAR* path,
+                          FwSizeType packetSize,
+                          Mode preferred = Mode::MEMORY_MAP,
+                          FwSizeType threads = 1);
+
+    //! \brief verify packets against a manifest of CRC32 values instead of checking them for zeros
+    //!
+    //! The manifest holds one big-endian CRC32, as computed by FileHelper::crc32, for each packet in index order. The
+    //! CRC of a short final packet covers only its bytes. Once the manifest is open, readPacket reports a packet as a
+    //! POSSIBLE_DROP when its CRC does not match its manifest entry or when it has no manifest entry. Packets listed in
+    //! the manifest but missing from the end of the file are also reported as POSSIBLE_DROP before FILE_EOF. Holes are
+    //! not used to skip packets as a hole need not be a drop when verifying. The manifest is closed with the scanner.
+    //!
+    //! \warning It is invalid to open a manifest on a scanner that is not open, that is in PARALLEL_READ mode, or that
+    //!          already has a manifest open, or to supply a null path and results in an assertion failure.
+    //!
+    //! \param path path of the manifest file
+    //! \return status of opening the manifest
+    Os::File::Status openManifest(const CHAR* path);
+
+    //! \brief close the file being scanned, if any
+    void close();
+
+    //! \brief check if a file is open for scanning
+    bool isOpen() const;
+
+    //! \brief get the access mode in use for the open file
+    Mode getMode() const;
+
+    //! \brief get the zero-based index of the next packet to be read
+    FwSizeType getIndex() const;
+
+    //! \brief continue scanning from the packet at index
+    //!
+    //! The next call to readPacket reads the packet at index. Packets before index are never read, such that a scan
+    //! resumed from a previous detection costs time proportional to the remaining data. Indices at or past the end of
+    //! the file are permitted and result in FILE_EOF.
+    //!
+    //! \warning It is invalid to call this function on a scanner that is not open and results in an assertion failure.
+    //!
+    //! \param index zero-based index of the next packet to read
+    void setIndex(FwSizeType index);
+
+    //! \brief get the number of bytes inspected since the file was opened
+    //!
+    //! Bytes read from the file or mapped for a packet are counted. In FILE_READ mode a packet costs the reads up to
+    //! its first non-zero byte, in MEMORY_MAP mode a packet costs its full size. Packets within sparse file holes are
+    //! not read and cost nothing. In PARALLEL_READ mode a packet costs its full size as it is collected, although the
+    //! workers read ahead of the caller by up to a share each.
+    FwSizeType getBytesScanned() const;
+
+    //! \brief read the next packet from the file and determine if it is a drop
+    //!
+    //! A short final packet is checked up to the end of the file. When it is all zeros it is a POSSIBLE_DROP in every
+    //! mode, and FILE_EOF follows it.
+    //!
+    //! In PARALLEL_READ mode, returns NOT_READY without advancing when the worker scanning the packet has not yet
+    //! finished its share.
+    //!
+    //! \warning It is invalid to call this function on a scanner that is not open and results in an assertion failure.
+    //!
+    //! \param fileStatus set to the status of the underlying read
+    //! \return status of the packet
+    PacketStatus readPacket(Os::File::Status& fileStatus);
+
+  private:
+    //! \brief state of a worker's share
+    enum ShareState {
+        IDLE,      //!< No share is assigned
+        ASSIGNED,  //!< m_share is assigned and awaits the worker
+        SCANNING,  //!< m_share is being scanned
+        READY,     //!< m_share was scanned and its results await collection
+    };
+
+    //! \brief a worker task and the share it scans in parallel mode
+    struct Worker {
+        explicit Worker(DropScanner& scanner);
+
+        DropScanner& m_scanner;         //!< Scanner owning this worker
+        Os::Task m_task;                //!< Task scanning this worker's shares
+        Os::File m_file;                //!< File handle private to this worker
+        ShareState m_state;             //!< State of m_share, guarded by the scanner lock
+        bool m_busy;                    //!< The task is reading outside the lock, guarded by the scanner lock
+        FwSizeType m_share;             //!< Share assigned, counted from the scanner's m_shareBase
+        FwSizeType m_packetSize;        //!< Size of each packet
+        FwSizeType m_first;             //!< Index of the first packet of the share being scanned
+        FwSizeType m_count;             //!< Number of packets in the share being scanned
+        FwSizeType m_completed;         //!< Packets scanned before stopping
+        FwSizeType m_bytes;             //!< Bytes read for the share
+        PacketStatus m_stop;            //!< GOOD when the share was completed, else the reason for stopping
+        Os::File::Status m_fileStatus;  //!< Status of the read that stopped the share
+        U8 m_drops[Utilities::DROP_DETECTOR_PARALLEL_MAX_PACKETS_PER_SHARE];  //!< Per-packet drop flags of the share
+        U8 m_buffer[Utilities::DROP_DETECTOR_PARALLEL_READ_BUFFER_SIZE];      //!< Read buffer
+    };
+
+    //! \brief read the next packet through Os::File
+    PacketStatus readPacketFile(Os::File::Status& fileStatus);
+
+    //! \brief inspect the next packet in the memory-mapped window
+    PacketStatus readPacketMapped(Os::File::Status& fileStatus);
+
+    //! \brief verify the next packet against its manifest entry
+    PacketStatus readPacketVerified(Os::File::Status& fileStatus);
+
+    //! \brief compute the CRC of the next packet through Os::File, setting size to the bytes present in the file
+    Os::File::Status crcPacketFile(U32& crc, FwSizeType& size);
+
+    //! \brief compute the CRC of the next packet in the memory-mapped window, setting size to the bytes present
+    Os::File::Status crcPacketMapped(U32& crc, FwSizeType& size);
+
+    //! \brief read the manifest entry of the packet at index, refilling the manifest buffer as needed
+    Os::File::Status readManifestEntry(FwSizeType index, U32& crc);
+
+    //! \brief collect the next packet from the worker scanning it, passing the worker its next share when collected
+    PacketStatus readPacketParallel(Os::File::Status& fileStatus);
+
+    //! \brief assign the first shares from m_shareBase to the workers in use, restarting any scan in progress
+    void assignShares();
+
+    //! \brief release every worker from its share, waiting for reads in progress to finish
+    void releaseShares();
+
+    //! \brief scan a worker's share
+    static void scanShare(Worker& worker);
+
+    //! \brief scan the shares assigned to worker until the workers are stopped
+    void work(Worker& worker);
+
+    //! \brief task entry point working as the Worker passed as the argument
+    static void workerRoutine(void* worker);
+
+    //! \brief open a descriptor on path used to locate holes, leaving hole detection disabled on failure
+    void openHoles(const CHAR* path);
+
+    //! \brief check if the next packet lies entirely within a hole, disabling hole detection on error
+    bool isHolePacket();
+
+    //! \brief locate the first hole ending after offset, returning false on error
+    bool findHole(FwSizeType offset);
+
+    //! \brief close the descriptor used to locate holes
+    void closeHoles();
+
+    //! \brief attempt to map the file at path, returning true on success
+    bool mapFile(const CHAR* path);
+
+    //! \brief map the window containing offset, returning true on success
+    bool mapWindow(FwSizeType offset);
+
+    //! \brief unmap the current window and close the mapped file
+    void unmapFile();
+
+    //! \brief stop memory mapping after a mapping failure, reading through Os::File from the current packet onward
+    void fallBackToRead();
+
+    Os::File m_file;            //!< File used for reads and as the open indicator
+    Mode m_mode;                //!< Access mode of the open file
+    FwSizeType m_packetSize;    //!< Size of each packet
+    FwSizeType m_index;         //!< Zero-based index of the next packet
+    FwSizeType m_bytesScanned;  //!< Bytes inspected since open
+
+    int m_descriptor;           //!< Descriptor of the mapped file, -1 when not mapped
+    FwSizeType m_fileSize;      //!< Size of the mapped file
+    U8* m_window;               //!< Start of the mapped window, nullptr when not mapped
+    FwSizeType m_windowOffset;  //!< File offset of the mapped window
+    FwSizeType m_windowSize;    //!< Size of the mapped window
+
+    int m_holeDescriptor;       //!< Descriptor used to locate holes, -1 when hole detection is disabled
+    FwSizeType m_holeFileSize;  //!< Size of the file when opened
+    FwSizeType m_holeStart;     //!< File offset of the start of the next hole
+    FwSizeType m_holeEnd;       //!< File offset of the end of the next hole
+    bool m_seekPending;         //!< The file position must be set to the current packet before reading
+
+    Os::File m_manifest;           //!< Manifest of packet CRCs, open when verifying
+    FwSizeType m_manifestEntries;  //!< Number of CRCs in the manifest
+    FwSizeType m_manifestFirst;    //!< Index of the packet of the first CRC in m_manifestBuffer
+    FwSizeType m_manifestCount;    //!< Number of CRCs in m_manifestBuffer
+    U8 m_manifestBuffer[Utilities::DROP_DETECTOR_MANIFEST_BUFFER_SIZE];  //!< Buffered manifest entries
+
+    FileHelper::AllocatedBuffer m_workerMemory;  //!< Memory holding the workers, none until configured
+    Worker* m_workers;                           //!< Workers started by configure, nullptr until configured
+    FwSizeType m_workerCount;                    //!< Number of workers started by configure
+    FwSizeType m_threads;                        //!< Number of workers used for the open file
+    FwSizeType m_shareBase;                      //!< Index of the first packet of share zero
+    FwSizeType m_sharePackets;                   //!< Number of packets in each share
+    bool m_stopping;                             //!< The workers are exiting, guarded by m_lock
+    Os::Mutex m_lock;                            //!< Guards the worker share states
+    Os::ConditionVariable m_changed;             //!< Signaled on a share assigned or scanned, or on stopping
+};
+
+}  // namespace Utilities
+
+#endif  // FprimeExtras_Utilities_DropScanner_HPP
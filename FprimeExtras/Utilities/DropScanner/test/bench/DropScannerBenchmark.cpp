@@ -0,0 +1,124 @@
+// ======================================================================
+// \title  DropScannerBenchmark.cpp
+// \author starchmd
+// \brief  cpp file for DropScanner mode and thread scaling benchmark
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+//
+// Measures the throughput of scanning a file in each DropScanner mode, and in PARALLEL_READ mode for each thread count
+// up to DROP_DETECTOR_PARALLEL_MAX_THREADS. The file is entirely zero such that every byte must be inspected, which is
+// the worst case for drop detection. A warm-up scan runs first such that all measurements read from the page cache;
+// drop the page cache between runs externally to measure cold reads. Usage:
+//
+//     DropScannerBenchmark [total_megabytes] [packet_size]
+//
+// Results are printed one line per (mode, threads) as: mode threads bytes_per_second speedup
+//
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "ExtrasConfig/DropDetectorConfig.hpp"
+#include "FprimeExtras/Utilities/DropScanner/DropScanner.hpp"
+#include "Fw/Types/MallocAllocator.hpp"
+#include "Os/FileSystem.hpp"
+
+namespace {
+
+//! Default size of the scanned file
+constexpr FwSizeType DEFAULT_TOTAL_MEGABYTES = 256;
+
+//! Default packet size, a typical file uplink packet data size
+constexpr FwSizeType DEFAULT_PACKET_SIZE = 1024;
+
+//! Path of the scanned file
+const CHAR* const BENCHMARK_FILEPATH = "drop_scanner_benchmark.bin";
+
+const char* modeName(Utilities::DropScanner::Mode mode) {
+    switch (mode) {
+        case Utilities::DropScanner::Mode::FILE_READ:
+            return "file_read";
+        case Utilities::DropScanner::Mode::MEMORY_MAP:
+            return "memory_map";
+        case Utilities::DropScanner::Mode::PARALLEL_READ:
+            return "parallel_read";
+        default:
+            return "unknown";
+    }
+}
+
+//! \brief write a file of total zero bytes, returning true on success
+bool writeFile(FwSizeType total) {
+    std::vector<U8> block(1024 * 1024, 0);
+    Os::File file;
+    if (file.open(BENCHMARK_FILEPATH, Os::File::OPEN_CREATE, Os::File::OVERWRITE) != Os::File::OP_OK) {
+        return false;
+    }
+    for (FwSizeType written = 0; written < total; written += block.size()) {
+        FwSizeType size = FW_MIN(static_cast<FwSizeType>(block.size()), total - written);
+        if (file.write(block.data(), size) != Os::File::OP_OK) {
+            return false;
+        }
+    }
+    file.close();
+    return true;
+}
+
+//! \brief scan the file, returning bytes/second or a negative value on error
+double measure(Utilities::DropScanner::Mode mode, FwSizeType threads, FwSizeType packetSize, FwSizeType total) {
+    Fw::MallocAllocator allocator;
+    Utilities::DropScanner scanner;
+    // Workers are started once, outside of the measurement
+    if ((mode == Utilities::DropScanner::Mode::PARALLEL_READ) &&
+        (scanner.configure(threads, 0, allocator) != threads)) {
+        return -1.0;
+    }
+    auto start = std::chrono::steady_clock::now();
+    if (scanner.open(BENCHMARK_FILEPATH, packetSize, mode, threads) != Os::File::OP_OK) {
+        return -1.0;
+    }
+    Os::File::Status file_status = Os::File::OP_OK;
+    Utilities::DropScanner::PacketStatus status = Utilities::DropScanner::PacketStatus::GOOD;
+    while ((status == Utilities::DropScanner::PacketStatus::GOOD) ||
+           (status == Utilities::DropScanner::PacketStatus::POSSIBLE_DROP)) {
+        status = scanner.readPacket(file_status);
+    }
+    scanner.close();
+    auto stop = std::chrono::steady_clock::now();
+    scanner.cleanup();
+    if (status != Utilities::DropScanner::PacketStatus::FILE_EOF) {
+        return -1.0;
+    }
+    const double seconds = std::chrono::duration<double>(stop - start).count();
+    return static_cast<double>(total) / seconds;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const FwSizeType total_megabytes = (argc > 1) ? static_cast<FwSizeType>(::strtoull(argv[1], nullptr, 10))
+                                                  : DEFAULT_TOTAL_MEGABYTES;
+    const FwSizeType packet_size =
+        (argc > 2) ? static_cast<FwSizeType>(::strtoull(argv[2], nullptr, 10)) : DEFAULT_PACKET_SIZE;
+    const FwSizeType total = total_megabytes * 1024 * 1024;
+    if ((total == 0) || (packet_size == 0) || !writeFile(total)) {
+        (void)::fprintf(stderr, "Failed to set up benchmark file\n");
+        return 1;
+    }
+    (void)measure(Utilities::DropScanner::Mode::FILE_READ, 1, packet_size, total);
+
+    const double baseline = measure(Utilities::DropScanner::Mode::FILE_READ, 1, packet_size, total);
+    (void)::printf("# file: %" PRI_FwSizeType " MiB, packet size: %" PRI_FwSizeType "\n", total_megabytes, packet_size);
+    (void)::printf("# mode threads bytes_per_second speedup\n");
+    (void)::printf("%s 1 %.0f 1.00\n", modeName(Utilities::DropScanner::Mode::FILE_READ), baseline);
+    const double mapped = measure(Utilities::DropScanner::Mode::MEMORY_MAP, 1, packet_size, total);
+    (void)::printf("%s 1 %.0f %.2f\n", modeName(Utilities::DropScanner::Mode::MEMORY_MAP), mapped, mapped / baseline);
+    for (FwSizeType threads = 1; threads <= Utilities::DROP_DETECTOR_PARALLEL_MAX_THREADS; threads++) {
+        const double parallel = measure(Utilities::DropScanner::Mode::PARALLEL_READ, threads, packet_size, total);
+        (void)::printf("%s %" PRI_FwSizeType " %.0f %.2f\n", modeName(Utilities::DropScanner::Mode::PARALLEL_READ),
+                       threads, parallel, parallel / baseline);
+    }
+    (void)Os::FileSystem::removeFile(BENCHMARK_FILEPATH);
+    return 0;
+}
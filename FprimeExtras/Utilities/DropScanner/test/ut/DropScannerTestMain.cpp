@@ -0,0 +1,410 @@
+// ======================================================================
+// \title  DropScannerTestMain.cpp
+// \author starchmd
+// \brief  cpp file for DropScanner unit tests
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "ExtrasConfig/DropDetectorConfig.hpp"
+#include "FprimeExtras/Utilities/DropScanner/DropScanner.hpp"
+#include "FprimeExtras/Utilities/FileHelper/Crc32.hpp"
+#include "FprimeExtras/Utilities/FileHelper/FileHelper.hpp"
+#include "Fw/Types/MallocAllocator.hpp"
+#include "Os/FileSystem.hpp"
+#include "Os/Task.hpp"
+#include "STest/Pick/Pick.hpp"
+#include "STest/Random/Random.hpp"
+
+#if defined(__linux__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+const CHAR* TEST_FILEPATH = "test_scanner_file.bin";
+const CHAR* TEST_MANIFEST_FILEPATH = "test_scanner_manifest.bin";
+Fw::MallocAllocator TEST_ALLOCATOR;
+
+//! \brief write a test file of non-zero packets with random drops, returning the zero-based drop indices
+std::vector<FwSizeType> writeTestFile(FwSizeType packetSize, FwSizeType packets, FwSizeType finalSize) {
+    std::vector<FwSizeType> drops;
+    std::vector<U8> packet(packetSize);
+    Os::File file;
+    EXPECT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_CREATE, Os::File::OVERWRITE), Os::File::OP_OK);
+    for (FwSizeType i = 0; i < packets; i++) {
+        const bool drop = STest::Pick::lowerUpper(0, 9) == 0;
+        for (FwSizeType j = 0; j < packetSize; j++) {
+            packet[j] = drop ? 0 : static_cast<U8>(STest::Pick::lowerUpper(0, 255));
+        }
+        // Keep non-drop packets from being all zeros by chance
+        if (!drop) {
+            packet[STest::Pick::lowerUpper(0, static_cast<U32>(packetSize - 1))] = 0xFF;
+        } else {
+            drops.push_back(i);
+        }
+        FwSizeType size = (i == (packets - 1)) ? finalSize : packetSize;
+        EXPECT_EQ(file.write(packet.data(), size), Os::File::OP_OK);
+    }
+    file.close();
+    return drops;
+}
+
+//! \brief read the next packet, retrying while the parallel workers have not yet scanned it
+Utilities::DropScanner::PacketStatus readPacketReady(Utilities::DropScanner& scanner, Os::File::Status& fileStatus) {
+    const FwSizeType index = scanner.getIndex();
+    Utilities::DropScanner::PacketStatus status = scanner.readPacket(fileStatus);
+    while (status == Utilities::DropScanner::PacketStatus::NOT_READY) {
+        // A packet that is not ready is left to be read again
+        EXPECT_EQ(scanner.getIndex(), index);
+        Os::Task::delay(Fw::TimeInterval(0, 100));
+        status = scanner.readPacket(fileStatus);
+    }
+    return status;
+}
+
+//! \brief scan the test file in the given mode and return the zero-based drop indices
+std::vector<FwSizeType> scanTestFile(FwSizeType packetSize, Utilities::DropScanner::Mode mode, FwSizeType threads) {
+    std::vector<FwSizeType> drops;
+    Utilities::DropScanner scanner;
+    if (mode == Utilities::DropScanner::Mode::PARALLEL_READ) {
+        EXPECT_EQ(scanner.configure(threads, 0, TEST_ALLOCATOR), threads);
+    }
+    EXPECT_EQ(scanner.open(TEST_FILEPATH, packetSize, mode, threads), Os::File::OP_OK);
+    if (mode == Utilities::DropScanner::Mode::PARALLEL_READ) {
+        EXPECT_EQ(scanner.getMode(), mode);
+    }
+    Utilities::DropScanner::PacketStatus status = Utilities::DropScanner::PacketStatus::GOOD;
+    while (status != Utilities::DropScanner::PacketStatus::FILE_EOF) {
+        const FwSizeType index = scanner.getIndex();
+        Os::File::Status file_status = Os::File::OP_OK;
+        status = readPacketReady(scanner, file_status);
+        EXPECT_EQ(file_status, Os::File::OP_OK);
+        EXPECT_NE(status, Utilities::DropScanner::PacketStatus::FILE_ERROR);
+        if (status == Utilities::DropScanner::PacketStatus::POSSIBLE_DROP) {
+            drops.push_back(index);
+        }
+    }
+    // The end of file is reported until the scanner is closed
+    Os::File::Status file_status = Os::File::OP_OK;
+    EXPECT_EQ(readPacketReady(scanner, file_status), Utilities::DropScanner::PacketStatus::FILE_EOF);
+    // Parallel reads inspect every byte, charged as each packet is collected
+    if (mode == Utilities::DropScanner::Mode::PARALLEL_READ) {
+        FwSizeType size = 0;
+        EXPECT_EQ(Os::FileSystem::getFileSize(TEST_FILEPATH, size), Os::FileSystem::OP_OK);
+        EXPECT_EQ(scanner.getBytesScanned(), size);
+    }
+    scanner.close();
+    EXPECT_FALSE(scanner.isOpen());
+    return drops;
+}
+
+//! \brief run a randomized scan in the given mode with packets no larger than maxPacketSize
+void testScan(Utilities::DropScanner::Mode mode, FwSizeType maxPacketSize, FwSizeType maxPackets = 2000) {
+    for (FwSizeType i = 0; i < 10; i++) {
+        const FwSizeType packet_size = STest::Pick::lowerUpper(1, static_cast<U32>(maxPacketSize));
+        const FwSizeType packets = STest::Pick::lowerUpper(1, static_cast<U32>(maxPackets));
+        const FwSizeType final_size = STest::Pick::lowerUpper(1, static_cast<U32>(packet_size));
+        const FwSizeType threads = STest::Pick::lowerUpper(1, Utilities::DROP_DETECTOR_PARALLEL_MAX_THREADS);
+        std::vector<FwSizeType> expected = writeTestFile(packet_size, packets, final_size);
+        ASSERT_EQ(scanTestFile(packet_size, mode, threads), expected);
+    }
+}
+
+TEST(DropScannerTest, FileReadMode) {
+    // Packets larger than the read buffer must stay aligned after a good packet is found in an early chunk
+    testScan(Utilities::DropScanner::Mode::FILE_READ, 4 * Utilities::DROP_DETECTOR_FILE_READ_BUFFER_SIZE);
+}
+
+TEST(DropScannerTest, FileReadSkipsRemainder) {
+    // Packets with data in their first chunk are only read up to the end of that chunk
+    const FwSizeType packet_size = 4 * Utilities::DROP_DETECTOR_FILE_READ_BUFFER_SIZE;
+    const FwSizeType packets = 100;
+    std::vector<U8> packet(packet_size, 0);
+    packet[0] = 0xFF;
+    Os::File file;
+    ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_CREATE, Os::File::OVERWRITE), Os::File::OP_OK);
+    for (FwSizeType i = 0; i < packets; i++) {
+        FwSizeType size = packet_size;
+        ASSERT_EQ(file.write(packet.data(), size), Os::File::OP_OK);
+    }
+    file.close();
+
+    Utilities::DropScanner scanner;
+    ASSERT_EQ(scanner.open(TEST_FILEPATH, packet_size, Utilities::DropScanner::Mode::FILE_READ), Os::File::OP_OK);
+    Os::File::Status file_status = Os::File::OP_OK;
+    for (FwSizeType i = 0; i < packets; i++) {
+        ASSERT_EQ(scanner.readPacket(file_status), Utilities::DropScanner::PacketStatus::GOOD);
+        ASSERT_EQ(file_status, Os::File::OP_OK);
+    }
+    ASSERT_EQ(scanner.readPacket(file_status), Utilities::DropScanner::PacketStatus::FILE_EOF);
+    ASSERT_EQ(scanner.getIndex(), packets);
+    ASSERT_EQ(scanner.getBytesScanned(), packets * Utilities::DROP_DETECTOR_FILE_READ_BUFFER_SIZE);
+}
+
+TEST(DropScannerTest, ShortFinalDrop) {
+    // A short final packet of zeros spanning several read chunks is a possible drop in every mode, not the end of file
+    const FwSizeType packet_size = 4 * Utilities::DROP_DETECTOR_FILE_READ_BUFFER_SIZE;
+    std::vector<U8> packet(packet_size, 0xFF);
+    Os::File file;
+    ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_CREATE, Os::File::OVERWRITE), Os::File::OP_OK);
+    FwSizeType size = packet_size;
+    ASSERT_EQ(file.write(packet.data(), size), Os::File::OP_OK);
+    std::fill(packet.begin(), packet.end(), 0);
+    size = Utilities::DROP_DETECTOR_FILE_READ_BUFFER_SIZE + 1;
+    ASSERT_EQ(file.write(packet.data(), size), Os::File::OP_OK);
+    file.close();
+
+    const std::vector<FwSizeType> expected = {1};
+    ASSERT_EQ(scanTestFile(packet_size, Utilities::DropScanner::Mode::FILE_READ, 1), expected);
+    ASSERT_EQ(scanTestFile(packet_size, Utilities::DropScanner::Mode::MEMORY_MAP, 1), expected);
+    ASSERT_EQ(scanTestFile(packet_size, Utilities::DropScanner::Mode::PARALLEL_READ, 2), expected);
+}
+
+TEST(DropScannerTest, MemoryMapMode) {
+    testScan(Utilities::DropScanner::Mode::MEMORY_MAP, 4 * Utilities::DROP_DETECTOR_FILE_READ_BUFFER_SIZE);
+}
+
+TEST(DropScannerTest, ParallelReadMode) {
+    // Packets spanning several read buffers and rounds spanning several shares of few packets each
+    testScan(Utilities::DropScanner::Mode::PARALLEL_READ, 2 * Utilities::DROP_DETECTOR_PARALLEL_READ_BUFFER_SIZE, 500);
+    // Many small packets per read buffer
+    testScan(Utilities::DropScanner::Mode::PARALLEL_READ, Utilities::DROP_DETECTOR_FILE_READ_BUFFER_SIZE);
+}
+
+TEST(DropScannerTest, ParallelReadEmpty) {
+    Os::File file;
+    ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_CREATE, Os::File::OVERWRITE), Os::File::OP_OK);
+    file.close();
+    Utilities::DropScanner scanner;
+    ASSERT_EQ(scanner.configure(Utilities::DROP_DETECTOR_PARALLEL_MAX_THREADS, 0, TEST_ALLOCATOR),
+              Utilities::DROP_DETECTOR_PARALLEL_MAX_THREADS);
+    ASSERT_EQ(scanner.open(TEST_FILEPATH, 10, Utilities::DropScanner::Mode::PARALLEL_READ,
+                           Utilities::DROP_DETECTOR_PARALLEL_MAX_THREADS),
+              Os::File::OP_OK);
+    ASSERT_EQ(scanner.getMode(), Utilities::DropScanner::Mode::PARALLEL_READ);
+    Os::File::Status file_status = Os::File::OP_OK;
+    ASSERT_EQ(readPacketReady(scanner, file_status), Utilities::DropScanner::PacketStatus::FILE_EOF);
+    ASSERT_EQ(scanner.getIndex(), 0);
+}
+
+//! \brief write a sparse test file of non-zero packets and runs of unwritten packets, returning the hole indices
+std::vector<FwSizeType> writeSparseTestFile(FwSizeType packetSize, FwSizeType& dataPackets) {
+    std::vector<FwSizeType> holes;
+    std::vector<U8> packet(packetSize, 0xFF);
+    Os::File file;
+    EXPECT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_CREATE, Os::File::OVERWRITE), Os::File::OP_OK);
+    FwSizeType index = 0;
+    dataPackets = 0;
+    for (FwSizeType i = 0; i < 20; i++) {
+        // Runs of holes are left by seeking past them, always ending the file with data
+        const FwSizeType hole_packets = (i == 0) ? 0 : STest::Pick::lowerUpper(0, 300);
+        for (FwSizeType j = 0; j < hole_packets; j++) {
+            holes.push_back(index++);
+        }
+        EXPECT_EQ(file.seek(static_cast<FwSignedSizeType>(index * packetSize), Os::File::ABSOLUTE), Os::File::OP_OK);
+        const FwSizeType data_packets = STest::Pick::lowerUpper(1, 10);
+        for (FwSizeType j = 0; j < data_packets; j++) {
+            FwSizeType size = packetSize;
+            EXPECT_EQ(file.write(packet.data(), size), Os::File::OP_OK);
+            index++;
+        }
+        dataPackets += data_packets;
+    }
+    file.close();
+    return holes;
+}
+
+//! \brief check if the test file has holes on the file system holding it
+bool testFileHasHoles() {
+#if defined(__linux__) && defined(SEEK_HOLE)
+    FwSizeType size = 0;
+    EXPECT_EQ(Os::FileSystem::getFileSize(TEST_FILEPATH, size), Os::FileSystem::OP_OK);
+    const int descriptor = ::open(TEST_FILEPATH, O_RDONLY);
+    const off_t hole = ::lseek(descriptor, 0, SEEK_HOLE);
+    (void)::close(descriptor);
+    return (hole >= 0) && (static_cast<FwSizeType>(hole) < size);
+#else
+    return false;
+#endif
+}
+
+TEST(DropScannerTest, SparseFile) {
+    const Utilities::DropScanner::Mode modes[] = {Utilities::DropScanner::Mode::FILE_READ,
+                                                  Utilities::DropScanner::Mode::MEMORY_MAP};
+    for (FwSizeType i = 0; i < 4; i++) {
+        // Block-aligned packets lie wholly within holes, unaligned packets partially overlap them
+        const FwSizeType packet_size = ((i % 2) == 0) ? 4096 : STest::Pick::lowerUpper(1, 8192);
+        FwSizeType data_packets = 0;
+        std::vector<FwSizeType> expected = writeSparseTestFile(packet_size, data_packets);
+        for (const Utilities::DropScanner::Mode mode : modes) {
+            ASSERT_EQ(scanTestFile(packet_size, mode, 1), expected);
+        }
+        // Only data is read when the file system supports holes and packets align to them
+        if (((i % 2) == 0) && testFileHasHoles()) {
+            for (const Utilities::DropScanner::Mode mode : modes) {
+                Utilities::DropScanner scanner;
+                ASSERT_EQ(scanner.open(TEST_FILEPATH, packet_size, mode), Os::File::OP_OK);
+                Os::File::Status file_status = Os::File::OP_OK;
+                while (scanner.readPacket(file_status) != Utilities::DropScanner::PacketStatus::FILE_EOF) {
+                    ASSERT_EQ(file_status, Os::File::OP_OK);
+                }
+                ASSERT_LE(scanner.getBytesScanned(), data_packets * packet_size);
+            }
+        }
+    }
+}
+
+TEST(DropScannerTest, SetIndex) {
+    const Utilities::DropScanner::Mode modes[] = {Utilities::DropScanner::Mode::FILE_READ,
+                                                  Utilities::DropScanner::Mode::MEMORY_MAP,
+                                                  Utilities::DropScanner::Mode::PARALLEL_READ};
+    for (FwSizeType i = 0; i < 10; i++) {
+        const FwSizeType packet_size = STest::Pick::lowerUpper(1, 4 * Utilities::DROP_DETECTOR_FILE_READ_BUFFER_SIZE);
+        const FwSizeType packets = STest::Pick::lowerUpper(1, 2000);
+        const FwSizeType final_size = STest::Pick::lowerUpper(1, static_cast<U32>(packet_size));
+        std::vector<FwSizeType> drops = writeTestFile(packet_size, packets, final_size);
+        // Scan part of the file, then continue from a later index including indices past the end of file
+        const FwSizeType first = STest::Pick::lowerUpper(0, static_cast<U32>(packets / 2));
+        const FwSizeType resume = STest::Pick::lowerUpper(static_cast<U32>(first), static_cast<U32>(packets + 1));
+        std::vector<FwSizeType> expected;
+        for (const FwSizeType drop : drops) {
+            if (drop >= resume) {
+                expected.push_back(drop);
+            }
+        }
+        for (const Utilities::DropScanner::Mode mode : modes) {
+            Utilities::DropScanner scanner;
+            ASSERT_EQ(scanner.configure(Utilities::DROP_DETECTOR_PARALLEL_MAX_THREADS, 0, TEST_ALLOCATOR),
+                      Utilities::DROP_DETECTOR_PARALLEL_MAX_THREADS);
+            ASSERT_EQ(scanner.open(TEST_FILEPATH, packet_size, mode, Utilities::DROP_DETECTOR_PARALLEL_MAX_THREADS),
+                      Os::File::OP_OK);
+            Os::File::Status file_status = Os::File::OP_OK;
+            for (FwSizeType j = 0; j < first; j++) {
+                ASSERT_NE(readPacketReady(scanner, file_status), Utilities::DropScanner::PacketStatus::FILE_EOF);
+            }
+            scanner.setIndex(resume);
+            ASSERT_EQ(scanner.getIndex(), resume);
+            std::vector<FwSizeType> found;
+            Utilities::DropScanner::PacketStatus status = Utilities::DropScanner::PacketStatus::GOOD;
+            while (status != Utilities::DropScanner::PacketStatus::FILE_EOF) {
+                const FwSizeType index = scanner.getIndex();
+                status = readPacketReady(scanner, file_status);
+                ASSERT_EQ(file_status, Os::File::OP_OK);
+                if (status == Utilities::DropScanner::PacketStatus::POSSIBLE_DROP) {
+                    found.push_back(index);
+                }
+            }
+            ASSERT_EQ(found, expected) << "Mode " << mode << " resumed at " << resume;
+        }
+    }
+}
+
+TEST(DropScannerTest, ManifestVerify) {
+    const Utilities::DropScanner::Mode modes[] = {Utilities::DropScanner::Mode::FILE_READ,
+                                                  Utilities::DropScanner::Mode::MEMORY_MAP};
+    for (FwSizeType i = 0; i < 10; i++) {
+        const FwSizeType packet_size = STest::Pick::lowerUpper(1, 4 * Utilities::DROP_DETECTOR_FILE_READ_BUFFER_SIZE);
+        const FwSizeType packets = STest::Pick::lowerUpper(1, 2000);
+        const FwSizeType final_size = STest::Pick::lowerUpper(1, static_cast<U32>(packet_size));
+        // Packets of zeros are data as far as the manifest is concerned
+        (void)writeTestFile(packet_size, packets, final_size);
+
+        // Manifest the file, mismatching random entries and listing a random number of packets past the end of file
+        std::vector<FwSizeType> expected;
+        std::vector<U8> packet(packet_size);
+        Os::File file;
+        Os::File manifest;
+        ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_READ), Os::File::OP_OK);
+        ASSERT_EQ(manifest.open(TEST_MANIFEST_FILEPATH, Os::File::OPEN_CREATE, Os::File::OVERWRITE), Os::File::OP_OK);
+        const FwSizeType missing = STest::Pick::lowerUpper(0, 3);
+        for (FwSizeType j = 0; j < (packets + missing); j++) {
+            FwSizeType size = packet_size;
+            ASSERT_EQ(file.read(packet.data(), size), Os::File::OP_OK);
+            U32 crc = Utilities::FileHelper::crc32(packet.data(), size);
+            if ((j >= packets) || (STest::Pick::lowerUpper(0, 9) == 0)) {
+                crc ^= 1;
+                expected.push_back(j);
+            }
+            ASSERT_EQ(Utilities::FileHelper::writeToFile(manifest, crc), Os::File::OP_OK);
+        }
+        file.close();
+        manifest.close();
+
+        for (const Utilities::DropScanner::Mode mode : modes) {
+            Utilities::DropScanner scanner;
+            ASSERT_EQ(scanner.open(TEST_FILEPATH, packet_size, mode), Os::File::OP_OK);
+            ASSERT_EQ(scanner.openManifest(TEST_MANIFEST_FILEPATH), Os::File::OP_OK);
+            std::vector<FwSizeType> found;
+            Os::File::Status file_status = Os::File::OP_OK;
+            Utilities::DropScanner::PacketStatus status = Utilities::DropScanner::PacketStatus::GOOD;
+            while (status != Utilities::DropScanner::PacketStatus::FILE_EOF) {
+                const FwSizeType index = scanner.getIndex();
+                status = readPacketReady(scanner, file_status);
+                ASSERT_EQ(file_status, Os::File::OP_OK);
+                if (status == Utilities::DropScanner::PacketStatus::POSSIBLE_DROP) {
+                    found.push_back(index);
+                }
+            }
+            ASSERT_EQ(found, expected) << "Mode " << mode;
+            ASSERT_EQ(scanner.getIndex(), packets + missing);
+            ASSERT_EQ(scanner.getBytesScanned(), ((packets - 1) * packet_size) + final_size);
+        }
+    }
+    // Packets past the end of a short manifest are unverified
+    Utilities::DropScanner scanner;
+    ASSERT_EQ(scanner.open(TEST_FILEPATH, 1, Utilities::DropScanner::Mode::FILE_READ), Os::File::OP_OK);
+    ASSERT_EQ(Utilities::FileHelper::writeToFile(TEST_MANIFEST_FILEPATH, static_cast<U8>(0)), Os::File::OP_OK);
+    ASSERT_EQ(scanner.openManifest(TEST_MANIFEST_FILEPATH), Os::File::OP_OK);
+    Os::File::Status file_status = Os::File::OP_OK;
+    ASSERT_EQ(scanner.readPacket(file_status), Utilities::DropScanner::PacketStatus::POSSIBLE_DROP);
+    scanner.close();
+    ASSERT_EQ(scanner.open(TEST_FILEPATH, 1), Os::File::OP_OK);
+    ASSERT_NE(scanner.openManifest("does_not_exist.bin"), Os::File::OP_OK);
+    (void)Os::FileSystem::removeFile(TEST_MANIFEST_FILEPATH);
+}
+
+TEST(DropScannerTest, MemoryMapFallback) {
+    // Empty files cannot be mapped and must fall back to reading
+    Os::File file;
+    ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_CREATE, Os::File::OVERWRITE), Os::File::OP_OK);
+    file.close();
+    Utilities::DropScanner scanner;
+    ASSERT_EQ(scanner.open(TEST_FILEPATH, 10, Utilities::DropScanner::Mode::MEMORY_MAP), Os::File::OP_OK);
+    ASSERT_EQ(scanner.getMode(), Utilities::DropScanner::Mode::FILE_READ);
+    Os::File::Status file_status = Os::File::OP_OK;
+    ASSERT_EQ(scanner.readPacket(file_status), Utilities::DropScanner::PacketStatus::FILE_EOF);
+}
+
+TEST(DropScannerTest, MissingFile) {
+    Utilities::DropScanner scanner;
+    ASSERT_NE(scanner.open("does_not_exist.bin", 10), Os::File::OP_OK);
+    ASSERT_FALSE(scanner.isOpen());
+    ASSERT_EQ(scanner.configure(2, 0, TEST_ALLOCATOR), 2);
+    ASSERT_NE(scanner.open("does_not_exist.bin", 10, Utilities::DropScanner::Mode::PARALLEL_READ, 2), Os::File::OP_OK);
+    ASSERT_FALSE(scanner.isOpen());
+}
+
+TEST(DropScannerTest, ParallelReadUnconfigured) {
+    // Without workers, parallel reads are not available and the file is scanned in place
+    std::vector<FwSizeType> expected = writeTestFile(10, 100, 10);
+    Utilities::DropScanner scanner;
+    ASSERT_EQ(scanner.open(TEST_FILEPATH, 10, Utilities::DropScanner::Mode::PARALLEL_READ, 2), Os::File::OP_OK);
+    ASSERT_NE(scanner.getMode(), Utilities::DropScanner::Mode::PARALLEL_READ);
+    // Workers are released with cleanup and may be configured again
+    scanner.close();
+    ASSERT_EQ(scanner.configure(2, 0, TEST_ALLOCATOR), 2);
+    scanner.cleanup();
+    ASSERT_EQ(scanner.open(TEST_FILEPATH, 10, Utilities::DropScanner::Mode::PARALLEL_READ, 2), Os::File::OP_OK);
+    ASSERT_NE(scanner.getMode(), Utilities::DropScanner::Mode::PARALLEL_READ);
+}
+
+int main(int argc, char* argv[]) {
+    STest::Random::seed();
+    ::testing::InitGoogleTest(&argc, argv);
+    int status = RUN_ALL_TESTS();
+    (void)Os::FileSystem::removeFile(TEST_FILEPATH);
+    return status;
+}
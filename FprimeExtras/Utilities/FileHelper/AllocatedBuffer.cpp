@@ -0,0 +1,124 @@
+// ======================================================================
+// \title  AllocatedBuffer.cpp
+// \author starchmd
+// \brief  cpp file for FileHelper allocator-owned buffer and whole-file load
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#include "FprimeExtras/Utilities/FileHelper/AllocatedBuffer.hpp"
+
+#include "ExtrasConfig/FileHelperConfig.hpp"
+#include "Fw/Types/Assert.hpp"
+
+namespace Utilities {
+namespace FileHelper {
+
+AllocatedBuffer ::AllocatedBuffer() : m_allocator(nullptr), m_identifier(0), m_data(nullptr), m_size(0) {}
+
+AllocatedBuffer ::~AllocatedBuffer() {
+    this->release();
+}
+
+AllocatedBuffer ::AllocatedBuffer(AllocatedBuffer&& other)
+    : m_allocator(other.m_allocator), m_identifier(other.m_identifier), m_data(other.m_data), m_size(other.m_size) {
+    other.m_allocator = nullptr;
+    other.m_data = nullptr;
+    other.m_size = 0;
+}
+
+AllocatedBuffer& AllocatedBuffer ::operator=(AllocatedBuffer&& other) {
+    if (this != &other) {
+        this->release();
+        this->m_allocator = other.m_allocator;
+        this->m_identifier = other.m_identifier;
+        this->m_data = other.m_data;
+        this->m_size = other.m_size;
+        other.m_allocator = nullptr;
+        other.m_data = nullptr;
+        other.m_size = 0;
+    }
+    return *this;
+}
+
+bool AllocatedBuffer ::allocate(Fw::MemAllocator& allocator, FwEnumStoreType identifier, FwSizeType size) {
+    this->release();
+    if (size == 0) {
+        return true;
+    }
+    // The allocator reports the size it actually allocated, which may be less than requested
+    FwSizeType allocated = size;
+    bool recoverable = false;
+    void* data = allocator.allocate(identifier, allocated, recoverable);
+    if ((data != nullptr) && (allocated < size)) {
+        allocator.deallocate(identifier, data);
+        data = nullptr;
+    }
+    if (data == nullptr) {
+        return false;
+    }
+    this->m_allocator = &allocator;
+    this->m_identifier = identifier;
+    this->m_data = static_cast<U8*>(data);
+    this->m_size = size;
+    return true;
+}
+
+void AllocatedBuffer ::release() {
+    if (this->m_data != nullptr) {
+        FW_ASSERT(this->m_allocator != nullptr);
+        this->m_allocator->deallocate(this->m_identifier, this->m_data);
+    }
+    this->m_allocator = nullptr;
+    this->m_data = nullptr;
+    this->m_size = 0;
+}
+
+U8* AllocatedBuffer ::getData() const {
+    return this->m_data;
+}
+
+FwSizeType AllocatedBuffer ::getSize() const {
+    return this->m_size;
+}
+
+Fw::Buffer AllocatedBuffer ::getBuffer() const {
+    if (this->m_data == nullptr) {
+        return Fw::Buffer();
+    }
+    return Fw::Buffer(this->m_data, this->m_size);
+}
+
+Os::File::Status readFromFile(const CHAR* filepath,
+                              Fw::MemAllocator& allocator,
+                              FwEnumStoreType identifier,
+                              AllocatedBuffer& buffer) {
+    FW_ASSERT(filepath != nullptr);
+    buffer.release();
+    Os::File file;
+    FwSizeType size = 0;
+    Os::File::Status status = file.open(filepath, Os::File::Mode::OPEN_READ);
+    if (status == Os::File::Status::OP_OK) {
+        status = file.size(size);
+    }
+    if ((status == Os::File::Status::OP_OK) && !buffer.allocate(allocator, identifier, size)) {
+        status = Os::File::Status::NO_SPACE;
+    }
+    // Reads are bounded such that no single call blocks for the whole of a large file
+    for (FwSizeType done = 0; (done < size) && (status == Os::File::Status::OP_OK);) {
+        const FwSizeType chunk = FW_MIN(Utilities::FILE_HELPER_LOAD_CHUNK_SIZE, size - done);
+        FwSizeType read_size = chunk;
+        status = file.read(buffer.getData() + done, read_size);
+        // The file shrank since its size was probed
+        if ((status == Os::File::Status::OP_OK) && (read_size != chunk)) {
+            status = Os::File::Status::BAD_SIZE;
+        }
+        done += read_size;
+    }
+    file.close();
+    if (status != Os::File::Status::OP_OK) {
+        buffer.release();
+    }
+    return status;
+}
+
+}  // namespace FileHelper
+}  // namespace Utilities
@@ -0,0 +1,94 @@
+// ======================================================================
+// \title  AllocatedBuffer.hpp
+// \author starchmd
+// \brief  hpp file for FileHelper allocator-owned buffer and whole-file load
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#ifndef FprimeExtras_Utilities_FileHelper_AllocatedBuffer_HPP
+#define FprimeExtras_Utilities_FileHelper_AllocatedBuffer_HPP
+
+#include "Fw/Buffer/Buffer.hpp"
+#include "Fw/FPrimeBasicTypes.hpp"
+#include "Fw/Types/MemAllocator.hpp"
+#include "Os/File.hpp"
+
+namespace Utilities {
+namespace FileHelper {
+
+//! \brief buffer owning memory from an Fw::MemAllocator
+//!
+//! Holds memory allocated from an Fw::MemAllocator, returning it to the same allocator under the same identifier when
+//! the AllocatedBuffer is released, destroyed, or assigned another buffer. Pools are used through a MemAllocator
+//! drawing from the pool. Ownership may be moved but not copied.
+class AllocatedBuffer {
+  public:
+    //! \brief construct a buffer owning no memory
+    AllocatedBuffer();
+
+    //! \brief destroy the buffer, releasing its memory
+    ~AllocatedBuffer();
+
+    AllocatedBuffer(const AllocatedBuffer&) = delete;
+    AllocatedBuffer& operator=(const AllocatedBuffer&) = delete;
+
+    //! \brief construct a buffer taking the memory of other, leaving other owning no memory
+    AllocatedBuffer(AllocatedBuffer&& other);
+
+    //! \brief release this buffer's memory then take the memory of other, leaving other owning no memory
+    AllocatedBuffer& operator=(AllocatedBuffer&& other);
+
+    //! \brief allocate size bytes from allocator, releasing any memory already owned
+    //!
+    //! Fails, owning no memory, when the allocator returns nothing or less than size bytes. Allocating zero bytes
+    //! succeeds without calling the allocator.
+    //!
+    //! \param allocator allocator to draw from, which must outlive the memory
+    //! \param identifier identifier passed to the allocator on allocation and deallocation
+    //! \param size bytes to allocate
+    //! \return true when size bytes are owned
+    bool allocate(Fw::MemAllocator& allocator, FwEnumStoreType identifier, FwSizeType size);
+
+    //! \brief return the memory to its allocator, if any is owned
+    void release();
+
+    //! \brief get the owned memory, null when none is owned
+    U8* getData() const;
+
+    //! \brief get the size of the owned memory in bytes
+    FwSizeType getSize() const;
+
+    //! \brief get a view of the owned memory
+    //!
+    //! The view is invalid once the memory is released or when no memory is owned.
+    Fw::Buffer getBuffer() const;
+
+  private:
+    Fw::MemAllocator* m_allocator;  //!< Allocator of m_data, null when none is owned
+    FwEnumStoreType m_identifier;   //!< Identifier m_data was allocated under
+    U8* m_data;                     //!< Owned memory, null when none is owned
+    FwSizeType m_size;              //!< Size of m_data
+};
+
+//! \brief read the entire file specified by filepath into memory from allocator
+//!
+//! Probes the size of the file, allocates exactly that many bytes once, then reads the file into them in pieces of
+//! FILE_HELPER_LOAD_CHUNK_SIZE bytes. Variable-sized files are loaded without the caller sizing a buffer in advance.
+//! Any memory buffer already owns is released first. On failure buffer owns no memory. An empty file loads
+//! successfully without allocating.
+//!
+//! \warning It is invalid to call this function with a null filepath and results in an assertion failure.
+//!
+//! \param filepath The path to the file to read.
+//! \param allocator The allocator to draw the memory from.
+//! \param identifier The identifier passed to the allocator.
+//! \param buffer Set to own the file contents.
+//! \return status of the file read operation, NO_SPACE when the allocation fails, BAD_SIZE when the file shrinks
+//!         while read
+Os::File::Status readFromFile(const CHAR* filepath,
+                              Fw::MemAllocator& allocator,
+                              FwEnumStoreType identifier,
+                              AllocatedBuffer& buffer);
+
+}  // namespace FileHelper
+}  // namespace Utilities
+#endif  // FprimeExtras_Utilities_FileHelper_AllocatedBuffer_HPP
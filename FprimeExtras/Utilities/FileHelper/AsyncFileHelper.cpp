@@ -0,0 +1,195 @@
+// ======================================================================
+// \title  AsyncFileHelper.cpp
+// \author starchmd
+// \brief  cpp file for FileHelper asynchronous file operations
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#include "FprimeExtras/Utilities/FileHelper/AsyncFileHelper.hpp"
+
+namespace Utilities {
+namespace FileHelper {
+
+void AsyncFileHelper::IndexQueue ::push(FwSizeType index) {
+    FW_ASSERT(this->m_count < Utilities::FILE_HELPER_ASYNC_QUEUE_DEPTH, static_cast<FwAssertArgType>(this->m_count));
+    this->m_indices[(this->m_head + this->m_count) % Utilities::FILE_HELPER_ASYNC_QUEUE_DEPTH] = index;
+    this->m_count++;
+}
+
+FwSizeType AsyncFileHelper::IndexQueue ::pop() {
+    FW_ASSERT(this->m_count > 0);
+    const FwSizeType index = this->m_indices[this->m_head];
+    this->m_head = (this->m_head + 1) % Utilities::FILE_HELPER_ASYNC_QUEUE_DEPTH;
+    this->m_count--;
+    return index;
+}
+
+AsyncFileHelper ::AsyncFileHelper()
+    : m_free{{}, 0, 0},
+      m_pending{{}, 0, 0},
+      m_completed{{}, 0, 0},
+      m_threads(0),
+      m_stopping(false),
+      m_callback(nullptr),
+      m_argument(nullptr) {
+    for (FwSizeType i = 0; i < Utilities::FILE_HELPER_ASYNC_QUEUE_DEPTH; i++) {
+        this->m_free.push(i);
+    }
+}
+
+AsyncFileHelper ::~AsyncFileHelper() {
+    this->stop();
+}
+
+void AsyncFileHelper ::setCallback(Callback callback, void* argument) {
+    FW_ASSERT(!this->isRunning());
+    this->m_callback = callback;
+    this->m_argument = argument;
+}
+
+FwSizeType AsyncFileHelper ::start(FwSizeType threads) {
+    FW_ASSERT(!this->isRunning());
+    FW_ASSERT((threads > 0) && (threads <= Utilities::FILE_HELPER_ASYNC_MAX_THREADS),
+              static_cast<FwAssertArgType>(threads));
+    FwSizeType started = 0;
+    for (FwSizeType i = 0; i < threads; i++) {
+        Os::Task::Arguments arguments(Os::TaskString("FileHelperAsync"), AsyncFileHelper::workerRoutine, this);
+        // Tasks are started in order, such that the first m_threads tasks are those to join
+        if (this->m_tasks[started].start(arguments) == Os::Task::OP_OK) {
+            started++;
+        }
+    }
+    Os::ScopeLock lock(this->m_lock);
+    this->m_threads = started;
+    return started;
+}
+
+void AsyncFileHelper ::stop() {
+    FwSizeType threads = 0;
+    {
+        Os::ScopeLock lock(this->m_lock);
+        threads = this->m_threads;
+        this->m_stopping = true;
+        this->m_queued.notifyAll();
+    }
+    for (FwSizeType i = 0; i < threads; i++) {
+        (void)this->m_tasks[i].join();
+    }
+    Os::ScopeLock lock(this->m_lock);
+    this->m_threads = 0;
+    this->m_stopping = false;
+}
+
+bool AsyncFileHelper ::isRunning() const {
+    Os::ScopeLock lock(this->m_lock);
+    return this->m_threads > 0;
+}
+
+bool AsyncFileHelper ::writeToFile(const CHAR* filepath, const Fw::Buffer& buffer, U32 context) {
+    return this->submit(Operation::WRITE, filepath, buffer, context);
+}
+
+bool AsyncFileHelper ::appendToFile(const CHAR* filepath, const Fw::Buffer& buffer, U32 context) {
+    return this->submit(Operation::APPEND, filepath, buffer, context);
+}
+
+bool AsyncFileHelper ::readFromFile(const CHAR* filepath, Fw::Buffer& buffer, U32 context) {
+    return this->submit(Operation::READ, filepath, buffer, context);
+}
+
+bool AsyncFileHelper ::poll(Completion& completion) {
+    Os::ScopeLock lock(this->m_lock);
+    if (this->m_completed.m_count == 0) {
+        return false;
+    }
+    const FwSizeType index = this->m_completed.pop();
+    completion = this->m_requests[index].m_completion;
+    this->m_free.push(index);
+    return true;
+}
+
+FwSizeType AsyncFileHelper ::getOutstandingCount() const {
+    Os::ScopeLock lock(this->m_lock);
+    return Utilities::FILE_HELPER_ASYNC_QUEUE_DEPTH - this->m_free.m_count;
+}
+
+bool AsyncFileHelper ::submit(Operation operation, const CHAR* filepath, const Fw::Buffer& buffer, U32 context) {
+    FW_ASSERT(filepath != nullptr);
+    FW_ASSERT(buffer.isValid());
+    Os::ScopeLock lock(this->m_lock);
+    if ((this->m_threads == 0) || this->m_stopping || (this->m_free.m_count == 0)) {
+        return false;
+    }
+    const FwSizeType index = this->m_free.pop();
+    Request& request = this->m_requests[index];
+    request.m_path = filepath;
+    request.m_completion.m_operation = operation;
+    request.m_completion.m_context = context;
+    request.m_completion.m_status = Os::File::Status::OP_OK;
+    request.m_completion.m_buffer = buffer;
+    this->m_pending.push(index);
+    this->m_queued.notify();
+    return true;
+}
+
+Os::File::Status AsyncFileHelper ::perform(Request& request) {
+    const CHAR* path = request.m_path.toChar();
+    Fw::Buffer& buffer = request.m_completion.m_buffer;
+    Os::File::Status status = Os::File::Status::OP_OK;
+    switch (request.m_completion.m_operation) {
+        case Operation::WRITE:
+            status = FileHelper::writeToFile(path, buffer);
+            break;
+        case Operation::APPEND: {
+            Os::File file;
+            status = file.open(path, Os::File::Mode::OPEN_APPEND);
+            if (status == Os::File::Status::OP_OK) {
+                status = FileHelper::writeToFile(file, buffer);
+                file.close();
+            }
+            break;
+        }
+        case Operation::READ:
+            status = FileHelper::readFromFile(path, buffer);
+            break;
+        default:
+            FW_ASSERT(0, static_cast<FwAssertArgType>(request.m_completion.m_operation));
+            break;
+    }
+    return status;
+}
+
+void AsyncFileHelper ::workerRoutine(void* helper) {
+    FW_ASSERT(helper != nullptr);
+    static_cast<AsyncFileHelper*>(helper)->work();
+}
+
+void AsyncFileHelper ::work() {
+    this->m_lock.lock();
+    while (true) {
+        while ((this->m_pending.m_count == 0) && !this->m_stopping) {
+            this->m_queued.wait(this->m_lock);
+        }
+        // Stopping workers finish the queued requests before exiting
+        if (this->m_pending.m_count == 0) {
+            break;
+        }
+        const FwSizeType index = this->m_pending.pop();
+        Request& request = this->m_requests[index];
+        // The lock is released while performing the request such that submitters never wait on storage
+        this->m_lock.unLock();
+        request.m_completion.m_status = AsyncFileHelper::perform(request);
+        if (this->m_callback != nullptr) {
+            this->m_callback(this->m_argument, request.m_completion);
+        }
+        this->m_lock.lock();
+        if (this->m_callback != nullptr) {
+            this->m_free.push(index);
+        } else {
+            this->m_completed.push(index);
+        }
+    }
+    this->m_lock.unLock();
+}
+
+}  // namespace FileHelper
+}  // namespace Utilities
@@ -0,0 +1,215 @@
+// ======================================================================
+// \title  AsyncFileHelper.hpp
+// \author starchmd
+// \brief  hpp file for FileHelper asynchronous file operations
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#ifndef FprimeExtras_Utilities_FileHelper_AsyncFileHelper_HPP
+#define FprimeExtras_Utilities_FileHelper_AsyncFileHelper_HPP
+
+#include <cstring>
+#include <type_traits>
+
+#include "ExtrasConfig/FileHelperConfig.hpp"
+#include "FprimeExtras/Utilities/FileHelper/FileHelper.hpp"
+#include "Fw/Buffer/Buffer.hpp"
+#include "Fw/FPrimeBasicTypes.hpp"
+#include "Fw/Types/Assert.hpp"
+#include "Fw/Types/FileNameString.hpp"
+#include "Os/Condition.hpp"
+#include "Os/File.hpp"
+#include "Os/Mutex.hpp"
+#include "Os/Task.hpp"
+
+// clang-format off
+//! Enable helper to restrict an asynchronous write to a type FileHelper can serialize
+#define T_ASYNC_SUBMIT_STATUS typename std::enable_if<std::is_fundamental<T>::value || (std::is_base_of<Fw::Serializable, T>::value && !std::is_same<T, Fw::Buffer>::value), bool>::type
+// clang-format on
+
+namespace Utilities {
+namespace FileHelper {
+
+//! \brief performs FileHelper whole-file operations on worker tasks
+//!
+//! Requests to write, append, or read a file are queued and return without touching storage, such that a caller on a
+//! rate group never waits on the file system. Submitting only holds a lock shared with the workers for the time taken
+//! to move a request on or off the queue, as the workers release it while performing file operations. A request that
+//! does not fit in the queue is refused rather than waited on.
+//!
+//! Each request completes with the status of the FileHelper operation it performed. Completions are passed to a
+//! callback on the worker task when one is set, or are otherwise held until collected by poll. A request keeps its
+//! queue entry until its completion is delivered, such that completions can never be lost. Buffers supplied with a
+//! request belong to the request until it completes and must not be touched by the caller until then.
+class AsyncFileHelper {
+  public:
+    //! Operation performed by a request
+    enum Operation : U8 {
+        WRITE = 0,   //!< Write the buffer to the file, replacing its contents
+        APPEND = 1,  //!< Write the buffer after the end of the file, creating it when missing
+        READ = 2,    //!< Fill the buffer from the start of the file
+    };
+
+    //! Outcome of a request
+    struct Completion {
+        Operation m_operation;      //!< Operation performed
+        U32 m_context;              //!< Context supplied with the request
+        Os::File::Status m_status;  //!< Status of the operation
+        Fw::Buffer m_buffer;        //!< Buffer supplied with the request
+    };
+
+    //! \brief callback receiving each completion on the worker task that performed the request
+    //!
+    //! \param argument argument supplied with the callback
+    //! \param completion the completion, valid only for the duration of the call
+    typedef void (*Callback)(void* argument, const Completion& completion);
+
+    //! Construct a stopped helper delivering completions through poll
+    AsyncFileHelper();
+
+    //! Destroy the helper, stopping it if running
+    ~AsyncFileHelper();
+
+    AsyncFileHelper(const AsyncFileHelper&) = delete;
+    AsyncFileHelper& operator=(const AsyncFileHelper&) = delete;
+
+    //! \brief deliver completions to callback rather than holding them for poll
+    //!
+    //! \warning It is invalid to call this function on a running helper and results in an assertion failure.
+    //!
+    //! \param callback function receiving completions, nullptr to hold completions for poll
+    //! \param argument passed to callback
+    void setCallback(Callback callback, void* argument);
+
+    //! \brief start worker tasks performing queued requests
+    //!
+    //! \warning It is invalid to call this function on a running helper, or to request no workers or more than
+    //!          FILE_HELPER_ASYNC_MAX_THREADS workers, and results in an assertion failure.
+    //!
+    //! \param threads number of worker tasks to start
+    //! \return number of worker tasks started, the helper runs when this is non-zero
+    FwSizeType start(FwSizeType threads = 1);
+
+    //! \brief perform the requests already queued then stop the worker tasks
+    //!
+    //! Requests submitted while stopping are refused. Completions not yet collected remain available to poll. Stopping
+    //! a helper that is not running has no effect.
+    void stop();
+
+    //! \brief check if the helper has running worker tasks
+    bool isRunning() const;
+
+    //! \brief queue a write of buffer to the file at filepath, replacing its contents
+    //!
+    //! \warning It is invalid to supply a null filepath or an invalid buffer and results in an assertion failure.
+    //!
+    //! \param filepath path of the file, copied with the request
+    //! \param buffer data to write, must remain valid until the request completes
+    //! \param context value returned with the completion
+    //! \return true when queued, false when the helper is not running or the queue is full
+    bool writeToFile(const CHAR* filepath, const Fw::Buffer& buffer, U32 context = 0);
+
+    //! \brief queue a write of object to the file at filepath, replacing its contents
+    //!
+    //! The object is serialized into storage before returning, in the layout of the synchronous writeToFile, such that
+    //! the object itself may change once queued.
+    //!
+    //! \warning It is invalid to supply a null filepath or storage smaller than the serialized size of object and
+    //!          results in an assertion failure.
+    //!
+    //! \param filepath path of the file, copied with the request
+    //! \param object the object to write
+    //! \param storage holds the serialized object, must remain valid until the request completes
+    //! \param context value returned with the completion
+    //! \return true when queued, false when the helper is not running or the queue is full
+    template <typename T>
+    T_ASYNC_SUBMIT_STATUS writeToFile(const CHAR* filepath, const T& object, Fw::Buffer& storage, U32 context = 0) {
+        constexpr FwSizeType size = SerializedSize<T>::value;
+        FW_ASSERT(storage.isValid());
+        FW_ASSERT(storage.getSize() >= size, static_cast<FwAssertArgType>(storage.getSize()));
+        Fw::Buffer serialized(storage.getData(), size);
+        auto serializer = serialized.getSerializer();
+        serializeAll(serializer, object);
+        // Objects serializing short of their maximum size are padded to keep the synchronous layout deterministic
+        const FwSizeType used = serializer.getSize();
+        (void)::memset(storage.getData() + used, 0, size - used);
+        return this->submit(Operation::WRITE, filepath, serialized, context);
+    }
+
+    //! \brief queue a write of buffer after the end of the file at filepath, creating it when missing
+    //!
+    //! \warning It is invalid to supply a null filepath or an invalid buffer and results in an assertion failure.
+    //!
+    //! \param filepath path of the file, copied with the request
+    //! \param buffer data to write, must remain valid until the request completes
+    //! \param context value returned with the completion
+    //! \return true when queued, false when the helper is not running or the queue is full
+    bool appendToFile(const CHAR* filepath, const Fw::Buffer& buffer, U32 context = 0);
+
+    //! \brief queue a read filling buffer from the start of the file at filepath
+    //!
+    //! The request completes with BAD_SIZE when the file holds fewer bytes than the buffer, as readFromFile does.
+    //!
+    //! \warning It is invalid to supply a null filepath or an invalid buffer and results in an assertion failure.
+    //!
+    //! \param filepath path of the file, copied with the request
+    //! \param buffer filled by the read, must remain valid until the request completes
+    //! \param context value returned with the completion
+    //! \return true when queued, false when the helper is not running or the queue is full
+    bool readFromFile(const CHAR* filepath, Fw::Buffer& buffer, U32 context = 0);
+
+    //! \brief collect the oldest completion held for poll
+    //!
+    //! \param completion set to the completion when one is available
+    //! \return true when a completion was collected
+    bool poll(Completion& completion);
+
+    //! \brief get the number of requests queued, in progress, or awaiting collection by poll
+    FwSizeType getOutstandingCount() const;
+
+  private:
+    //! Queued request
+    struct Request {
+        Fw::FileNameString m_path;  //!< Path of the file
+        Completion m_completion;    //!< Completion returned once performed
+    };
+
+    //! Fixed-capacity queue of request indices
+    struct IndexQueue {
+        FwSizeType m_indices[Utilities::FILE_HELPER_ASYNC_QUEUE_DEPTH];  //!< Indices in order from m_head
+        FwSizeType m_head;                                              //!< Position of the oldest index
+        FwSizeType m_count;                                             //!< Indices held
+
+        //! \brief add index after the newest index
+        void push(FwSizeType index);
+        //! \brief remove and return the oldest index
+        FwSizeType pop();
+    };
+
+    //! \brief queue a request, copying filepath
+    bool submit(Operation operation, const CHAR* filepath, const Fw::Buffer& buffer, U32 context);
+
+    //! \brief perform the file operation of request
+    static Os::File::Status perform(Request& request);
+
+    //! \brief routine of the worker tasks, argument is the helper
+    static void workerRoutine(void* helper);
+
+    //! \brief perform queued requests until stopped and the queue is empty
+    void work();
+
+    mutable Os::Mutex m_lock;                                      //!< Guards the queues, requests, and thread count
+    Os::ConditionVariable m_queued;                                //!< Signaled on a request or stopping
+    Request m_requests[Utilities::FILE_HELPER_ASYNC_QUEUE_DEPTH];  //!< Request storage
+    IndexQueue m_free;                                             //!< Requests available for submission
+    IndexQueue m_pending;                                          //!< Requests awaiting a worker
+    IndexQueue m_completed;                                        //!< Requests awaiting collection by poll
+    Os::Task m_tasks[Utilities::FILE_HELPER_ASYNC_MAX_THREADS];    //!< Worker tasks
+    FwSizeType m_threads;                                          //!< Worker tasks started
+    bool m_stopping;                                               //!< Workers exit once the queue is empty
+    Callback m_callback;                                           //!< Receives completions, nullptr for poll
+    void* m_argument;                                              //!< Argument passed to m_callback
+};
+
+}  // namespace FileHelper
+}  // namespace Utilities
+#endif  // FprimeExtras_Utilities_FileHelper_AsyncFileHelper_HPP
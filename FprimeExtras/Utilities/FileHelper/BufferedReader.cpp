@@ -0,0 +1,73 @@
+// ======================================================================
+// \title  BufferedReader.cpp
+// \author starchmd
+// \brief  cpp file for FileHelper buffered file reader
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#include "FprimeExtras/Utilities/FileHelper/BufferedReader.hpp"
+#include "Fw/Types/Assert.hpp"
+
+#include <cstring>
+
+namespace Utilities {
+namespace FileHelper {
+
+BufferedReader ::BufferedReader(Os::File& file, U8* buffer, FwSizeType capacity)
+    : m_file(file), m_buffer(buffer), m_capacity(capacity), m_readAhead(capacity), m_offset(0), m_size(0) {
+    FW_ASSERT(buffer != nullptr);
+    FW_ASSERT(capacity > 0);
+}
+
+bool BufferedReader ::isOpen() const {
+    return this->m_file.isOpen();
+}
+
+Os::File::Status BufferedReader ::read(U8* data, FwSizeType& size) {
+    FW_ASSERT(this->m_file.isOpen());
+    FW_ASSERT((data != nullptr) || (size == 0));
+    Os::File::Status status = Os::File::Status::OP_OK;
+    FwSizeType done = 0;
+    while ((done < size) && (status == Os::File::Status::OP_OK)) {
+        // Serve buffered data first
+        if (this->m_offset < this->m_size) {
+            const FwSizeType chunk = FW_MIN(this->m_size - this->m_offset, size - done);
+            ::memcpy(data + done, this->m_buffer + this->m_offset, static_cast<size_t>(chunk));
+            this->m_offset += chunk;
+            done += chunk;
+            continue;
+        }
+        FwSizeType read_size = size - done;
+        if (read_size >= this->m_readAhead) {
+            // Data at least as large as a refill is read directly, gaining nothing from a copy
+            status = this->m_file.read(data + done, read_size);
+            done += read_size;
+        } else {
+            read_size = this->m_readAhead;
+            status = this->m_file.read(this->m_buffer, read_size);
+            this->m_offset = 0;
+            this->m_size = read_size;
+        }
+        // End of file
+        if (read_size == 0) {
+            break;
+        }
+    }
+    size = done;
+    return status;
+}
+
+void BufferedReader ::setReadAhead(FwSizeType bytes) {
+    this->m_readAhead = FW_MAX(FW_MIN(bytes, this->m_capacity), static_cast<FwSizeType>(1));
+}
+
+void BufferedReader ::discard() {
+    this->m_offset = 0;
+    this->m_size = 0;
+}
+
+FwSizeType BufferedReader ::getBufferedSize() const {
+    return this->m_size - this->m_offset;
+}
+
+}  // namespace FileHelper
+}  // namespace Utilities
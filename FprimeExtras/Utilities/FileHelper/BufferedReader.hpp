@@ -0,0 +1,90 @@
+// ======================================================================
+// \title  BufferedReader.hpp
+// \author starchmd
+// \brief  hpp file for FileHelper buffered file reader
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#ifndef FprimeExtras_Utilities_FileHelper_BufferedReader_HPP
+#define FprimeExtras_Utilities_FileHelper_BufferedReader_HPP
+
+#include "ExtrasConfig/FileHelperConfig.hpp"
+#include "Fw/FPrimeBasicTypes.hpp"
+#include "Os/File.hpp"
+
+namespace Utilities {
+namespace FileHelper {
+
+//! \brief serves small reads of an open file from large blocks
+//!
+//! Wraps an open Os::File with a buffer supplied by the caller. Reads are served from the buffer, which is refilled
+//! from the file with a single read of up to the read-ahead size once exhausted, such that many small reads cost one
+//! file read per refill. Reads at least as large as the read-ahead size are read directly after any buffered data. The
+//! reader accepts every FileHelper::readFromFile and FileHelper::readArray overload in place of an Os::File.
+//!
+//! The read-ahead size defaults to the buffer capacity, which suits reading a file sequentially. Callers reading a
+//! little at scattered positions may lower it such that data that will not be used is not read. As the file position
+//! runs ahead of the reader by the buffered data, call discard after moving the file position directly. The file must
+//! stay open for the life of the reader.
+class BufferedReader {
+  public:
+    //! \brief construct a reader buffering reads of file in buffer
+    //!
+    //! \warning It is invalid to supply a null buffer or a zero capacity and results in an assertion failure.
+    //!
+    //! \param file the open file to read from
+    //! \param buffer storage used to hold data read ahead, must outlive the reader
+    //! \param capacity size of buffer in bytes
+    BufferedReader(Os::File& file, U8* buffer, FwSizeType capacity);
+
+    BufferedReader(const BufferedReader&) = delete;
+    BufferedReader& operator=(const BufferedReader&) = delete;
+
+    //! \brief check if the underlying file is open
+    bool isOpen() const;
+
+    //! \brief read data from the file through the buffer
+    //!
+    //! Mirrors Os::File::read. Reads until size bytes are read or the end of the file is reached, setting size to the
+    //! number of bytes read. On error, size is set to the bytes read before the error.
+    //!
+    //! \warning It is invalid to call this function when the file is not open and results in an assertion failure.
+    //!
+    //! \param data storage for the data read
+    //! \param size number of bytes to read, set to the number of bytes read
+    //! \return status of any file read made
+    Os::File::Status read(U8* data, FwSizeType& size);
+
+    //! \brief hint the number of bytes to read ahead on each refill
+    //!
+    //! \param bytes bytes read on each refill, limited to between 1 and the buffer capacity
+    void setReadAhead(FwSizeType bytes);
+
+    //! \brief drop any buffered data such that the next read starts at the current file position
+    void discard();
+
+    //! \brief get the number of bytes read from the file and not yet returned
+    FwSizeType getBufferedSize() const;
+
+  private:
+    Os::File& m_file;        //!< File read from
+    U8* m_buffer;            //!< Storage of buffered data
+    FwSizeType m_capacity;   //!< Size of m_buffer
+    FwSizeType m_readAhead;  //!< Bytes read on each refill
+    FwSizeType m_offset;     //!< Offset of the next unread byte in m_buffer
+    FwSizeType m_size;       //!< Bytes held in m_buffer
+};
+
+//! \brief BufferedReader holding a buffer of CAPACITY bytes
+template <FwSizeType CAPACITY = Utilities::FILE_HELPER_STREAM_BUFFER_SIZE>
+class StaticBufferedReader : public BufferedReader {
+  public:
+    //! \brief construct a reader buffering reads of file
+    explicit StaticBufferedReader(Os::File& file) : BufferedReader(file, m_storage, CAPACITY) {}
+
+  private:
+    U8 m_storage[CAPACITY];  //!< Storage of buffered data
+};
+
+}  // namespace FileHelper
+}  // namespace Utilities
+#endif  // FprimeExtras_Utilities_FileHelper_BufferedReader_HPP
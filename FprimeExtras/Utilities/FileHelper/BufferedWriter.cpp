@@ -0,0 +1,78 @@
+// ======================================================================
+// \title  BufferedWriter.cpp
+// \author starchmd
+// \brief  cpp file for FileHelper buffered file writer
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#include "FprimeExtras/Utilities/FileHelper/BufferedWriter.hpp"
+#include "Fw/Types/Assert.hpp"
+
+#include <cstring>
+
+namespace Utilities {
+namespace FileHelper {
+
+BufferedWriter ::BufferedWriter(Os::File& file, U8* buffer, FwSizeType capacity)
+    : m_file(file), m_buffer(buffer), m_capacity(capacity), m_size(0) {
+    FW_ASSERT(buffer != nullptr);
+    FW_ASSERT(capacity > 0);
+}
+
+BufferedWriter ::~BufferedWriter() {
+    if (this->m_file.isOpen()) {
+        (void)this->flush();
+    }
+}
+
+bool BufferedWriter ::isOpen() const {
+    return this->m_file.isOpen();
+}
+
+Os::File::Status BufferedWriter ::write(const U8* data, FwSizeType& size) {
+    FW_ASSERT(this->m_file.isOpen());
+    FW_ASSERT((data != nullptr) || (size == 0));
+    // Data fitting in the remaining buffer is only copied
+    if (size <= (this->m_capacity - this->m_size)) {
+        ::memcpy(this->m_buffer + this->m_size, data, static_cast<size_t>(size));
+        this->m_size += size;
+        return Os::File::Status::OP_OK;
+    }
+    Os::File::Status status = this->flush();
+    if ((status == Os::File::Status::OP_OK) && (size >= this->m_capacity)) {
+        // Data at least as large as the buffer gains nothing from a copy
+        FwSizeType written = size;
+        status = this->m_file.write(data, written);
+        if ((status == Os::File::Status::OP_OK) && (written != size)) {
+            status = Os::File::Status::BAD_SIZE;
+        }
+    } else if (status == Os::File::Status::OP_OK) {
+        ::memcpy(this->m_buffer, data, static_cast<size_t>(size));
+        this->m_size = size;
+    }
+    if (status != Os::File::Status::OP_OK) {
+        size = 0;
+    }
+    return status;
+}
+
+Os::File::Status BufferedWriter ::flush() {
+    Os::File::Status status = Os::File::Status::OP_OK;
+    if (this->m_size > 0) {
+        FW_ASSERT(this->m_file.isOpen());
+        FwSizeType written = this->m_size;
+        status = this->m_file.write(this->m_buffer, written);
+        if ((status == Os::File::Status::OP_OK) && (written != this->m_size)) {
+            status = Os::File::Status::BAD_SIZE;
+        }
+        // Data is discarded on error as a partial write leaves the file contents unknown
+        this->m_size = 0;
+    }
+    return status;
+}
+
+FwSizeType BufferedWriter ::getBufferedSize() const {
+    return this->m_size;
+}
+
+}  // namespace FileHelper
+}  // namespace Utilities
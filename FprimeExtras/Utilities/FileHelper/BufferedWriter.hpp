@@ -0,0 +1,86 @@
+// ======================================================================
+// \title  BufferedWriter.hpp
+// \author starchmd
+// \brief  hpp file for FileHelper buffered file writer
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#ifndef FprimeExtras_Utilities_FileHelper_BufferedWriter_HPP
+#define FprimeExtras_Utilities_FileHelper_BufferedWriter_HPP
+
+#include "ExtrasConfig/FileHelperConfig.hpp"
+#include "Fw/FPrimeBasicTypes.hpp"
+#include "Os/File.hpp"
+
+namespace Utilities {
+namespace FileHelper {
+
+//! \brief collects small writes to an open file into large blocks
+//!
+//! Wraps an open Os::File with a buffer supplied by the caller. Writes are copied into the buffer and the buffer is
+//! written to the file once full, such that many small writes cost one file write per buffer. Writes at least as large
+//! as the buffer are written directly after any buffered data. The writer accepts every FileHelper::writeToFile and
+//! FileHelper::writeArray overload in place of an Os::File.
+//!
+//! Buffered data is written when the buffer fills, when flush is called, and when the writer is destroyed. Errors of
+//! the write on destruction are lost, so call flush to check them. The file must stay open for the life of the writer.
+class BufferedWriter {
+  public:
+    //! \brief construct a writer buffering writes to file in buffer
+    //!
+    //! \warning It is invalid to supply a null buffer or a zero capacity and results in an assertion failure.
+    //!
+    //! \param file the open file to write to
+    //! \param buffer storage used to collect writes, must outlive the writer
+    //! \param capacity size of buffer in bytes
+    BufferedWriter(Os::File& file, U8* buffer, FwSizeType capacity);
+
+    //! Destroy the writer, writing any buffered data
+    ~BufferedWriter();
+
+    BufferedWriter(const BufferedWriter&) = delete;
+    BufferedWriter& operator=(const BufferedWriter&) = delete;
+
+    //! \brief check if the underlying file is open
+    bool isOpen() const;
+
+    //! \brief write data to the file through the buffer
+    //!
+    //! Mirrors Os::File::write. On success every byte is accepted and size is unchanged. On error size is set to 0 and
+    //! any buffered data is discarded, leaving the file contents after the last successful flush unspecified.
+    //!
+    //! \warning It is invalid to call this function when the file is not open and results in an assertion failure.
+    //!
+    //! \param data data to write
+    //! \param size number of bytes to write, set to the number of bytes accepted
+    //! \return status of any file write made
+    Os::File::Status write(const U8* data, FwSizeType& size);
+
+    //! \brief write any buffered data to the file
+    //!
+    //! \return status of the file write, OP_OK when nothing was buffered
+    Os::File::Status flush();
+
+    //! \brief get the number of bytes buffered and not yet written to the file
+    FwSizeType getBufferedSize() const;
+
+  private:
+    Os::File& m_file;       //!< File written to
+    U8* m_buffer;           //!< Storage of buffered data
+    FwSizeType m_capacity;  //!< Size of m_buffer
+    FwSizeType m_size;      //!< Bytes buffered in m_buffer
+};
+
+//! \brief BufferedWriter holding a buffer of CAPACITY bytes
+template <FwSizeType CAPACITY = Utilities::FILE_HELPER_STREAM_BUFFER_SIZE>
+class StaticBufferedWriter : public BufferedWriter {
+  public:
+    //! \brief construct a writer buffering writes to file
+    explicit StaticBufferedWriter(Os::File& file) : BufferedWriter(file, m_storage, CAPACITY) {}
+
+  private:
+    U8 m_storage[CAPACITY];  //!< Storage of buffered data
+};
+
+}  // namespace FileHelper
+}  // namespace Utilities
+#endif  // FprimeExtras_Utilities_FileHelper_BufferedWriter_HPP
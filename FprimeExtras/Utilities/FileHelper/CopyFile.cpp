@@ -0,0 +1,265 @@
+// ======================================================================
+// \title  CopyFile.cpp
+// \author starchmd
+// \brief  cpp file for FileHelper file-to-file copy
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#include "FprimeExtras/Utilities/FileHelper/CopyFile.hpp"
+
+#include "ExtrasConfig/FileHelperConfig.hpp"
+#include "FprimeExtras/Utilities/FileHelper/AllocatedBuffer.hpp"
+#include "FprimeExtras/Utilities/FileHelper/FileHelper.hpp"
+#include "Fw/Types/Assert.hpp"
+
+#if defined(__linux__)
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/sendfile.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace Utilities {
+namespace FileHelper {
+namespace {
+
+//! \brief set total to the bytes options copy from a source of size bytes
+Os::File::Status resolveLength(const CopyOptions& options, FwSizeType size, FwSizeType& total) {
+    total = 0;
+    if (options.m_sourceOffset > size) {
+        return Os::File::Status::BAD_SIZE;
+    }
+    const FwSizeType available = size - options.m_sourceOffset;
+    total = (options.m_length == COPY_TO_END) ? available : options.m_length;
+    return (total > available) ? Os::File::Status::BAD_SIZE : Os::File::Status::OP_OK;
+}
+
+//! \brief report progress to the callback of options, returning true to continue copying
+bool reportProgress(const CopyOptions& options, FwSizeType copied, FwSizeType total) {
+    return (options.m_progress == nullptr) || options.m_progress(options.m_progressArgument, copied, total);
+}
+
+//! \brief copy through data of capacity bytes, folding the data into the CRC of options
+//!
+//! The copy continues after the copied bytes already moved, such that a copy the kernel stopped short is finished.
+Os::File::Status copyThrough(const CHAR* source,
+                             const CHAR* destination,
+                             const CopyOptions& options,
+                             U8* data,
+                             FwSizeType capacity,
+                             FwSizeType& copied) {
+    Os::File input;
+    Os::File output;
+    FwSizeType size = 0;
+    FwSizeType total = 0;
+    Os::File::Status status = input.open(source, Os::File::Mode::OPEN_READ);
+    if (status == Os::File::Status::OP_OK) {
+        status = input.size(size);
+    }
+    if (status == Os::File::Status::OP_OK) {
+        status = resolveLength(options, size, total);
+    }
+    if (status == Os::File::Status::OP_OK) {
+        status = input.seek(static_cast<FwSignedSizeType>(options.m_sourceOffset + copied),
+                            Os::File::SeekType::ABSOLUTE);
+    }
+    // The destination is only opened, and so truncated, once the source range is known to be valid
+    if (status == Os::File::Status::OP_OK) {
+        status = output.open(destination,
+                             (options.m_truncate && (copied == 0)) ? Os::File::Mode::OPEN_CREATE
+                                                                   : Os::File::Mode::OPEN_WRITE,
+                             Os::File::OverwriteType::OVERWRITE);
+    }
+    if (status == Os::File::Status::OP_OK) {
+        status = output.seek(static_cast<FwSignedSizeType>(options.m_destinationOffset + copied),
+                             Os::File::SeekType::ABSOLUTE);
+    }
+    bool proceed = true;
+    while ((status == Os::File::Status::OP_OK) && (copied < total) && proceed) {
+        Fw::Buffer buffer(data, FW_MIN(capacity, total - copied));
+        status = (options.m_crc != nullptr) ? readFromFileCrc32(input, buffer, *options.m_crc)
+                                            : readFromFile(input, buffer);
+        if (status == Os::File::Status::OP_OK) {
+            status = writeToFile(output, buffer);
+        }
+        if (status == Os::File::Status::OP_OK) {
+            copied += buffer.getSize();
+            proceed = reportProgress(options, copied, total);
+        }
+    }
+    input.close();
+    output.close();
+    return status;
+}
+
+//! \brief copy through the buffer of options, one drawn from its allocator, or a stack buffer
+Os::File::Status copyThroughBuffer(const CHAR* source,
+                                   const CHAR* destination,
+                                   const CopyOptions& options,
+                                   FwSizeType& copied) {
+    if (options.m_buffer != nullptr) {
+        return copyThrough(source, destination, options, options.m_buffer, options.m_bufferSize, copied);
+    }
+    if (options.m_allocator != nullptr) {
+        AllocatedBuffer buffer;
+        if (!buffer.allocate(*options.m_allocator, options.m_allocatorId, Utilities::FILE_HELPER_COPY_CHUNK_SIZE)) {
+            return Os::File::Status::NO_SPACE;
+        }
+        return copyThrough(source, destination, options, buffer.getData(), buffer.getSize(), copied);
+    }
+    U8 staging[Utilities::FILE_HELPER_CRC_CHUNK_SIZE];
+    return copyThrough(source, destination, options, staging, sizeof(staging), copied);
+}
+
+#if defined(__linux__)
+//! \brief convert an errno from opening or copying a file to the matching file status
+Os::File::Status errnoToStatus(int error) {
+    switch (error) {
+        case ENOENT:
+        case ENOTDIR:
+            return Os::File::Status::DOESNT_EXIST;
+        case EACCES:
+        case EPERM:
+            return Os::File::Status::NO_PERMISSION;
+        case ENOSPC:
+        case EDQUOT:
+            return Os::File::Status::NO_SPACE;
+        case EFBIG:
+        case EOVERFLOW:
+            return Os::File::Status::BAD_SIZE;
+        default:
+            return Os::File::Status::OTHER_ERROR;
+    }
+}
+
+//! \brief check if error reports a kernel copy unsupported between two files, such that another way may be tried
+bool isUnsupported(int error) {
+    return (error == ENOSYS) || (error == EXDEV) || (error == EINVAL) || (error == EOPNOTSUPP);
+}
+
+//! \brief check if source and destination are the same file, by device and inode such that any path to it matches
+bool isSameFile(const CHAR* source, const CHAR* destination) {
+    // Opened for their metadata only, such that neither read nor write permission is needed
+    const int input = ::open(source, O_PATH | O_CLOEXEC);
+    const int output = ::open(destination, O_PATH | O_CLOEXEC);
+    struct stat input_stat;
+    struct stat output_stat;
+    const bool same = (input >= 0) && (output >= 0) && (::fstat(input, &input_stat) == 0) &&
+                      (::fstat(output, &output_stat) == 0) && (input_stat.st_dev == output_stat.st_dev) &&
+                      (input_stat.st_ino == output_stat.st_ino);
+    if (output >= 0) {
+        (void)::close(output);
+    }
+    if (input >= 0) {
+        (void)::close(input);
+    }
+    return same;
+}
+
+//! \brief move up to size bytes between the offsets in the kernel with copy_file_range, or with sendfile when not range
+ssize_t moveInKernel(int input, int output, off_t& input_offset, off_t& output_offset, size_t size, bool range) {
+    if (range) {
+#if defined(SYS_copy_file_range)
+        // Invoked directly such that C libraries predating the wrapper are supported
+        return static_cast<ssize_t>(
+            ::syscall(SYS_copy_file_range, input, &input_offset, output, &output_offset, size, 0U));
+#else
+        errno = ENOSYS;
+        return -1;
+#endif
+    }
+    // sendfile writes at the file position of output rather than at an offset
+    if (::lseek(output, output_offset, SEEK_SET) < 0) {
+        return -1;
+    }
+    const ssize_t moved = ::sendfile(output, input, &input_offset, size);
+    output_offset += (moved > 0) ? moved : 0;
+    return moved;
+}
+
+//! \brief copy in the kernel, returning NOT_SUPPORTED when the rest of the copy, from copied, needs user space
+Os::File::Status copyInKernel(const CHAR* source,
+                              const CHAR* destination,
+                              const CopyOptions& options,
+                              FwSizeType& copied) {
+    const int input = ::open(source, O_RDONLY | O_CLOEXEC);
+    if (input < 0) {
+        return errnoToStatus(errno);
+    }
+    int output = -1;
+    FwSizeType total = 0;
+    Os::File::Status status = Os::File::Status::OP_OK;
+    struct stat file_stat;
+    if (::fstat(input, &file_stat) != 0) {
+        status = errnoToStatus(errno);
+    } else {
+        status = resolveLength(options, static_cast<FwSizeType>(file_stat.st_size), total);
+    }
+    // The destination is only opened, and so truncated, once the source range is known to be valid
+    if (status == Os::File::Status::OP_OK) {
+        output = ::open(destination, O_WRONLY | O_CREAT | O_CLOEXEC | (options.m_truncate ? O_TRUNC : 0), 0666);
+        status = (output < 0) ? errnoToStatus(errno) : status;
+    }
+    off_t input_offset = static_cast<off_t>(options.m_sourceOffset);
+    off_t output_offset = static_cast<off_t>(options.m_destinationOffset);
+    bool range = true;
+    bool proceed = true;
+    while ((status == Os::File::Status::OP_OK) && (copied < total) && proceed) {
+        const size_t size = static_cast<size_t>(FW_MIN(Utilities::FILE_HELPER_COPY_CHUNK_SIZE, total - copied));
+        const ssize_t moved = moveInKernel(input, output, input_offset, output_offset, size, range);
+        // Files such as those of procfs and sysfs may move nothing in the kernel before their end. The next way is
+        // tried as when unsupported, and user space reports a source truncated during the copy as BAD_SIZE.
+        const bool unsupported = (moved == 0) || ((moved < 0) && isUnsupported(errno));
+        if (unsupported && range) {
+            range = false;
+        } else if (unsupported) {
+            status = Os::File::Status::NOT_SUPPORTED;
+        } else if (moved < 0) {
+            status = errnoToStatus(errno);
+        } else {
+            copied += static_cast<FwSizeType>(moved);
+            proceed = reportProgress(options, copied, total);
+        }
+    }
+    if (output >= 0) {
+        (void)::close(output);
+    }
+    (void)::close(input);
+    return status;
+}
+#endif
+
+}  // namespace
+
+Os::File::Status copyFile(const CHAR* source,
+                          const CHAR* destination,
+                          const CopyOptions& options,
+                          FwSizeType& copied) {
+    FW_ASSERT(source != nullptr);
+    FW_ASSERT(destination != nullptr);
+    FW_ASSERT((options.m_buffer == nullptr) || (options.m_bufferSize > 0));
+    copied = 0;
+#if defined(__linux__)
+    // Truncating the destination would destroy the source, and copying in place would only rewrite it
+    if (isSameFile(source, destination)) {
+        return Os::File::Status::INVALID_ARGUMENT;
+    }
+    // A CRC needs the data to pass through user space
+    if (options.m_crc == nullptr) {
+        const Os::File::Status status = copyInKernel(source, destination, options, copied);
+        if (status != Os::File::Status::NOT_SUPPORTED) {
+            return status;
+        }
+    }
+#endif
+    return copyThroughBuffer(source, destination, options, copied);
+}
+
+Os::File::Status copyFile(const CHAR* source, const CHAR* destination, const CopyOptions& options) {
+    FwSizeType copied = 0;
+    return copyFile(source, destination, options, copied);
+}
+
+}  // namespace FileHelper
+}  // namespace Utilities
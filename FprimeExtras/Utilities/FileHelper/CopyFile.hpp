@@ -0,0 +1,98 @@
+// ======================================================================
+// \title  CopyFile.hpp
+// \author starchmd
+// \brief  hpp file for FileHelper file-to-file copy
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#ifndef FprimeExtras_Utilities_FileHelper_CopyFile_HPP
+#define FprimeExtras_Utilities_FileHelper_CopyFile_HPP
+
+#include <limits>
+
+#include "Fw/FPrimeBasicTypes.hpp"
+#include "Fw/Types/MemAllocator.hpp"
+#include "Os/File.hpp"
+
+namespace Utilities {
+namespace FileHelper {
+
+//! Length copying everything from the source offset to the end of the source
+constexpr FwSizeType COPY_TO_END = std::numeric_limits<FwSizeType>::max();
+
+//! \brief progress of a copyFile, called after each piece is copied
+//!
+//! \param argument argument supplied with the callback
+//! \param copied bytes copied so far by this call to copyFile
+//! \param total bytes this call to copyFile copies when not stopped
+//! \return true to continue copying, false to stop after this piece
+typedef bool (*CopyProgress)(void* argument, FwSizeType copied, FwSizeType total);
+
+//! \brief options of copyFile
+//!
+//! The defaults copy the whole source over the destination, replacing its contents.
+struct CopyOptions {
+    //! Construct options copying the whole source
+    CopyOptions()
+        : m_sourceOffset(0),
+          m_destinationOffset(0),
+          m_length(COPY_TO_END),
+          m_truncate(true),
+          m_crc(nullptr),
+          m_buffer(nullptr),
+          m_bufferSize(0),
+          m_allocator(nullptr),
+          m_allocatorId(0),
+          m_progress(nullptr),
+          m_progressArgument(nullptr) {}
+
+    FwSizeType m_sourceOffset;       //!< Offset of the first byte copied from the source
+    FwSizeType m_destinationOffset;  //!< Offset in the destination receiving the first byte
+    FwSizeType m_length;             //!< Bytes to copy, COPY_TO_END to copy to the end of the source
+    bool m_truncate;                 //!< Discard the destination contents, otherwise bytes outside the copy are kept
+    U32* m_crc;                      //!< CRC updated to include the bytes copied (see crc32), nullptr for none
+    U8* m_buffer;                    //!< Storage for copies through user space, nullptr for an allocated buffer
+    FwSizeType m_bufferSize;         //!< Size of m_buffer
+    Fw::MemAllocator* m_allocator;   //!< Allocates the buffer when m_buffer is nullptr, nullptr for a stack buffer
+    FwEnumStoreType m_allocatorId;   //!< Identifier passed to m_allocator
+    CopyProgress m_progress;         //!< Called after each piece is copied, nullptr for none
+    void* m_progressArgument;        //!< Argument passed to m_progress
+};
+
+//! \brief copy the file at source to the file at destination
+//!
+//! On Linux the data is moved by the kernel with copy_file_range, or with sendfile where copy_file_range is not
+//! supported between the files, without passing through user space. The kernel moves FILE_HELPER_COPY_CHUNK_SIZE bytes
+//! per call. Elsewhere, when neither is supported or stops short of the range, or when a CRC is requested such that
+//! the data must be read, the rest of the data is copied through options.m_buffer. When none is given a buffer of
+//! FILE_HELPER_COPY_CHUNK_SIZE bytes is drawn from options.m_allocator for the copy, or else a stack buffer of
+//! FILE_HELPER_CRC_CHUNK_SIZE bytes is used. A CRC is folded in as each piece passes through the buffer, such that it
+//! costs no second pass over the data.
+//!
+//! A copy may be spread over several calls, such as one per rate group tick, by stopping it from the progress callback
+//! or limiting m_length, then continuing with both offsets advanced by the bytes copied, m_truncate cleared, and the
+//! same running CRC.
+//!
+//! On Linux, copying a file onto itself, under the same or another path, is rejected before the destination is
+//! opened for writing such that the source is never truncated.
+//!
+//! \warning It is invalid to supply a null source or destination and results in an assertion failure.
+//!
+//! \param source path of the file to copy from
+//! \param destination path of the file to copy to, created when missing
+//! \param options range, CRC, buffer, and progress of the copy
+//! \param copied set to the number of bytes copied
+//! \return status of the copy, BAD_SIZE when the range extends past the end of the source, INVALID_ARGUMENT when
+//!         source and destination are the same file, NO_SPACE when the buffer cannot be allocated
+Os::File::Status copyFile(const CHAR* source,
+                          const CHAR* destination,
+                          const CopyOptions& options,
+                          FwSizeType& copied);
+
+//! \brief copy the file at source to the file at destination
+//!
+//! Behaves as copyFile(source, destination, options, copied) without reporting the bytes copied.
+Os::File::Status copyFile(const CHAR* source, const CHAR* destination, const CopyOptions& options = CopyOptions());
+
+}  // namespace FileHelper
+}  // namespace Utilities
+#endif  // FprimeExtras_Utilities_FileHelper_CopyFile_HPP
@@ -0,0 +1,208 @@
+// ======================================================================
+// \title  Crc32.cpp
+// \author starchmd
+// \brief  cpp file for FileHelper CRC32 computation
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#include "FprimeExtras/Utilities/FileHelper/Crc32.hpp"
+
+#include <cstddef>
+
+#include "Fw/Types/Assert.hpp"
+
+// The folding kernel is built with a per-function target attribute such that the rest of the library does not require
+// any special compiler flags. PCLMULQDQ and SSE4.1 must be detected at runtime.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#define CRC32_X86 1
+#include <immintrin.h>
+#else
+#define CRC32_X86 0
+#endif
+
+namespace Utilities {
+namespace FileHelper {
+namespace {
+
+//! Reflected CRC32 polynomial
+constexpr U32 CRC32_POLYNOMIAL = 0xEDB88320;
+
+//! \brief slicing-by-8 lookup tables
+//!
+//! m_table[0] is the classic byte-at-a-time table. m_table[k] advances the CRC of a byte followed by k zero bytes,
+//! such that eight bytes are folded into the CRC with eight independent lookups.
+struct Crc32Tables {
+    Crc32Tables() {
+        for (U32 i = 0; i < 256; i++) {
+            U32 crc = i;
+            for (U32 bit = 0; bit < 8; bit++) {
+                crc = (crc >> 1) ^ ((crc & 1) ? CRC32_POLYNOMIAL : 0);
+            }
+            this->m_table[0][i] = crc;
+        }
+        for (U32 i = 0; i < 256; i++) {
+            for (U32 k = 1; k < 8; k++) {
+                const U32 previous = this->m_table[k - 1][i];
+                this->m_table[k][i] = (previous >> 8) ^ this->m_table[0][previous & 0xFF];
+            }
+        }
+    }
+    U32 m_table[8][256];
+};
+
+//! \brief get the lookup tables, building them on first use
+const Crc32Tables& tables() {
+    static const Crc32Tables TABLES;
+    return TABLES;
+}
+
+//! Kernel function signature shared by all implementations, operating on the inverted CRC register
+typedef U32 (*KernelFunction)(U32 state, const U8* data, FwSizeType size);
+
+//! \brief slicing-by-8 kernel
+U32 crc32SlicingBy8(U32 state, const U8* data, FwSizeType size) {
+    const U32(&table)[8][256] = tables().m_table;
+    // Bytes are assembled explicitly such that the result does not depend on the host byte order
+    for (; size >= 8; size -= 8, data += 8) {
+        const U32 low = state ^ (static_cast<U32>(data[0]) | (static_cast<U32>(data[1]) << 8) |
+                                 (static_cast<U32>(data[2]) << 16) | (static_cast<U32>(data[3]) << 24));
+        const U32 high = static_cast<U32>(data[4]) | (static_cast<U32>(data[5]) << 8) |
+                         (static_cast<U32>(data[6]) << 16) | (static_cast<U32>(data[7]) << 24);
+        state = table[7][low & 0xFF] ^ table[6][(low >> 8) & 0xFF] ^ table[5][(low >> 16) & 0xFF] ^
+                table[4][low >> 24] ^ table[3][high & 0xFF] ^ table[2][(high >> 8) & 0xFF] ^
+                table[1][(high >> 16) & 0xFF] ^ table[0][high >> 24];
+    }
+    for (; size > 0; size--, data++) {
+        state = (state >> 8) ^ table[0][(state ^ *data) & 0xFF];
+    }
+    return state;
+}
+
+#if CRC32_X86
+//! \brief carry-less multiplication kernel folding 64 bytes per iteration
+//!
+//! Follows "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ Instruction" (Intel, 2009) in the
+//! bit-reflected domain. Four 128-bit lanes are folded forward across each 64-byte block, then folded into one lane,
+//! reduced to 64 bits, and Barrett reduced to the 32-bit CRC. Data shorter than one block, and the tail beyond the last
+//! 16-byte multiple, is left to the slicing-by-8 kernel.
+__attribute__((target("pclmul,sse4.1"))) U32 crc32Clmul(U32 state, const U8* data, FwSizeType size) {
+    constexpr FwSizeType BLOCK_SIZE = 64;
+    constexpr FwSizeType LANE_SIZE = sizeof(__m128i);
+    if (size < BLOCK_SIZE) {
+        return crc32SlicingBy8(state, data, size);
+    }
+    // Folding constants x^(4*128+32) mod P, x^(4*128-32) mod P, x^(128+32) mod P, x^(128-32) mod P, x^64 mod P, and
+    // the Barrett constants floor(x^64 / P) and P, all bit-reflected
+    const __m128i k1k2 = _mm_set_epi64x(0x01C6E41596, 0x0154442BD4);
+    const __m128i k3k4 = _mm_set_epi64x(0x00CCAA009E, 0x01751997D0);
+    const __m128i k5 = _mm_set_epi64x(0, 0x0163CD6124);
+    const __m128i barrett = _mm_set_epi64x(0x01F7011641, 0x01DB710641);
+    const __m128i low32 = _mm_setr_epi32(~0, 0, ~0, 0);
+    const U8* const end = data + (size & ~static_cast<FwSizeType>(LANE_SIZE - 1));
+
+    const __m128i* block = reinterpret_cast<const __m128i*>(data);
+    __m128i x1 = _mm_xor_si128(_mm_loadu_si128(block), _mm_cvtsi32_si128(static_cast<int>(state)));
+    __m128i x2 = _mm_loadu_si128(block + 1);
+    __m128i x3 = _mm_loadu_si128(block + 2);
+    __m128i x4 = _mm_loadu_si128(block + 3);
+    data += BLOCK_SIZE;
+    // Fold the four lanes forward over each further block
+    for (; (end - data) >= static_cast<std::ptrdiff_t>(BLOCK_SIZE); data += BLOCK_SIZE) {
+        block = reinterpret_cast<const __m128i*>(data);
+        const __m128i x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+        const __m128i x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+        const __m128i x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+        const __m128i x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k1k2, 0x11), x5), _mm_loadu_si128(block));
+        x2 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x2, k1k2, 0x11), x6), _mm_loadu_si128(block + 1));
+        x3 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x3, k1k2, 0x11), x7), _mm_loadu_si128(block + 2));
+        x4 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x4, k1k2, 0x11), x8), _mm_loadu_si128(block + 3));
+    }
+    // Fold the lanes into one, then fold in any remaining whole lanes
+    const __m128i lanes[] = {x2, x3, x4};
+    for (const __m128i& lane : lanes) {
+        const __m128i low = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), lane), low);
+    }
+    for (; data < end; data += LANE_SIZE) {
+        const __m128i low = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+        x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11),
+                                         _mm_loadu_si128(reinterpret_cast<const __m128i*>(data))),
+                           low);
+    }
+    // Reduce 128 bits to 64 bits
+    x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, low32), k5, 0x00), x2);
+    // Barrett reduce 64 bits to the 32-bit CRC register
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, low32), barrett, 0x10);
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, low32), barrett, 0x00);
+    state = static_cast<U32>(_mm_extract_epi32(_mm_xor_si128(x1, x2), 1));
+    return crc32SlicingBy8(state, end, size & (LANE_SIZE - 1));
+}
+#endif
+
+//! \brief get the function implementing a supported kernel
+KernelFunction getFunction(Crc32Kernel kernel) {
+    switch (kernel) {
+#if CRC32_X86
+        case Crc32Kernel::CRC32_CLMUL:
+            return crc32Clmul;
+#endif
+        default:
+            return crc32SlicingBy8;
+    }
+}
+
+//! \brief select the fastest kernel supported by this CPU
+Crc32Kernel selectKernel() {
+    Crc32Kernel selected = Crc32Kernel::CRC32_SLICING_BY_8;
+    for (FwSizeType i = 0; i < Crc32Kernel::NUM_CRC32_KERNELS; i++) {
+        Crc32Kernel candidate = static_cast<Crc32Kernel>(i);
+        if (isSupported(candidate)) {
+            selected = candidate;
+        }
+    }
+    return selected;
+}
+
+//! \brief get the function of the selected kernel, selecting it on first use
+KernelFunction getSelectedFunction() {
+    // Function-local statics are initialized exactly once, even when first called from multiple threads
+    static const KernelFunction selected = getFunction(getCrc32Kernel());
+    return selected;
+}
+
+}  // namespace
+
+bool isSupported(Crc32Kernel kernel) {
+    switch (kernel) {
+        case Crc32Kernel::CRC32_SLICING_BY_8:
+            return true;
+#if CRC32_X86
+        case Crc32Kernel::CRC32_CLMUL:
+            return __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+#endif
+        default:
+            return false;
+    }
+}
+
+Crc32Kernel getCrc32Kernel() {
+    static const Crc32Kernel selected = selectKernel();
+    return selected;
+}
+
+U32 crc32(const U8* data, FwSizeType size, U32 crc) {
+    FW_ASSERT((data != nullptr) || (size == 0));
+    return ~getSelectedFunction()(~crc, data, size);
+}
+
+U32 crc32(Crc32Kernel kernel, const U8* data, FwSizeType size, U32 crc) {
+    FW_ASSERT((data != nullptr) || (size == 0));
+    FW_ASSERT(isSupported(kernel), static_cast<FwAssertArgType>(kernel));
+    return ~getFunction(kernel)(~crc, data, size);
+}
+
+}  // namespace FileHelper
+}  // namespace Utilities
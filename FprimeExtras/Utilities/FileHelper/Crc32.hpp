@@ -0,0 +1,72 @@
+// ======================================================================
+// \title  Crc32.hpp
+// \author starchmd
+// \brief  hpp file for FileHelper CRC32 computation
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#ifndef FprimeExtras_Utilities_FileHelper_Crc32_HPP
+#define FprimeExtras_Utilities_FileHelper_Crc32_HPP
+
+#include "Fw/FPrimeBasicTypes.hpp"
+
+namespace Utilities {
+namespace FileHelper {
+
+//! \brief implementations of the CRC32 kernel
+//!
+//! CRC32_SLICING_BY_8 is available on every platform and processes eight bytes at a time through eight lookup tables,
+//! which are built on first use. CRC32_CLMUL folds 64 bytes at a time with carry-less multiplication and is only
+//! available on x86 targets whose CPU supports PCLMULQDQ and SSE4.1, detected at runtime. Every kernel computes the
+//! same CRC.
+enum Crc32Kernel {
+    CRC32_SLICING_BY_8,  //!< Table-driven kernel written in plain C++
+    CRC32_CLMUL,         //!< Carry-less multiplication folding kernel
+    NUM_CRC32_KERNELS
+};
+
+//! \brief check if the given CRC32 kernel can run on this platform and CPU
+//!
+//! \param kernel the kernel to check
+//! \return true when the kernel was compiled in and the CPU supports it, false otherwise
+bool isSupported(Crc32Kernel kernel);
+
+//! \brief get the CRC32 kernel selected for this CPU
+//!
+//! The fastest supported kernel is selected once on first use and is used by crc32.
+//!
+//! \return kernel used by crc32
+Crc32Kernel getCrc32Kernel();
+
+//! \brief compute the CRC32 of a block of data
+//!
+//! Computes the standard CRC32 (IEEE 802.3, reflected polynomial 0xEDB88320) as used by zlib and Ethernet, using the
+//! kernel selected for this CPU.
+//!
+//! Large data may be processed in pieces by passing the CRC of the preceding pieces as crc. The CRC of no data is 0,
+//! such that crc32(b, nb, crc32(a, na)) equals the CRC of a followed by b.
+//!
+//! \warning It is invalid to supply null data with a non-zero size and results in an assertion failure.
+//!
+//! \param data data to compute the CRC over
+//! \param size size of the data in bytes
+//! \param crc CRC of the data preceding this data, 0 when there is none
+//! \return CRC32 of the preceding data followed by this data
+U32 crc32(const U8* data, FwSizeType size, U32 crc = 0);
+
+//! \brief compute the CRC32 of a block of data using a specific kernel
+//!
+//! Identical to crc32, but uses the supplied kernel. This is used to test and benchmark kernels against each other.
+//!
+//! \warning It is invalid to call this function with an unsupported kernel, or to supply null data with a non-zero
+//!          size, and results in an assertion failure.
+//!
+//! \param kernel kernel to use. Must be supported (see isSupported).
+//! \param data data to compute the CRC over
+//! \param size size of the data in bytes
+//! \param crc CRC of the data preceding this data, 0 when there is none
+//! \return CRC32 of the preceding data followed by this data
+U32 crc32(Crc32Kernel kernel, const U8* data, FwSizeType size, U32 crc = 0);
+
+}  // namespace FileHelper
+}  // namespace Utilities
+#endif  // FprimeExtras_Utilities_FileHelper_Crc32_HPP
@@ -0,0 +1,156 @@
+// ======================================================================
+// \title  FileDeserializer.cpp
+// \author starchmd
+// \brief  cpp file for FileHelper deserialization directly from a file
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#include "FprimeExtras/Utilities/FileHelper/FileDeserializer.hpp"
+#include "Fw/Types/Assert.hpp"
+
+#include <cstring>
+
+namespace Utilities {
+namespace FileHelper {
+
+FileDeserializer ::FileDeserializer(Os::File& file, FwSizeType limit)
+    : Fw::ExternalSerializeBuffer(m_staging, sizeof(m_staging)),
+      m_file(&file),
+      m_reader(nullptr),
+      m_fileStatus(Os::File::Status::OP_OK),
+      m_remaining(limit) {}
+
+FileDeserializer ::FileDeserializer(BufferedReader& reader, FwSizeType limit)
+    : Fw::ExternalSerializeBuffer(m_staging, sizeof(m_staging)),
+      m_file(nullptr),
+      m_reader(&reader),
+      m_fileStatus(Os::File::Status::OP_OK),
+      m_remaining(limit) {}
+
+Fw::SerializeStatus FileDeserializer ::deserializeTo(U8& val, Fw::Endianness mode) {
+    return this->deserializePrimitive(val, mode);
+}
+
+Fw::SerializeStatus FileDeserializer ::deserializeTo(I8& val, Fw::Endianness mode) {
+    return this->deserializePrimitive(val, mode);
+}
+
+Fw::SerializeStatus FileDeserializer ::deserializeTo(U16& val, Fw::Endianness mode) {
+    return this->deserializePrimitive(val, mode);
+}
+
+Fw::SerializeStatus FileDeserializer ::deserializeTo(I16& val, Fw::Endianness mode) {
+    return this->deserializePrimitive(val, mode);
+}
+
+Fw::SerializeStatus FileDeserializer ::deserializeTo(U32& val, Fw::Endianness mode) {
+    return this->deserializePrimitive(val, mode);
+}
+
+Fw::SerializeStatus FileDeserializer ::deserializeTo(I32& val, Fw::Endianness mode) {
+    return this->deserializePrimitive(val, mode);
+}
+
+Fw::SerializeStatus FileDeserializer ::deserializeTo(U64& val, Fw::Endianness mode) {
+    return this->deserializePrimitive(val, mode);
+}
+
+Fw::SerializeStatus FileDeserializer ::deserializeTo(I64& val, Fw::Endianness mode) {
+    return this->deserializePrimitive(val, mode);
+}
+
+Fw::SerializeStatus FileDeserializer ::deserializeTo(F32& val, Fw::Endianness mode) {
+    return this->deserializePrimitive(val, mode);
+}
+
+Fw::SerializeStatus FileDeserializer ::deserializeTo(F64& val, Fw::Endianness mode) {
+    return this->deserializePrimitive(val, mode);
+}
+
+Fw::SerializeStatus FileDeserializer ::deserializeTo(bool& val, Fw::Endianness mode) {
+    return this->deserializePrimitive(val, mode);
+}
+
+Fw::SerializeStatus FileDeserializer ::deserializeTo(U8* buff,
+                                                     FwSizeType& length,
+                                                     Fw::Serialization::t lengthMode,
+                                                     Fw::Endianness endianMode) {
+    FW_ASSERT((buff != nullptr) || (length == 0));
+    if (lengthMode == Fw::Serialization::INCLUDE_LENGTH) {
+        FwSizeStoreType stored = 0;
+        Fw::SerializeStatus status = this->deserializeTo(stored, endianMode);
+        if (status != Fw::FW_SERIALIZE_OK) {
+            return status;
+        }
+        if (stored > length) {
+            return Fw::FW_DESERIALIZE_SIZE_MISMATCH;
+        }
+        length = stored;
+    }
+    // Staged bytes are copied out, the rest of the array is read directly
+    FwSizeType staged = FW_MIN(this->getDeserializeSizeLeft(), length);
+    Fw::SerializeStatus status =
+        Fw::ExternalSerializeBuffer::deserializeTo(buff, staged, Fw::Serialization::OMIT_LENGTH, endianMode);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    if (staged < length) {
+        FwSizeType size = length - staged;
+        this->readData(buff + staged, size);
+        if (size != (length - staged)) {
+            return Fw::FW_DESERIALIZE_BUFFER_EMPTY;
+        }
+    }
+    return Fw::FW_SERIALIZE_OK;
+}
+
+Os::File::Status FileDeserializer ::finish() {
+    this->resetSer();
+    while ((this->m_remaining > 0) && (this->m_fileStatus == Os::File::Status::OP_OK)) {
+        FwSizeType size = FW_MIN(this->m_remaining, static_cast<FwSizeType>(sizeof(this->m_staging)));
+        const FwSizeType requested = size;
+        this->readData(this->m_staging, size);
+        if ((size != requested) && (this->m_fileStatus == Os::File::Status::OP_OK)) {
+            return Os::File::Status::BAD_SIZE;
+        }
+    }
+    return this->m_fileStatus;
+}
+
+Os::File::Status FileDeserializer ::getFileStatus() const {
+    return this->m_fileStatus;
+}
+
+template <typename T>
+Fw::SerializeStatus FileDeserializer ::deserializePrimitive(T& val, Fw::Endianness mode) {
+    if (!this->fill(sizeof(T))) {
+        return Fw::FW_DESERIALIZE_BUFFER_EMPTY;
+    }
+    return Fw::ExternalSerializeBuffer::deserializeTo(val, mode);
+}
+
+bool FileDeserializer ::fill(FwSizeType size) {
+    const FwSizeType left = this->getDeserializeSizeLeft();
+    if (left >= size) {
+        return true;
+    }
+    // Move the unread bytes to the front of the staging buffer and read in behind them
+    ::memmove(this->m_staging, this->m_staging + (this->getSize() - left), static_cast<size_t>(left));
+    FwSizeType read_size = sizeof(this->m_staging) - left;
+    this->readData(this->m_staging + left, read_size);
+    Fw::SerializeStatus status = this->setBuffLen(left + read_size);
+    FW_ASSERT(status == Fw::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(status));
+    return this->getDeserializeSizeLeft() >= size;
+}
+
+void FileDeserializer ::readData(U8* data, FwSizeType& size) {
+    size = FW_MIN(size, this->m_remaining);
+    // Once a read fails nothing further is read
+    if ((this->m_fileStatus != Os::File::Status::OP_OK) || (size == 0)) {
+        size = 0;
+        return;
+    }
+    this->m_fileStatus =
+        (this->m_file != nullptr) ? this->m_file->read(data, size) : this->m_reader->read(data, size);
+    this->m_remaining -= size;
+}
+
+}  // namespace FileHelper
+}  // namespace Utilities
@@ -0,0 +1,99 @@
+// ======================================================================
+// \title  FileDeserializer.hpp
+// \author starchmd
+// \brief  hpp file for FileHelper deserialization directly from a file
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#ifndef FprimeExtras_Utilities_FileHelper_FileDeserializer_HPP
+#define FprimeExtras_Utilities_FileHelper_FileDeserializer_HPP
+
+#include "ExtrasConfig/FileHelperConfig.hpp"
+#include "FprimeExtras/Utilities/FileHelper/BufferedReader.hpp"
+#include "Fw/FPrimeBasicTypes.hpp"
+#include "Fw/Types/Serializable.hpp"
+#include "Os/File.hpp"
+
+#include <limits>
+
+namespace Utilities {
+namespace FileHelper {
+
+//! \brief deserialization buffer reading from an open file as deserialization proceeds
+//!
+//! Deserializes from a staging buffer of FILE_HELPER_SERIAL_STAGING_SIZE bytes that is refilled from the file whenever
+//! the next value is not fully staged, such that objects of any size are deserialized with constant stack use. Byte
+//! arrays larger than the staging buffer are read directly.
+//!
+//! Refills read ahead of the data deserialized, but never more than limit bytes from the file in total. Set limit to the
+//! serialized size of the data to leave the file positioned just past it. A failed read stops deserialization with
+//! FW_DESERIALIZE_BUFFER_EMPTY and the file status is available from getFileStatus. Repositioning the deserializer is
+//! not supported.
+class FileDeserializer : public Fw::ExternalSerializeBuffer {
+  public:
+    //! \brief construct a deserializer reading from file
+    //!
+    //! \param file the open file to read from, must stay open for the life of the deserializer
+    //! \param limit maximum number of bytes read from the file
+    explicit FileDeserializer(Os::File& file, FwSizeType limit = std::numeric_limits<FwSizeType>::max());
+
+    //! \brief construct a deserializer reading through a buffered reader
+    //!
+    //! \param reader the buffered reader to read through, must outlive the deserializer
+    //! \param limit maximum number of bytes read from the file
+    explicit FileDeserializer(BufferedReader& reader, FwSizeType limit = std::numeric_limits<FwSizeType>::max());
+
+    FileDeserializer(const FileDeserializer&) = delete;
+    FileDeserializer& operator=(const FileDeserializer&) = delete;
+
+    using Fw::ExternalSerializeBuffer::deserializeTo;
+
+    Fw::SerializeStatus deserializeTo(U8& val, Fw::Endianness mode = Fw::Endianness::BIG) override;
+    Fw::SerializeStatus deserializeTo(I8& val, Fw::Endianness mode = Fw::Endianness::BIG) override;
+    Fw::SerializeStatus deserializeTo(U16& val, Fw::Endianness mode = Fw::Endianness::BIG) override;
+    Fw::SerializeStatus deserializeTo(I16& val, Fw::Endianness mode = Fw::Endianness::BIG) override;
+    Fw::SerializeStatus deserializeTo(U32& val, Fw::Endianness mode = Fw::Endianness::BIG) override;
+    Fw::SerializeStatus deserializeTo(I32& val, Fw::Endianness mode = Fw::Endianness::BIG) override;
+    Fw::SerializeStatus deserializeTo(U64& val, Fw::Endianness mode = Fw::Endianness::BIG) override;
+    Fw::SerializeStatus deserializeTo(I64& val, Fw::Endianness mode = Fw::Endianness::BIG) override;
+    Fw::SerializeStatus deserializeTo(F32& val, Fw::Endianness mode = Fw::Endianness::BIG) override;
+    Fw::SerializeStatus deserializeTo(F64& val, Fw::Endianness mode = Fw::Endianness::BIG) override;
+    Fw::SerializeStatus deserializeTo(bool& val, Fw::Endianness mode = Fw::Endianness::BIG) override;
+
+    //! \brief deserialize a byte array, reading the part of the array not already staged directly
+    Fw::SerializeStatus deserializeTo(U8* buff,
+                                      FwSizeType& length,
+                                      Fw::Serialization::t lengthMode,
+                                      Fw::Endianness endianMode = Fw::Endianness::BIG) override;
+
+    //! \brief consume the remainder of limit
+    //!
+    //! Drops any staged data and reads the bytes of limit not yet read from the file, leaving the file positioned limit
+    //! bytes past where deserialization began.
+    //!
+    //! \return BAD_SIZE when the file ends before limit bytes were read, else the status of the reads
+    Os::File::Status finish();
+
+    //! \brief get the status of the first failed file read, OP_OK when none has failed
+    Os::File::Status getFileStatus() const;
+
+  private:
+    //! \brief deserialize a primitive after staging it
+    template <typename T>
+    Fw::SerializeStatus deserializePrimitive(T& val, Fw::Endianness mode);
+
+    //! \brief refill the staging buffer when fewer than size bytes are staged, returning false when still short
+    bool fill(FwSizeType size);
+
+    //! \brief read up to size bytes of the remaining limit from the file or reader, setting size to the bytes read
+    void readData(U8* data, FwSizeType& size);
+
+    Os::File* m_file;               //!< File read from, nullptr when reading through m_reader
+    BufferedReader* m_reader;       //!< Reader read through, nullptr when reading from m_file
+    Os::File::Status m_fileStatus;  //!< Status of the first failed read
+    FwSizeType m_remaining;         //!< Bytes of limit not yet read from the file
+    U8 m_staging[Utilities::FILE_HELPER_SERIAL_STAGING_SIZE];  //!< Staged serialized data
+};
+
+}  // namespace FileHelper
+}  // namespace Utilities
+#endif  // FprimeExtras_Utilities_FileHelper_FileDeserializer_HPP
@@ -5,9 +5,166 @@
 // \copyright Copyright (c) 2025 Michael Starch
 // ======================================================================
 #include "FprimeExtras/Utilities/FileHelper/FileHelper.hpp"
+
+#include <cstring>
+#include <limits>
+
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define FILE_HELPER_BIG_ENDIAN_HOST 1
+#else
+#define FILE_HELPER_BIG_ENDIAN_HOST 0
+#endif
+
 namespace Utilities {
 namespace FileHelper {
 
+static_assert((Utilities::FILE_HELPER_STAGING_BUFFER_SIZE % sizeof(U64)) == 0,
+              "FILE_HELPER_STAGING_BUFFER_SIZE must be a multiple of 8 bytes");
+
+namespace {
+
+// Each element is loaded and stored through memcpy such that alignment is never assumed and in-place conversion is
+// safe. Compilers recognize the shifts as a byte swap, and the loops as vectorizable permutations.
+void swap16(U8* destination, const U8* source, FwSizeType count) {
+    for (FwSizeType i = 0; i < count; i++) {
+        U16 value;
+        ::memcpy(&value, source + (i * sizeof(U16)), sizeof(U16));
+        value = static_cast<U16>((value >> 8) | (value << 8));
+        ::memcpy(destination + (i * sizeof(U16)), &value, sizeof(U16));
+    }
+}
+
+void swap32(U8* destination, const U8* source, FwSizeType count) {
+    for (FwSizeType i = 0; i < count; i++) {
+        U32 value;
+        ::memcpy(&value, source + (i * sizeof(U32)), sizeof(U32));
+        value = ((value & 0x000000FFU) << 24) | ((value & 0x0000FF00U) << 8) | ((value & 0x00FF0000U) >> 8) |
+                ((value & 0xFF000000U) >> 24);
+        ::memcpy(destination + (i * sizeof(U32)), &value, sizeof(U32));
+    }
+}
+
+void swap64(U8* destination, const U8* source, FwSizeType count) {
+    for (FwSizeType i = 0; i < count; i++) {
+        U64 value;
+        ::memcpy(&value, source + (i * sizeof(U64)), sizeof(U64));
+        value = ((value & 0x00000000000000FFULL) << 56) | ((value & 0x000000000000FF00ULL) << 40) |
+                ((value & 0x0000000000FF0000ULL) << 24) | ((value & 0x00000000FF000000ULL) << 8) |
+                ((value & 0x000000FF00000000ULL) >> 8) | ((value & 0x0000FF0000000000ULL) >> 24) |
+                ((value & 0x00FF000000000000ULL) >> 40) | ((value & 0xFF00000000000000ULL) >> 56);
+        ::memcpy(destination + (i * sizeof(U64)), &value, sizeof(U64));
+    }
+}
+
+//! \brief check the arguments shared by the array functions, returning the total size in bytes
+FwSizeType checkArray(const U8* data, FwSizeType count, FwSizeType size) {
+    FW_ASSERT((size == 1) || (size == 2) || (size == 4) || (size == 8), static_cast<FwAssertArgType>(size));
+    FW_ASSERT((data != nullptr) || (count == 0));
+    FW_ASSERT(count <= (std::numeric_limits<FwSizeType>::max() / size), static_cast<FwAssertArgType>(count));
+    return count * size;
+}
+
+// The following are shared by Os::File and the buffered streams, which provide the same isOpen, write, and read
+
+template <typename S>
+Os::File::Status writeBuffer(S& file, const Fw::Buffer& buffer) {
+    FW_ASSERT(file.isOpen());
+    Os::File::Status status = Os::File::Status::OP_OK;
+    FwSizeType write_size = buffer.getSize();
+    if (buffer.isValid() && (write_size > 0)) {
+        status = file.write(buffer.getData(), write_size);
+    }
+    return status;
+}
+
+template <typename S>
+Os::File::Status readBuffer(S& file, Fw::Buffer& buffer) {
+    FW_ASSERT(file.isOpen());
+    Os::File::Status status = Os::File::Status::OP_OK;
+    FwSizeType read_size = buffer.getSize();
+    if (buffer.isValid() && (read_size > 0)) {
+        status = file.read(buffer.getData(), read_size);
+    }
+    // Check for fill read and if that failed, return BAD_SIZE
+    if ((status == Os::File::Status::OP_OK) && (read_size != buffer.getSize())) {
+        status = Os::File::Status::BAD_SIZE;
+    }
+    return status;
+}
+
+template <typename S>
+Os::File::Status writeElements(S& file, const U8* data, FwSizeType count, FwSizeType size) {
+    FW_ASSERT(file.isOpen());
+    const FwSizeType total = checkArray(data, count, size);
+    Os::File::Status status = Os::File::Status::OP_OK;
+    // Data already in big-endian order is written without staging
+    if ((FILE_HELPER_BIG_ENDIAN_HOST != 0) || (size == 1)) {
+        Fw::Buffer buffer(const_cast<U8*>(data), total);
+        return writeBuffer(file, buffer);
+    }
+    U8 staging[Utilities::FILE_HELPER_STAGING_BUFFER_SIZE];
+    const FwSizeType per_chunk = sizeof(staging) / size;
+    for (FwSizeType done = 0; (done < count) && (status == Os::File::Status::OP_OK);) {
+        const FwSizeType chunk = FW_MIN(per_chunk, count - done);
+        swapBigEndian(staging, data + (done * size), chunk, size);
+        Fw::Buffer buffer(staging, chunk * size);
+        status = writeBuffer(file, buffer);
+        done += chunk;
+    }
+    return status;
+}
+
+template <typename S>
+Os::File::Status readElements(S& file, U8* data, FwSizeType count, FwSizeType size) {
+    FW_ASSERT(file.isOpen());
+    const FwSizeType total = checkArray(data, count, size);
+    Fw::Buffer buffer(data, total);
+    Os::File::Status status = readBuffer(file, buffer);
+    if (status == Os::File::Status::OP_OK) {
+        swapBigEndian(data, data, count, size);
+    }
+    return status;
+}
+
+// CRC-fused transfers fold each piece into the CRC next to its read or write, while the piece is still in cache
+
+template <typename S>
+Os::File::Status writeBufferCrc32(S& file, const Fw::Buffer& buffer, U32& crc) {
+    FW_ASSERT(file.isOpen());
+    Os::File::Status status = Os::File::Status::OP_OK;
+    const FwSizeType total = buffer.isValid() ? buffer.getSize() : 0;
+    const U8* data = buffer.getData();
+    for (FwSizeType done = 0; (done < total) && (status == Os::File::Status::OP_OK);) {
+        FwSizeType chunk = FW_MIN(Utilities::FILE_HELPER_CRC_CHUNK_SIZE, total - done);
+        crc = crc32(data + done, chunk, crc);
+        status = file.write(data + done, chunk);
+        done += chunk;
+    }
+    return status;
+}
+
+template <typename S>
+Os::File::Status readBufferCrc32(S& file, Fw::Buffer& buffer, U32& crc) {
+    FW_ASSERT(file.isOpen());
+    Os::File::Status status = Os::File::Status::OP_OK;
+    const FwSizeType total = buffer.isValid() ? buffer.getSize() : 0;
+    U8* data = buffer.getData();
+    for (FwSizeType done = 0; (done < total) && (status == Os::File::Status::OP_OK);) {
+        const FwSizeType requested = FW_MIN(Utilities::FILE_HELPER_CRC_CHUNK_SIZE, total - done);
+        FwSizeType chunk = requested;
+        status = file.read(data + done, chunk);
+        if (status == Os::File::Status::OP_OK) {
+            crc = crc32(data + done, chunk, crc);
+            // Check for fill read and if that failed, return BAD_SIZE
+            status = (chunk == requested) ? status : Os::File::Status::BAD_SIZE;
+        }
+        done += chunk;
+    }
+    return status;
+}
+
+}  // namespace
+
 Os::File::Status writeToFile(const CHAR* filepath, const Fw::Buffer& buffer) {
     FW_ASSERT(filepath != nullptr);
     Os::File file;
@@ -20,13 +177,11 @@ Os::File::Status writeToFile(const CHAR* filepath, const Fw::Buffer& buffer) {
 }
 
 Os::File::Status writeToFile(Os::File& file, const Fw::Buffer& buffer) {
-    FW_ASSERT(file.isOpen());
-    Os::File::Status status = Os::File::Status::OP_OK;
-    FwSizeType write_size = buffer.getSize();
-    if (buffer.isValid() && (write_size > 0)) {
-        status = file.write(buffer.getData(), write_size);
-    }
-    return status;
+    return writeBuffer(file, buffer);
+}
+
+Os::File::Status writeToFile(BufferedWriter& writer, const Fw::Buffer& buffer) {
+    return writeBuffer(writer, buffer);
 }
 
 Os::File::Status readFromFile(const CHAR* filepath, Fw::Buffer& buffer) {
@@ -41,18 +196,92 @@ Os::File::Status readFromFile(const CHAR* filepath, Fw::Buffer& buffer) {
 }
 
 Os::File::Status readFromFile(Os::File& file, Fw::Buffer& buffer) {
-    FW_ASSERT(file.isOpen());
+    return readBuffer(file, buffer);
+}
+
+Os::File::Status readFromFile(BufferedReader& reader, Fw::Buffer& buffer) {
+    return readBuffer(reader, buffer);
+}
+
+Os::File::Status writeToFileCrc32(Os::File& file, const Fw::Buffer& buffer, U32& crc) {
+    return writeBufferCrc32(file, buffer, crc);
+}
+
+Os::File::Status writeToFileCrc32(BufferedWriter& writer, const Fw::Buffer& buffer, U32& crc) {
+    return writeBufferCrc32(writer, buffer, crc);
+}
+
+Os::File::Status readFromFileCrc32(Os::File& file, Fw::Buffer& buffer, U32& crc) {
+    return readBufferCrc32(file, buffer, crc);
+}
+
+Os::File::Status readFromFileCrc32(BufferedReader& reader, Fw::Buffer& buffer, U32& crc) {
+    return readBufferCrc32(reader, buffer, crc);
+}
+
+Os::File::Status copyFileCrc32(Os::File& source, Os::File& destination, FwSizeType size, U32& crc) {
+    FW_ASSERT(source.isOpen());
+    FW_ASSERT(destination.isOpen());
+    U8 staging[Utilities::FILE_HELPER_CRC_CHUNK_SIZE];
     Os::File::Status status = Os::File::Status::OP_OK;
-    FwSizeType read_size = buffer.getSize();
-    if (buffer.isValid() && (read_size > 0)) {
-        status = file.read(buffer.getData(), read_size);
+    for (FwSizeType done = 0; (done < size) && (status == Os::File::Status::OP_OK);) {
+        Fw::Buffer buffer(staging, FW_MIN(sizeof(staging), size - done));
+        status = readFromFileCrc32(source, buffer, crc);
+        if (status == Os::File::Status::OP_OK) {
+            status = writeToFile(destination, buffer);
+        }
+        done += buffer.getSize();
     }
-    // Check for fill read and if that failed, return BAD_SIZE
-    if ((status == Os::File::Status::OP_OK) && (read_size != buffer.getSize())) {
-        status = Os::File::Status::BAD_SIZE;
+    return status;
+}
+
+Os::File::Status crc32OfFile(const CHAR* filepath, U32& crc) {
+    FW_ASSERT(filepath != nullptr);
+    Os::File file;
+    crc = 0;
+    Os::File::Status status = file.open(filepath, Os::File::Mode::OPEN_READ);
+    U8 staging[Utilities::FILE_HELPER_CRC_CHUNK_SIZE];
+    FwSizeType chunk = sizeof(staging);
+    // The file is read until a read returns short, such that its size is never needed
+    while ((status == Os::File::Status::OP_OK) && (chunk == sizeof(staging))) {
+        status = file.read(staging, chunk);
+        crc = (status == Os::File::Status::OP_OK) ? crc32(staging, chunk, crc) : crc;
     }
+    file.close();
     return status;
 }
 
+void swapBigEndian(U8* destination, const U8* source, FwSizeType count, FwSizeType size) {
+    const FwSizeType total = checkArray(source, count, size);
+    FW_ASSERT((destination != nullptr) || (count == 0));
+    if ((FILE_HELPER_BIG_ENDIAN_HOST != 0) || (size == 1)) {
+        if (destination != source) {
+            ::memcpy(destination, source, static_cast<size_t>(total));
+        }
+    } else if (size == 2) {
+        swap16(destination, source, count);
+    } else if (size == 4) {
+        swap32(destination, source, count);
+    } else {
+        swap64(destination, source, count);
+    }
+}
+
+Os::File::Status writeBigEndian(Os::File& file, const U8* data, FwSizeType count, FwSizeType size) {
+    return writeElements(file, data, count, size);
+}
+
+Os::File::Status writeBigEndian(BufferedWriter& writer, const U8* data, FwSizeType count, FwSizeType size) {
+    return writeElements(writer, data, count, size);
+}
+
+Os::File::Status readBigEndian(Os::File& file, U8* data, FwSizeType count, FwSizeType size) {
+    return readElements(file, data, count, size);
+}
+
+Os::File::Status readBigEndian(BufferedReader& reader, U8* data, FwSizeType count, FwSizeType size) {
+    return readElements(reader, data, count, size);
+}
+
 }  // namespace FileHelper
 }  // namespace Utilities
\ No newline at end of file
@@ -8,6 +8,15 @@
 #define FprimeExtras_Utilities_FileHelper_HPP
 #include <type_traits>
 
+#include "ExtrasConfig/FileHelperConfig.hpp"
+#include "FprimeExtras/Utilities/FileHelper/AllocatedBuffer.hpp"
+#include "FprimeExtras/Utilities/FileHelper/BufferedReader.hpp"
+#include "FprimeExtras/Utilities/FileHelper/BufferedWriter.hpp"
+#include "FprimeExtras/Utilities/FileHelper/CopyFile.hpp"
+#include "FprimeExtras/Utilities/FileHelper/Crc32.hpp"
+#include "FprimeExtras/Utilities/FileHelper/FileDeserializer.hpp"
+#include "FprimeExtras/Utilities/FileHelper/FileSerializer.hpp"
+#include "FprimeExtras/Utilities/FileHelper/MappedFile.hpp"
 #include "Fw/Buffer/Buffer.hpp"
 #include "Fw/FPrimeBasicTypes.hpp"
 #include "Fw/Types/Assert.hpp"
@@ -23,15 +32,122 @@
 //
 // Note: in this file we choose to intercept the return type via SFINAE instead of adding an extra dummy template
 //       parameter. This is a style choice, both are valid ways to achieve the same goal.
+//
+// Templates taking an opened file accept an Os::File or a BufferedWriter / BufferedReader wrapping one, such that the
+// same overloads may batch many small writes and reads into large blocks.
+
+// SFINAE type for serializable types enabling the function only if T is derived from Fw::Serializable and S is a
+// writable file. Fw::Buffer is excluded as its contents are written by the dedicated Fw::Buffer overloads.
+#define T_SERIALIZABLE_WRITE_STATUS typename std::enable_if<IsWritableFile<S>::value && std::is_base_of<Fw::Serializable, T>::value && !std::is_same<T, Fw::Buffer>::value, Os::File::Status>::type
+
+// SFINAE type for primitive types enabling the function only if T is a fundamental type and S is a writable file
+#define T_PRIMITIVE_WRITE_STATUS typename std::enable_if<IsWritableFile<S>::value && std::is_fundamental<T>::value, Os::File::Status>::type
+
+// SFINAE type for serializable types enabling the function only if T is derived from Fw::Serializable and S is a
+// readable file. Fw::Buffer is excluded as its contents are read by the dedicated Fw::Buffer overloads.
+#define T_SERIALIZABLE_READ_STATUS typename std::enable_if<IsReadableFile<S>::value && std::is_base_of<Fw::Serializable, T>::value && !std::is_same<T, Fw::Buffer>::value, Os::File::Status>::type
 
-// SFINAE type for serializable types enabling the function only if T is derived from Fw::Serializable
-#define T_SERIALIZABLE_FW_STATUS typename std::enable_if<std::is_base_of<Fw::Serializable, T>::value, Os::File::Status>::type
+// SFINAE type for primitive types enabling the function only if T is a fundamental type and S is a readable file
+#define T_PRIMITIVE_READ_STATUS typename std::enable_if<IsReadableFile<S>::value && std::is_fundamental<T>::value, Os::File::Status>::type
 
-// SFINAE type for primitive types enabling the function only if T is a fundamental type
+// Former names of the SFINAE types above, from before the file type was checked, kept for code outside fprime-extras.
+// S need not be in scope where these are used, so they apply the T conditions of the types above alone and serve both
+// reads and writes.
+#define T_SERIALIZABLE_FW_STATUS typename std::enable_if<std::is_base_of<Fw::Serializable, T>::value && !std::is_same<T, Fw::Buffer>::value, Os::File::Status>::type
 #define T_PRIMITIVE_FW_STATUS typename std::enable_if<std::is_fundamental<T>::value, Os::File::Status>::type
+
+// SFINAE types enabling the function only if S is a writable or readable file respectively
+#define S_WRITE_STATUS typename std::enable_if<IsWritableFile<S>::value, Os::File::Status>::type
+#define S_READ_STATUS typename std::enable_if<IsReadableFile<S>::value, Os::File::Status>::type
+
+// SFINAE type enabling the function only if T is a fundamental type or is derived from Fw::Serializable, excluding
+// Fw::Buffer
+#define T_MAPPED_READ_STATUS typename std::enable_if<std::is_fundamental<T>::value || (std::is_base_of<Fw::Serializable, T>::value && !std::is_same<T, Fw::Buffer>::value), Os::File::Status>::type
 namespace Utilities {
 namespace FileHelper {
 
+//! \brief true when S may be written by the writeToFile and writeArray templates: Os::File or a BufferedWriter
+template <typename S>
+struct IsWritableFile : std::integral_constant<bool,
+                                               std::is_same<Os::File, S>::value ||
+                                                   std::is_base_of<BufferedWriter, S>::value> {};
+
+//! \brief true when S may be read by the readFromFile and readArray templates: Os::File or a BufferedReader
+template <typename S>
+struct IsReadableFile : std::integral_constant<bool,
+                                               std::is_same<Os::File, S>::value ||
+                                                   std::is_base_of<BufferedReader, S>::value> {};
+
+//! \brief serialized size of a fundamental or Fw::Serializable type, known at compile time
+//!
+//! Fundamental types serialize to sizeof(T) bytes and serializables to T::SERIALIZED_SIZE bytes. Other types have no
+//! serialized size and fail to compile.
+template <typename T, typename Enable = void>
+struct SerializedSize;
+
+template <typename T>
+struct SerializedSize<T, typename std::enable_if<std::is_fundamental<T>::value>::type> {
+    static constexpr FwSizeType value = sizeof(T);
+};
+
+template <typename T>
+struct SerializedSize<T, typename std::enable_if<std::is_base_of<Fw::Serializable, T>::value>::type> {
+    static constexpr FwSizeType value = T::SERIALIZED_SIZE;
+};
+
+//! \brief combined serialized size of a list of fundamental and Fw::Serializable types, known at compile time
+template <typename... Ts>
+struct TotalSerializedSize;
+
+template <>
+struct TotalSerializedSize<> {
+    static constexpr FwSizeType value = 0;
+};
+
+template <typename T, typename... Rest>
+struct TotalSerializedSize<T, Rest...> {
+    static constexpr FwSizeType value = SerializedSize<T>::value + TotalSerializedSize<Rest...>::value;
+};
+
+//! \brief serialize nothing, ending the recursion of the variadic serializeAll
+inline void serializeAll(Fw::SerialBufferBase& serializer) {
+    (void)serializer;
+}
+
+//! \brief serialize each object in order into serializer
+//!
+//! \warning serializer must hold TotalSerializedSize of the objects, otherwise an assertion failure results.
+template <typename T, typename... Rest>
+void serializeAll(Fw::SerialBufferBase& serializer, const T& first, const Rest&... rest) {
+    Fw::SerializeStatus serializeStatus = serializer.serializeFrom(first);
+    FW_ASSERT(serializeStatus == Fw::SerializeStatus::FW_SERIALIZE_OK, static_cast<FwAssertArgType>(serializeStatus));
+    serializeAll(serializer, rest...);
+}
+
+//! \brief deserialize nothing, ending the recursion of the variadic deserializeAll
+inline Fw::SerializeStatus deserializeAll(Fw::SerialBufferBase& deserializer) {
+    (void)deserializer;
+    return Fw::SerializeStatus::FW_SERIALIZE_OK;
+}
+
+//! \brief deserialize each object in order from deserializer, updating the objects only when all succeed
+//!
+//! Each object is deserialized into a temporary of its type, which is assigned to the object once every later object
+//! has also been deserialized. On failure no object is updated. Each type must be default-constructible and
+//! copy-assignable.
+template <typename T, typename... Rest>
+Fw::SerializeStatus deserializeAll(Fw::SerialBufferBase& deserializer, T& first, Rest&... rest) {
+    T value;
+    Fw::SerializeStatus serializeStatus = deserializer.deserializeTo(value);
+    if (serializeStatus == Fw::SerializeStatus::FW_SERIALIZE_OK) {
+        serializeStatus = deserializeAll(deserializer, rest...);
+    }
+    if (serializeStatus == Fw::SerializeStatus::FW_SERIALIZE_OK) {
+        first = value;
+    }
+    return serializeStatus;
+}
+
 //! \brief write buffer to file specified by path
 //!
 //! Writes a buffer to the file specified by filepath. If the file already exists, it will be overwritten clearing
@@ -61,27 +177,68 @@ Os::File::Status writeToFile(const CHAR* filepath, const Fw::Buffer& buffer);
 //! \return status of the file write operation
 Os::File::Status writeToFile(Os::File& file, const Fw::Buffer& buffer);
 
+//! \brief write buffer to file through a buffered writer
+//!
+//! Behaves as writeToFile(Os::File&, const Fw::Buffer&) with the buffer written through writer.
+//!
+//! \param writer The buffered writer of an opened file to write to.
+//! \param buffer The buffer to write to the file.
+//! \return status of the file write operation
+Os::File::Status writeToFile(BufferedWriter& writer, const Fw::Buffer& buffer);
+
+//! \brief write serializable to file through an exact size stack buffer
+template <typename T, typename S>
+Os::File::Status writeSerializable(S& file, const T& serializable, std::false_type) {
+    // Allocate exact size buffer for serialization
+    U8 buffer_data[T::SERIALIZED_SIZE];
+    Fw::Buffer buffer(buffer_data, T::SERIALIZED_SIZE);
+    Fw::SerializeStatus serializeStatus = buffer.getSerializer().serializeFrom(serializable);
+    FW_ASSERT(serializeStatus == Fw::SerializeStatus::FW_SERIALIZE_OK);
+
+    return FileHelper ::writeToFile(file, buffer);
+}
+
+//! \brief write serializable to file through a FileSerializer with constant stack use
+//!
+//! The serializable is padded to T::SERIALIZED_SIZE bytes such that the file contents match the stack buffer version.
+template <typename T, typename S>
+Os::File::Status writeSerializable(S& file, const T& serializable, std::true_type) {
+    FileSerializer serializer(file);
+    Fw::SerializeStatus serializeStatus = serializer.serializeFrom(serializable);
+    while ((serializeStatus == Fw::SerializeStatus::FW_SERIALIZE_OK) &&
+           (serializer.getSerializedSize() < T::SERIALIZED_SIZE)) {
+        serializeStatus = serializer.serializeFrom(static_cast<U8>(0));
+    }
+    Os::File::Status status = serializer.flush();
+    // Serialization only stops early when a write fails
+    FW_ASSERT((serializeStatus == Fw::SerializeStatus::FW_SERIALIZE_OK) || (status != Os::File::Status::OP_OK),
+              static_cast<FwAssertArgType>(serializeStatus));
+    return status;
+}
+
 //! \brief write serializable to file (template version)
 //!
 //! Writes a serializable to an already opened file. The file must be opened in a mode that allows writing. The file
 //! is updated with the contents of the serialized serializable from its current position.
 //!
+//! Serializables with a SERIALIZED_SIZE of at most FILE_HELPER_SERIAL_STAGING_SIZE are serialized into a stack buffer
+//! of that size and written at once. Larger serializables are streamed to the file through a FileSerializer, keeping
+//! stack use constant. Either way T::SERIALIZED_SIZE bytes are written.
+//!
 //! \warning It is invalid to call this function on a file that is not open and results in an assertion failure.
 //!
 //! \tparam T type of the serializable.  Must be subclass of Fw::Serializable.
+//! \tparam S type of the file. Must be Os::File or a BufferedWriter.
 //! \param file The file to write to, must be opened.
 //! \param serializable The serializable to write to a file. Must implement Fw::Serializable interface.
 //! \return status of the file write operation
-template <typename T>
-T_SERIALIZABLE_FW_STATUS writeToFile(Os::File& file, const T& serializable) {
+template <typename T, typename S>
+T_SERIALIZABLE_WRITE_STATUS writeToFile(S& file, const T& serializable) {
     FW_ASSERT(file.isOpen());
-    // Allocate exact size buffer for serialization
-    U8 buffer_data[T::SERIALIZED_SIZE];
-    Fw::Buffer buffer(buffer_data, T::SERIALIZED_SIZE);
-    Fw::SerializeStatus serializeStatus = buffer.getSerializer().serializeFrom(serializable);
-    FW_ASSERT(serializeStatus == Fw::SerializeStatus::FW_SERIALIZE_OK);
-
-    return FileHelper ::writeToFile(file, buffer);
+    // Serializables larger than the staging buffer are streamed to the file rather than held on the stack
+    return FileHelper ::writeSerializable(
+        file, serializable,
+        std::integral_constant<bool, (T::SERIALIZED_SIZE > Utilities::FILE_HELPER_SERIAL_STAGING_SIZE)>());
 }
 
 //! \brief write primitive to file (template version)
@@ -92,11 +249,12 @@ T_SERIALIZABLE_FW_STATUS writeToFile(Os::File& file, const T& serializable) {
 //! \warning It is invalid to call this function on a file that is not open and results in an assertion failure.
 //!
 //! \tparam T type of the primitive. Must be fundamental.
+//! \tparam S type of the file. Must be Os::File or a BufferedWriter.
 //! \param filepath The file to write to, must be opened.
 //! \param primitive The variable to write as the entire contents of the file
 //! \return status of the file write operation
-template <typename T>
-T_PRIMITIVE_FW_STATUS writeToFile(Os::File& file, T primitive) {
+template <typename T, typename S>
+T_PRIMITIVE_WRITE_STATUS writeToFile(S& file, T primitive) {
     static_assert(std::is_fundamental<T>::value == true,
                   "FileHelper::writeBuffer can only be used with fundamental and Fw::Serializable types");
     FW_ASSERT(file.isOpen());
@@ -109,6 +267,36 @@ T_PRIMITIVE_FW_STATUS writeToFile(Os::File& file, T primitive) {
     return FileHelper ::writeToFile(file, buffer);
 }
 
+//! \brief write several serializables/primitives to file with a single write (variadic template version)
+//!
+//! Writes each object in order to an already opened file. The file must be opened in a mode that allows writing. The
+//! objects are serialized back-to-back into one stack buffer sized at compile time, and the buffer is written with a
+//! single call to write. The file contents are identical to writing each object in turn.
+//!
+//! \warning It is invalid to call this function on a file that is not open and results in an assertion failure.
+//!
+//! \tparam S type of the file. Must be Os::File or a BufferedWriter.
+//! \tparam T1 type of the first object. Must be fundamental or a subclass of Fw::Serializable.
+//! \tparam T2 type of the second object. Must be fundamental or a subclass of Fw::Serializable.
+//! \tparam Rest types of any further objects. Each must be fundamental or a subclass of Fw::Serializable.
+//! \param file The file to write to, must be opened.
+//! \param first The first object to write.
+//! \param second The second object to write.
+//! \param rest Any further objects to write.
+//! \return status of the file write operation
+template <typename S, typename T1, typename T2, typename... Rest>
+S_WRITE_STATUS writeToFile(S& file, const T1& first, const T2& second, const Rest&... rest) {
+    FW_ASSERT(file.isOpen());
+    // Allocate exact size buffer for serialization of all objects
+    constexpr FwSizeType size = TotalSerializedSize<T1, T2, Rest...>::value;
+    U8 buffer_data[size];
+    Fw::Buffer buffer(buffer_data, size);
+    auto serializer = buffer.getSerializer();
+    serializeAll(serializer, first, second, rest...);
+
+    return FileHelper ::writeToFile(file, buffer);
+}
+
 //! \brief write serializable/primitive to file (template version)
 //!
 //! Writes a serializable object or primitive to the file specified by filepath. If the file already exists, it
@@ -159,21 +347,18 @@ Os::File::Status readFromFile(const CHAR* filepath, Fw::Buffer& buffer);
 //! \return status of the file write operation
 Os::File::Status readFromFile(Os::File& file, Fw::Buffer& buffer);
 
-//! \brief read serializable from file (template version)
-//!
-//! Reads a serializable from an already opened file. The file must be opened in a mode that allows reading. The
-//! serializable is deserialized from the contents of the file from its current position. Only the firs
-//! serializable is read and ana error is returned on insufficent size.
+//! \brief read buffer from file through a buffered reader
 //!
-//! \warning It is invalid to call this function on a file that is not open and results in an assertion failure.
+//! Behaves as readFromFile(Os::File&, Fw::Buffer&) with the buffer read through reader.
 //!
-//! \tparam T type of serializable. Must derive from Fw::Serializable.
-//! \param file The file to read from, must be opened.
-//! \param serializable The serializable to write to a file. Must implement Fw::Serializable interface.
-//! \return status of the file write operation
-template <typename T>
-T_SERIALIZABLE_FW_STATUS readFromFile(Os::File& file, T& serializable) {
-    FW_ASSERT(file.isOpen());
+//! \param reader The buffered reader of an opened file to read from.
+//! \param buffer The buffer to read into.
+//! \return status of the file read operation
+Os::File::Status readFromFile(BufferedReader& reader, Fw::Buffer& buffer);
+
+//! \brief read serializable from file through an exact size stack buffer
+template <typename T, typename S>
+Os::File::Status readSerializable(S& file, T& serializable, std::false_type) {
     // Allocate exact size buffer for serialization
     U8 buffer_data[T::SERIALIZED_SIZE];
     Fw::Buffer buffer(buffer_data, T::SERIALIZED_SIZE);
@@ -189,6 +374,51 @@ T_SERIALIZABLE_FW_STATUS readFromFile(Os::File& file, T& serializable) {
     return status;
 }
 
+//! \brief read serializable from file through a FileDeserializer with constant stack use
+//!
+//! Exactly T::SERIALIZED_SIZE bytes are consumed from the file, matching the stack buffer version. Unlike that version,
+//! the serializable may be partially updated when an error is returned.
+template <typename T, typename S>
+Os::File::Status readSerializable(S& file, T& serializable, std::true_type) {
+    FileDeserializer deserializer(file, T::SERIALIZED_SIZE);
+    Fw::SerializeStatus serializeStatus = deserializer.deserializeTo(serializable);
+    Os::File::Status status = deserializer.finish();
+    if (status == Os::File::Status::OP_OK) {
+        if (serializeStatus == Fw::SerializeStatus::FW_DESERIALIZE_BUFFER_EMPTY) {
+            status = Os::File::Status::BAD_SIZE;
+        } else if (serializeStatus != Fw::SerializeStatus::FW_SERIALIZE_OK) {
+            status = Os::File::Status::OTHER_ERROR;
+        }
+    }
+    return status;
+}
+
+//! \brief read serializable from file (template version)
+//!
+//! Reads a serializable from an already opened file. The file must be opened in a mode that allows reading. The
+//! serializable is deserialized from the contents of the file from its current position. Only the firs
+//! serializable is read and ana error is returned on insufficent size.
+//!
+//! Serializables with a SERIALIZED_SIZE of at most FILE_HELPER_SERIAL_STAGING_SIZE are read into a stack buffer of
+//! that size at once. Larger serializables are streamed from the file through a FileDeserializer, keeping stack use
+//! constant. Either way T::SERIALIZED_SIZE bytes are consumed.
+//!
+//! \warning It is invalid to call this function on a file that is not open and results in an assertion failure.
+//!
+//! \tparam T type of serializable. Must derive from Fw::Serializable.
+//! \tparam S type of the file. Must be Os::File or a BufferedReader.
+//! \param file The file to read from, must be opened.
+//! \param serializable The serializable to write to a file. Must implement Fw::Serializable interface.
+//! \return status of the file write operation
+template <typename T, typename S>
+T_SERIALIZABLE_READ_STATUS readFromFile(S& file, T& serializable) {
+    FW_ASSERT(file.isOpen());
+    // Serializables larger than the staging buffer are streamed from the file rather than held on the stack
+    return FileHelper ::readSerializable(
+        file, serializable,
+        std::integral_constant<bool, (T::SERIALIZED_SIZE > Utilities::FILE_HELPER_SERIAL_STAGING_SIZE)>());
+}
+
 //! \brief read primitive from file (template version)
 //!
 //! Reads a primitive from an already opened file. The file must be opened in a mode that allows reading. The
@@ -200,11 +430,12 @@ T_SERIALIZABLE_FW_STATUS readFromFile(Os::File& file, T& serializable) {
 //! \warning It is invalid to call this function on a file that is not open and results in an assertion failure.
 //!
 //! \tparam T object type to read, must be fundamental.
+//! \tparam S type of the file. Must be Os::File or a BufferedReader.
 //! \param filepath The file to write to, must be opened.
 //! \param primitive The variable to write as the entire contents of the file
 //! \return status of the file write operation
-template <typename T>
-T_PRIMITIVE_FW_STATUS readFromFile(Os::File& file, T& primitive) {
+template <typename T, typename S>
+T_PRIMITIVE_READ_STATUS readFromFile(S& file, T& primitive) {
     static_assert(std::is_fundamental<T>::value,
                   "FileHelper::readBuffer can only be used with fundamental and Fw::Serializable types");
     FW_ASSERT(file.isOpen());
@@ -223,6 +454,45 @@ T_PRIMITIVE_FW_STATUS readFromFile(Os::File& file, T& primitive) {
     return status;
 }
 
+//! \brief read several serializables/primitives from file with a single read (variadic template version)
+//!
+//! Reads each object in order from an already opened file. The file must be opened in a mode that allows reading.
+//! The combined size of the objects, known at compile time, is read into one stack buffer with a single call to read
+//! and the objects are then deserialized from it in order. An error is returned on insufficient size or when any object
+//! fails to deserialize, in which case no object is updated.
+//!
+//! \warning It is invalid to call this function on a file that is not open and results in an assertion failure.
+//!
+//! \tparam S type of the file. Must be Os::File or a BufferedReader.
+//! \tparam T1 type of the first object. Must be fundamental or a default-constructible, copy-assignable subclass of
+//!         Fw::Serializable.
+//! \tparam T2 type of the second object. Same requirements as T1.
+//! \tparam Rest types of any further objects. Same requirements as T1.
+//! \param file The file to read from, must be opened.
+//! \param first The first object to read.
+//! \param second The second object to read.
+//! \param rest Any further objects to read.
+//! \return status of the file read operation
+template <typename S, typename T1, typename T2, typename... Rest>
+S_READ_STATUS readFromFile(S& file, T1& first, T2& second, Rest&... rest) {
+    FW_ASSERT(file.isOpen());
+    // Allocate exact size buffer for deserialization of all objects
+    constexpr FwSizeType size = TotalSerializedSize<T1, T2, Rest...>::value;
+    U8 buffer_data[size];
+    Fw::Buffer buffer(buffer_data, size);
+    Os::File::Status status = Utilities::FileHelper::readFromFile(file, buffer);
+    if (status == Os::File::Status::OP_OK) {
+        auto deserializer = buffer.getDeserializer();
+        Fw::SerializeStatus serializeStatus = deserializeAll(deserializer, first, second, rest...);
+        if (serializeStatus == Fw::SerializeStatus::FW_DESERIALIZE_BUFFER_EMPTY) {
+            status = Os::File::Status::BAD_SIZE;
+        } else if (serializeStatus != Fw::SerializeStatus::FW_SERIALIZE_OK) {
+            status = Os::File::Status::OTHER_ERROR;
+        }
+    }
+    return status;
+}
+
 //! \brief read serializable/primitive to file (template version)
 //!
 //! Reads a serializable object or primitive to the file specified by filepath. Only the first object is read from
@@ -245,6 +515,210 @@ Os::File::Status readFromFile(const CHAR* filepath, T& object) {
     return status;
 }
 
+//! \brief read serializable/primitive from a mapped file (template version)
+//!
+//! Deserializes an object in place from the contents of a mapped file, starting offset bytes into the file, without
+//! copying the file contents. The object occupies the same number of bytes as written by writeToFile,
+//! T::SERIALIZED_SIZE for serializables and sizeof(T) for primitives, and offset is advanced past it on success such
+//! that consecutive objects are read in turn. An error is returned on insufficient size, leaving offset unchanged.
+//!
+//! \warning It is invalid to call this function on a mapping that is not open and results in an assertion failure.
+//!
+//! \tparam T the object type to read. Must be fundamental or derive from Fw::Serializable.
+//! \param mapping The mapped file to read from, must be opened.
+//! \param offset The offset of the object in the file, advanced past the object on success.
+//! \param object The object to read.
+//! \return status of the read operation
+template <typename T>
+T_MAPPED_READ_STATUS readFromFile(const MappedFile& mapping, FwSizeType& offset, T& object) {
+    FW_ASSERT(mapping.isOpen());
+    constexpr FwSizeType size = SerializedSize<T>::value;
+    if ((offset > mapping.getSize()) || (size > (mapping.getSize() - offset))) {
+        return Os::File::Status::BAD_SIZE;
+    }
+    Fw::Buffer buffer = mapping.getBuffer(offset, size);
+    Os::File::Status status = Os::File::Status::OP_OK;
+    Fw::SerializeStatus serializeStatus = buffer.getDeserializer().deserializeTo(object);
+    if (serializeStatus == Fw::SerializeStatus::FW_DESERIALIZE_BUFFER_EMPTY) {
+        status = Os::File::Status::BAD_SIZE;
+    } else if (serializeStatus != Fw::SerializeStatus::FW_SERIALIZE_OK) {
+        status = Os::File::Status::OTHER_ERROR;
+    } else {
+        offset += size;
+    }
+    return status;
+}
+
+//! \brief convert elements between host byte order and big-endian byte order
+//!
+//! Copies count elements of size bytes each from source to destination, reversing the bytes of each element on
+//! little-endian hosts. The conversion is its own inverse and so converts in either direction. On big-endian hosts the
+//! elements are copied unchanged. source and destination may be the same to convert in-place but must not otherwise
+//! overlap.
+//!
+//! \warning It is invalid to supply a size other than 1, 2, 4, or 8, or null data with a non-zero count, and results
+//!          in an assertion failure.
+//!
+//! \param destination storage of count elements receiving the converted elements
+//! \param source storage of count elements to convert
+//! \param count number of elements
+//! \param size size of each element in bytes
+void swapBigEndian(U8* destination, const U8* source, FwSizeType count, FwSizeType size);
+
+//! \brief write an array of elements to file in big-endian byte order
+//!
+//! Writes count elements of size bytes each, converting them to big-endian byte order. On little-endian hosts the
+//! elements are converted through a stack buffer of FILE_HELPER_STAGING_BUFFER_SIZE bytes, one write per filled
+//! buffer. On big-endian hosts the elements are written directly with a single write.
+//!
+//! \warning It is invalid to call this function on a file that is not open, with a size other than 1, 2, 4, or 8, or
+//!          with null data and a non-zero count, and results in an assertion failure.
+//!
+//! \param file The file to write to, must be opened.
+//! \param data storage of the elements in host byte order
+//! \param count number of elements to write
+//! \param size size of each element in bytes
+//! \return status of the file write operation
+Os::File::Status writeBigEndian(Os::File& file, const U8* data, FwSizeType count, FwSizeType size);
+
+//! \brief write an array of elements in big-endian byte order through a buffered writer
+//!
+//! Behaves as writeBigEndian(Os::File&, ...) with the converted elements written through writer.
+Os::File::Status writeBigEndian(BufferedWriter& writer, const U8* data, FwSizeType count, FwSizeType size);
+
+//! \brief read an array of elements from file in big-endian byte order
+//!
+//! Reads count elements of size bytes each with a single read directly into data, then converts them to host byte
+//! order in-place. An error is returned on insufficient size, in which case the contents of data are unspecified.
+//!
+//! \warning It is invalid to call this function on a file that is not open, with a size other than 1, 2, 4, or 8, or
+//!          with null data and a non-zero count, and results in an assertion failure.
+//!
+//! \param file The file to read from, must be opened.
+//! \param data storage receiving the elements in host byte order
+//! \param count number of elements to read
+//! \param size size of each element in bytes
+//! \return status of the file read operation
+Os::File::Status readBigEndian(Os::File& file, U8* data, FwSizeType count, FwSizeType size);
+
+//! \brief read an array of elements in big-endian byte order through a buffered reader
+//!
+//! Behaves as readBigEndian(Os::File&, ...) with the elements read through reader.
+Os::File::Status readBigEndian(BufferedReader& reader, U8* data, FwSizeType count, FwSizeType size);
+
+//! \brief write buffer to file, folding the data written into a CRC32
+//!
+//! Behaves as writeToFile(Os::File&, const Fw::Buffer&), but writes the buffer in pieces of FILE_HELPER_CRC_CHUNK_SIZE
+//! bytes and folds each piece into crc just before it is written, while it is still in cache. The CRC is thereby
+//! computed in the same pass as the write rather than by reading the data again.
+//!
+//! \warning It is invalid to call this function on a file that is not open and results in an assertion failure.
+//!
+//! \param file The file to write to, must be opened.
+//! \param buffer The data to write.
+//! \param crc CRC of the data preceding this data (see crc32), updated to include the data written
+//! \return status of the file write operation
+Os::File::Status writeToFileCrc32(Os::File& file, const Fw::Buffer& buffer, U32& crc);
+
+//! \brief write buffer through a buffered writer, folding the data written into a CRC32
+//!
+//! Behaves as writeToFileCrc32(Os::File&, ...) with the data written through writer.
+Os::File::Status writeToFileCrc32(BufferedWriter& writer, const Fw::Buffer& buffer, U32& crc);
+
+//! \brief fill buffer from file, folding the data read into a CRC32
+//!
+//! Behaves as readFromFile(Os::File&, Fw::Buffer&), but reads the buffer in pieces of FILE_HELPER_CRC_CHUNK_SIZE bytes
+//! and folds each piece into crc just after it is read, while it is still in cache. Bytes read before a short read are
+//! included in crc.
+//!
+//! \warning It is invalid to call this function on a file that is not open and results in an assertion failure.
+//!
+//! \param file The file to read from, must be opened.
+//! \param buffer The buffer to fill.
+//! \param crc CRC of the data preceding this data (see crc32), updated to include the data read
+//! \return status of the file read operation, BAD_SIZE when the file ends before the buffer is filled
+Os::File::Status readFromFileCrc32(Os::File& file, Fw::Buffer& buffer, U32& crc);
+
+//! \brief fill buffer through a buffered reader, folding the data read into a CRC32
+//!
+//! Behaves as readFromFileCrc32(Os::File&, ...) with the data read through reader.
+Os::File::Status readFromFileCrc32(BufferedReader& reader, Fw::Buffer& buffer, U32& crc);
+
+//! \brief copy size bytes from source to destination, folding the data copied into a CRC32
+//!
+//! Copies from the current position of source to the current position of destination through a stack buffer of
+//! FILE_HELPER_CRC_CHUNK_SIZE bytes, folding each piece into crc between its read and its write. A copy can thereby be
+//! verified against an expected CRC without reading either file a second time.
+//!
+//! \warning It is invalid to call this function with a file that is not open and results in an assertion failure.
+//!
+//! \param source The file to copy from, must be opened for reading.
+//! \param destination The file to copy to, must be opened for writing.
+//! \param size Number of bytes to copy.
+//! \param crc CRC of the data preceding this data (see crc32), updated to include the data copied
+//! \return status of the copy, BAD_SIZE when source ends before size bytes are copied
+Os::File::Status copyFileCrc32(Os::File& source, Os::File& destination, FwSizeType size, U32& crc);
+
+//! \brief compute the CRC32 of the entire file specified by filepath
+//!
+//! Reads the file through a stack buffer of FILE_HELPER_CRC_CHUNK_SIZE bytes. The result matches crc32 over the file
+//! contents.
+//!
+//! \warning It is invalid to call this function with a null filepath and results in an assertion failure.
+//!
+//! \param filepath The path to the file.
+//! \param crc Set to the CRC32 of the file contents.
+//! \return status of the file read operation
+Os::File::Status crc32OfFile(const CHAR* filepath, U32& crc);
+
+//! \brief write array of primitives to file (template version)
+//!
+//! Writes a contiguous array of primitives to an already opened file. The file must be opened in a mode that allows
+//! writing. The file contents are identical to writing each primitive in turn with writeToFile, but the elements are
+//! converted to big-endian in bulk and written a staging buffer at a time rather than one write per element.
+//!
+//! \warning It is invalid to call this function on a file that is not open or with null data and a non-zero count, and
+//!          results in an assertion failure.
+//!
+//! \tparam T type of the primitives. Must be fundamental, other than bool, and 1, 2, 4, or 8 bytes in size.
+//! \tparam S type of the file. Must be Os::File or a BufferedWriter.
+//! \param file The file to write to, must be opened.
+//! \param data The array of primitives to write.
+//! \param count The number of primitives in the array.
+//! \return status of the file write operation
+template <typename T, typename S>
+T_PRIMITIVE_WRITE_STATUS writeArray(S& file, const T* data, FwSizeType count) {
+    // bool is serialized as a single byte of 0xFF or 0x00, not its in-memory representation
+    static_assert(!std::is_same<T, bool>::value, "FileHelper::writeArray cannot be used with bool");
+    static_assert((sizeof(T) == 1) || (sizeof(T) == 2) || (sizeof(T) == 4) || (sizeof(T) == 8),
+                  "FileHelper::writeArray can only be used with 1, 2, 4, or 8 byte types");
+    return FileHelper ::writeBigEndian(file, reinterpret_cast<const U8*>(data), count, sizeof(T));
+}
+
+//! \brief read array of primitives from file (template version)
+//!
+//! Reads a contiguous array of primitives from an already opened file. The file must be opened in a mode that allows
+//! reading. The array is filled with the contents of the file from its current position with a single read and then
+//! converted from big-endian in-place. An error is returned on insufficient size.
+//!
+//! \warning It is invalid to call this function on a file that is not open or with null data and a non-zero count, and
+//!          results in an assertion failure.
+//!
+//! \tparam T type of the primitives. Must be fundamental, other than bool, and 1, 2, 4, or 8 bytes in size.
+//! \tparam S type of the file. Must be Os::File or a BufferedReader.
+//! \param file The file to read from, must be opened.
+//! \param data The array of primitives to fill.
+//! \param count The number of primitives in the array.
+//! \return status of the file read operation
+template <typename T, typename S>
+T_PRIMITIVE_READ_STATUS readArray(S& file, T* data, FwSizeType count) {
+    // bool is serialized as a single byte of 0xFF or 0x00, not its in-memory representation
+    static_assert(!std::is_same<T, bool>::value, "FileHelper::readArray cannot be used with bool");
+    static_assert((sizeof(T) == 1) || (sizeof(T) == 2) || (sizeof(T) == 4) || (sizeof(T) == 8),
+                  "FileHelper::readArray can only be used with 1, 2, 4, or 8 byte types");
+    return FileHelper ::readBigEndian(file, reinterpret_cast<U8*>(data), count, sizeof(T));
+}
+
 }  // namespace FileHelper
 }  // namespace Utilities
 
@@ -0,0 +1,150 @@
+// ======================================================================
+// \title  FileSerializer.cpp
+// \author starchmd
+// \brief  cpp file for FileHelper serialization directly to a file
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#include "FprimeExtras/Utilities/FileHelper/FileSerializer.hpp"
+#include "Fw/Types/Assert.hpp"
+
+namespace Utilities {
+namespace FileHelper {
+
+static_assert(Utilities::FILE_HELPER_SERIAL_STAGING_SIZE >= sizeof(U64),
+              "FILE_HELPER_SERIAL_STAGING_SIZE must hold the largest primitive");
+
+FileSerializer ::FileSerializer(Os::File& file)
+    : Fw::ExternalSerializeBuffer(m_staging, sizeof(m_staging)),
+      m_file(&file),
+      m_writer(nullptr),
+      m_fileStatus(Os::File::Status::OP_OK),
+      m_written(0) {}
+
+FileSerializer ::FileSerializer(BufferedWriter& writer)
+    : Fw::ExternalSerializeBuffer(m_staging, sizeof(m_staging)),
+      m_file(nullptr),
+      m_writer(&writer),
+      m_fileStatus(Os::File::Status::OP_OK),
+      m_written(0) {}
+
+FileSerializer ::~FileSerializer() {
+    (void)this->flush();
+}
+
+Fw::SerializeStatus FileSerializer ::serializeFrom(U8 val, Fw::Endianness mode) {
+    return this->serializePrimitive(val, mode);
+}
+
+Fw::SerializeStatus FileSerializer ::serializeFrom(I8 val, Fw::Endianness mode) {
+    return this->serializePrimitive(val, mode);
+}
+
+Fw::SerializeStatus FileSerializer ::serializeFrom(U16 val, Fw::Endianness mode) {
+    return this->serializePrimitive(val, mode);
+}
+
+Fw::SerializeStatus FileSerializer ::serializeFrom(I16 val, Fw::Endianness mode) {
+    return this->serializePrimitive(val, mode);
+}
+
+Fw::SerializeStatus FileSerializer ::serializeFrom(U32 val, Fw::Endianness mode) {
+    return this->serializePrimitive(val, mode);
+}
+
+Fw::SerializeStatus FileSerializer ::serializeFrom(I32 val, Fw::Endianness mode) {
+    return this->serializePrimitive(val, mode);
+}
+
+Fw::SerializeStatus FileSerializer ::serializeFrom(U64 val, Fw::Endianness mode) {
+    return this->serializePrimitive(val, mode);
+}
+
+Fw::SerializeStatus FileSerializer ::serializeFrom(I64 val, Fw::Endianness mode) {
+    return this->serializePrimitive(val, mode);
+}
+
+Fw::SerializeStatus FileSerializer ::serializeFrom(F32 val, Fw::Endianness mode) {
+    return this->serializePrimitive(val, mode);
+}
+
+Fw::SerializeStatus FileSerializer ::serializeFrom(F64 val, Fw::Endianness mode) {
+    return this->serializePrimitive(val, mode);
+}
+
+Fw::SerializeStatus FileSerializer ::serializeFrom(bool val, Fw::Endianness mode) {
+    return this->serializePrimitive(val, mode);
+}
+
+Fw::SerializeStatus FileSerializer ::serializeFrom(const U8* buff,
+                                                   FwSizeType length,
+                                                   Fw::Serialization::t lengthMode,
+                                                   Fw::Endianness endianMode) {
+    FW_ASSERT((buff != nullptr) || (length == 0));
+    if (lengthMode == Fw::Serialization::INCLUDE_LENGTH) {
+        Fw::SerializeStatus status = this->serializeFrom(static_cast<FwSizeStoreType>(length), endianMode);
+        if (status != Fw::FW_SERIALIZE_OK) {
+            return status;
+        }
+    }
+    // Arrays larger than the staging buffer gain nothing from a copy and are written directly
+    if (length > this->getCapacity()) {
+        if (!this->reserve(this->getCapacity())) {
+            return Fw::FW_SERIALIZE_NO_ROOM_LEFT;
+        }
+        this->writeData(buff, length);
+        return (this->m_fileStatus == Os::File::Status::OP_OK) ? Fw::FW_SERIALIZE_OK : Fw::FW_SERIALIZE_NO_ROOM_LEFT;
+    }
+    if (!this->reserve(length)) {
+        return Fw::FW_SERIALIZE_NO_ROOM_LEFT;
+    }
+    return Fw::ExternalSerializeBuffer::serializeFrom(buff, length, Fw::Serialization::OMIT_LENGTH, endianMode);
+}
+
+Os::File::Status FileSerializer ::flush() {
+    if (this->getSize() > 0) {
+        this->writeData(this->m_staging, this->getSize());
+        this->resetSer();
+    }
+    return this->m_fileStatus;
+}
+
+Os::File::Status FileSerializer ::getFileStatus() const {
+    return this->m_fileStatus;
+}
+
+FwSizeType FileSerializer ::getSerializedSize() const {
+    return this->m_written + this->getSize();
+}
+
+template <typename T>
+Fw::SerializeStatus FileSerializer ::serializePrimitive(T val, Fw::Endianness mode) {
+    if (!this->reserve(sizeof(T))) {
+        return Fw::FW_SERIALIZE_NO_ROOM_LEFT;
+    }
+    return Fw::ExternalSerializeBuffer::serializeFrom(val, mode);
+}
+
+bool FileSerializer ::reserve(FwSizeType size) {
+    if (this->getSerializeSizeLeft() < size) {
+        (void)this->flush();
+    }
+    return this->m_fileStatus == Os::File::Status::OP_OK;
+}
+
+void FileSerializer ::writeData(const U8* data, FwSizeType size) {
+    // Once a write fails the file contents are unknown and nothing further is written
+    if (this->m_fileStatus != Os::File::Status::OP_OK) {
+        return;
+    }
+    FwSizeType written = size;
+    Os::File::Status status = (this->m_file != nullptr) ? this->m_file->write(data, written)
+                                                         : this->m_writer->write(data, written);
+    if ((status == Os::File::Status::OP_OK) && (written != size)) {
+        status = Os::File::Status::BAD_SIZE;
+    }
+    this->m_fileStatus = status;
+    this->m_written += written;
+}
+
+}  // namespace FileHelper
+}  // namespace Utilities
@@ -0,0 +1,98 @@
+// ======================================================================
+// \title  FileSerializer.hpp
+// \author starchmd
+// \brief  hpp file for FileHelper serialization directly to a file
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#ifndef FprimeExtras_Utilities_FileHelper_FileSerializer_HPP
+#define FprimeExtras_Utilities_FileHelper_FileSerializer_HPP
+
+#include "ExtrasConfig/FileHelperConfig.hpp"
+#include "FprimeExtras/Utilities/FileHelper/BufferedWriter.hpp"
+#include "Fw/FPrimeBasicTypes.hpp"
+#include "Fw/Types/Serializable.hpp"
+#include "Os/File.hpp"
+
+namespace Utilities {
+namespace FileHelper {
+
+//! \brief serialization buffer writing to an open file as serialization proceeds
+//!
+//! Serializes into a staging buffer of FILE_HELPER_SERIAL_STAGING_SIZE bytes that is written to the file whenever the
+//! next value does not fit, such that objects of any size are serialized with constant stack use. Byte arrays larger
+//! than the staging buffer are written directly. The file contents are identical to serializing into a buffer of the
+//! full size and writing it.
+//!
+//! Staged data is written when flush is called and when the serializer is destroyed. Errors of the write on
+//! destruction are lost, so call flush to check them. A failed write stops serialization with FW_SERIALIZE_NO_ROOM_LEFT
+//! and the file status is available from getFileStatus. Repositioning the serializer is not supported.
+class FileSerializer : public Fw::ExternalSerializeBuffer {
+  public:
+    //! \brief construct a serializer writing to file
+    //!
+    //! \param file the open file to write to, must stay open for the life of the serializer
+    explicit FileSerializer(Os::File& file);
+
+    //! \brief construct a serializer writing through a buffered writer
+    //!
+    //! \param writer the buffered writer to write through, must outlive the serializer
+    explicit FileSerializer(BufferedWriter& writer);
+
+    //! Destroy the serializer, writing any staged data
+    ~FileSerializer();
+
+    FileSerializer(const FileSerializer&) = delete;
+    FileSerializer& operator=(const FileSerializer&) = delete;
+
+    using Fw::ExternalSerializeBuffer::serializeFrom;
+
+    Fw::SerializeStatus serializeFrom(U8 val, Fw::Endianness mode = Fw::Endianness::BIG) override;
+    Fw::SerializeStatus serializeFrom(I8 val, Fw::Endianness mode = Fw::Endianness::BIG) override;
+    Fw::SerializeStatus serializeFrom(U16 val, Fw::Endianness mode = Fw::Endianness::BIG) override;
+    Fw::SerializeStatus serializeFrom(I16 val, Fw::Endianness mode = Fw::Endianness::BIG) override;
+    Fw::SerializeStatus serializeFrom(U32 val, Fw::Endianness mode = Fw::Endianness::BIG) override;
+    Fw::SerializeStatus serializeFrom(I32 val, Fw::Endianness mode = Fw::Endianness::BIG) override;
+    Fw::SerializeStatus serializeFrom(U64 val, Fw::Endianness mode = Fw::Endianness::BIG) override;
+    Fw::SerializeStatus serializeFrom(I64 val, Fw::Endianness mode = Fw::Endianness::BIG) override;
+    Fw::SerializeStatus serializeFrom(F32 val, Fw::Endianness mode = Fw::Endianness::BIG) override;
+    Fw::SerializeStatus serializeFrom(F64 val, Fw::Endianness mode = Fw::Endianness::BIG) override;
+    Fw::SerializeStatus serializeFrom(bool val, Fw::Endianness mode = Fw::Endianness::BIG) override;
+
+    //! \brief serialize a byte array, writing arrays larger than the staging buffer directly
+    Fw::SerializeStatus serializeFrom(const U8* buff,
+                                      FwSizeType length,
+                                      Fw::Serialization::t lengthMode,
+                                      Fw::Endianness endianMode = Fw::Endianness::BIG) override;
+
+    //! \brief write any staged data to the file
+    //!
+    //! \return status of the file write, or of the first failed write since construction
+    Os::File::Status flush();
+
+    //! \brief get the status of the first failed file write, OP_OK when none has failed
+    Os::File::Status getFileStatus() const;
+
+    //! \brief get the number of bytes serialized since construction, whether written or staged
+    FwSizeType getSerializedSize() const;
+
+  private:
+    //! \brief serialize a primitive after making room for it in the staging buffer
+    template <typename T>
+    Fw::SerializeStatus serializePrimitive(T val, Fw::Endianness mode);
+
+    //! \brief write the staged data when fewer than size bytes remain, returning false on a failed write
+    bool reserve(FwSizeType size);
+
+    //! \brief write data to the file or writer, recording the first failure
+    void writeData(const U8* data, FwSizeType size);
+
+    Os::File* m_file;               //!< File written to, nullptr when writing through m_writer
+    BufferedWriter* m_writer;       //!< Writer written through, nullptr when writing to m_file
+    Os::File::Status m_fileStatus;  //!< Status of the first failed write
+    FwSizeType m_written;           //!< Bytes written to the file
+    U8 m_staging[Utilities::FILE_HELPER_SERIAL_STAGING_SIZE];  //!< Staged serialized data
+};
+
+}  // namespace FileHelper
+}  // namespace Utilities
+#endif  // FprimeExtras_Utilities_FileHelper_FileSerializer_HPP
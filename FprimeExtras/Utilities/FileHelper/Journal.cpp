@@ -0,0 +1,322 @@
+// ======================================================================
+// \title  Journal.cpp
+// \author starchmd
+// \brief  cpp file for FileHelper crash-safe append-only journal
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#include "FprimeExtras/Utilities/FileHelper/Journal.hpp"
+#include "FprimeExtras/Utilities/FileHelper/Crc32.hpp"
+#include "FprimeExtras/Utilities/FileHelper/FileHelper.hpp"
+#include "Fw/Types/Assert.hpp"
+#include "Fw/Types/FileNameString.hpp"
+#include "Os/FileSystem.hpp"
+
+#include <cstring>
+
+namespace Utilities {
+namespace FileHelper {
+
+constexpr U32 Journal::JOURNAL_MAGIC;
+constexpr FwSizeType Journal::HEADER_SIZE;
+constexpr FwSizeType Journal::RECORD_HEADER_SIZE;
+
+Journal ::Journal(U8* buffer, FwSizeType capacity)
+    : m_buffer(buffer),
+      m_capacity(capacity),
+      m_buffered(0),
+      m_pending(0),
+      m_records(0),
+      m_size(0),
+      m_truncated(0),
+      m_groupRecords(Utilities::FILE_HELPER_JOURNAL_GROUP_RECORDS),
+      m_groupWindowUs(Utilities::FILE_HELPER_JOURNAL_GROUP_WINDOW_US) {
+    FW_ASSERT(buffer != nullptr);
+    FW_ASSERT(capacity > RECORD_HEADER_SIZE, static_cast<FwAssertArgType>(capacity));
+}
+
+Journal ::~Journal() {
+    (void)this->close();
+}
+
+Os::File::Status Journal ::open(const CHAR* path, JournalReplayer& replayer) {
+    FW_ASSERT(path != nullptr);
+    FW_ASSERT(!this->isOpen());
+    this->m_buffered = 0;
+    this->m_pending = 0;
+    this->m_records = 0;
+    this->m_truncated = 0;
+    FwSizeType valid = 0;
+    FwSizeType size = 0;
+    Os::File::Status status = this->replay(path, replayer, valid, size);
+    if (status == Os::File::Status::DOESNT_EXIST) {
+        status = Os::File::Status::OP_OK;
+    }
+    // A file too short to hold the header is recreated, anything after an intact header is kept
+    if ((status == Os::File::Status::OP_OK) && (valid < HEADER_SIZE)) {
+        status = this->m_file.open(path, Os::File::Mode::OPEN_CREATE, Os::File::OverwriteType::OVERWRITE);
+        if (status == Os::File::Status::OP_OK) {
+            status = writeToFile(this->m_file, JOURNAL_MAGIC);
+        }
+        if (status == Os::File::Status::OP_OK) {
+            status = this->m_file.flush();
+        }
+        valid = HEADER_SIZE;
+    } else if (status == Os::File::Status::OP_OK) {
+        if (valid < size) {
+            status = this->truncate(path, valid);
+        }
+        if (status == Os::File::Status::OP_OK) {
+            status = this->m_file.open(path, Os::File::Mode::OPEN_WRITE);
+        }
+        if (status == Os::File::Status::OP_OK) {
+            status = this->m_file.seek(static_cast<FwSignedSizeType>(valid), Os::File::SeekType::ABSOLUTE);
+        }
+    }
+    if (status == Os::File::Status::OP_OK) {
+        this->m_truncated = (size > valid) ? (size - valid) : 0;
+        this->m_size = valid;
+    } else {
+        this->m_file.close();
+        this->m_records = 0;
+    }
+    return status;
+}
+
+Os::File::Status Journal ::close() {
+    Os::File::Status status = Os::File::Status::OP_OK;
+    if (this->isOpen()) {
+        status = this->commit();
+        this->m_file.close();
+    }
+    return status;
+}
+
+bool Journal ::isOpen() const {
+    return this->m_file.isOpen();
+}
+
+void Journal ::setGroupCommit(FwSizeType records, U32 windowUs) {
+    this->m_groupRecords = records;
+    this->m_groupWindowUs = windowUs;
+}
+
+Os::File::Status Journal ::append(const U8* data, FwSizeType size) {
+    FW_ASSERT(this->isOpen());
+    FW_ASSERT((data != nullptr) || (size == 0));
+    if (size > this->getMaxRecordSize()) {
+        return Os::File::Status::BAD_SIZE;
+    }
+    Os::File::Status status = Os::File::Status::OP_OK;
+    if ((RECORD_HEADER_SIZE + size) > (this->m_capacity - this->m_buffered)) {
+        status = this->writeBuffer();
+    }
+    if ((status == Os::File::Status::OP_OK) && (size > 0)) {
+        ::memcpy(this->m_buffer + this->m_buffered + RECORD_HEADER_SIZE, data, static_cast<size_t>(size));
+    }
+    if (status == Os::File::Status::OP_OK) {
+        this->finishRecord(this->m_buffered, size);
+        status = this->commitIfDue();
+    }
+    return status;
+}
+
+Os::File::Status Journal ::append(const Fw::Serializable& object) {
+    FW_ASSERT(this->isOpen());
+    // Serialize after the records already buffered, writing them out to retry with the whole buffer when out of room
+    while (true) {
+        if ((this->m_capacity - this->m_buffered) > RECORD_HEADER_SIZE) {
+            const FwSizeType offset = this->m_buffered + RECORD_HEADER_SIZE;
+            Fw::ExternalSerializeBuffer serializer(this->m_buffer + offset, this->m_capacity - offset);
+            Fw::SerializeStatus serializeStatus = serializer.serializeFrom(object);
+            if (serializeStatus == Fw::SerializeStatus::FW_SERIALIZE_OK) {
+                this->finishRecord(this->m_buffered, serializer.getSize());
+                return this->commitIfDue();
+            } else if (serializeStatus != Fw::SerializeStatus::FW_SERIALIZE_NO_ROOM_LEFT) {
+                return Os::File::Status::OTHER_ERROR;
+            }
+        }
+        if (this->m_buffered == 0) {
+            return Os::File::Status::BAD_SIZE;
+        }
+        Os::File::Status status = this->writeBuffer();
+        if (status != Os::File::Status::OP_OK) {
+            return status;
+        }
+    }
+}
+
+Os::File::Status Journal ::commit() {
+    FW_ASSERT(this->isOpen());
+    Os::File::Status status = Os::File::Status::OP_OK;
+    if (this->m_pending > 0) {
+        status = this->writeBuffer();
+        if (status == Os::File::Status::OP_OK) {
+            status = this->m_file.flush();
+            // Records whose flush failed may or may not be stored, the end of the file is unknown
+            if (status != Os::File::Status::OP_OK) {
+                this->m_file.close();
+            }
+        }
+        this->m_pending = 0;
+    }
+    return status;
+}
+
+Os::File::Status Journal ::commitIfDue() {
+    FW_ASSERT(this->isOpen());
+    if (this->m_pending == 0) {
+        return Os::File::Status::OP_OK;
+    }
+    bool due = (this->m_groupRecords > 0) && (this->m_pending >= this->m_groupRecords);
+    if (!due && (this->m_groupWindowUs > 0)) {
+        // Without a usable clock records are committed rather than left waiting indefinitely
+        Os::RawTime now;
+        U32 elapsed = 0;
+        due = (now.now() != Os::RawTime::Status::OP_OK) ||
+              (now.getDiffUsec(this->m_firstPending, elapsed) != Os::RawTime::Status::OP_OK) ||
+              (elapsed >= this->m_groupWindowUs);
+    }
+    return due ? this->commit() : Os::File::Status::OP_OK;
+}
+
+FwSizeType Journal ::getPendingCount() const {
+    return this->m_pending;
+}
+
+FwSizeType Journal ::getRecordCount() const {
+    return this->m_records;
+}
+
+FwSizeType Journal ::getSize() const {
+    return this->m_size;
+}
+
+FwSizeType Journal ::getTruncatedSize() const {
+    return this->m_truncated;
+}
+
+FwSizeType Journal ::getMaxRecordSize() const {
+    return this->m_capacity - RECORD_HEADER_SIZE;
+}
+
+Os::File::Status Journal ::replay(const CHAR* path, JournalReplayer& replayer, FwSizeType& valid, FwSizeType& size) {
+    valid = 0;
+    size = 0;
+    Os::File file;
+    Os::File::Status status = file.open(path, Os::File::Mode::OPEN_READ);
+    if (status == Os::File::Status::OP_OK) {
+        status = file.size(size);
+    }
+    if ((status != Os::File::Status::OP_OK) || (size < HEADER_SIZE)) {
+        return status;
+    }
+    U8 staging[Utilities::FILE_HELPER_STAGING_BUFFER_SIZE];
+    BufferedReader reader(file, staging, sizeof(staging));
+    U32 magic = 0;
+    status = readFromFile(reader, magic);
+    if ((status == Os::File::Status::OP_OK) && (magic != JOURNAL_MAGIC)) {
+        status = Os::File::Status::OTHER_ERROR;
+    }
+    if (status != Os::File::Status::OP_OK) {
+        return status;
+    }
+    valid = HEADER_SIZE;
+    // Records are replayed until the end of the file or the first damaged record, read errors are reported as they
+    // say nothing about the state of the record
+    while (true) {
+        FwSizeType read_size = RECORD_HEADER_SIZE;
+        status = reader.read(this->m_buffer, read_size);
+        if ((status != Os::File::Status::OP_OK) || (read_size != RECORD_HEADER_SIZE)) {
+            break;
+        }
+        U32 fields[2];
+        swapBigEndian(reinterpret_cast<U8*>(fields), this->m_buffer, 2, sizeof(U32));
+        const FwSizeType length = fields[0];
+        if (length > this->getMaxRecordSize()) {
+            break;
+        }
+        read_size = length;
+        status = reader.read(this->m_buffer + RECORD_HEADER_SIZE, read_size);
+        if ((status != Os::File::Status::OP_OK) || (read_size != length) ||
+            (crc32(this->m_buffer + RECORD_HEADER_SIZE, length, crc32(this->m_buffer, sizeof(U32))) != fields[1])) {
+            break;
+        }
+        Fw::Buffer record(this->m_buffer + RECORD_HEADER_SIZE, length);
+        replayer.replayRecord(record);
+        valid += RECORD_HEADER_SIZE + length;
+        this->m_records += 1;
+    }
+    file.close();
+    return status;
+}
+
+Os::File::Status Journal ::truncate(const CHAR* path, FwSizeType size) {
+    Fw::FileNameString temp;
+    temp.format("%s%s", path, Utilities::FILE_HELPER_JOURNAL_TEMP_SUFFIX);
+    Os::File source;
+    Os::File destination;
+    Os::File::Status status = source.open(path, Os::File::Mode::OPEN_READ);
+    if (status == Os::File::Status::OP_OK) {
+        status = destination.open(temp.toChar(), Os::File::Mode::OPEN_CREATE, Os::File::OverwriteType::OVERWRITE);
+    }
+    for (FwSizeType copied = 0; (copied < size) && (status == Os::File::Status::OP_OK);) {
+        const FwSizeType chunk = FW_MIN(this->m_capacity, size - copied);
+        FwSizeType transferred = chunk;
+        status = source.read(this->m_buffer, transferred);
+        if ((status == Os::File::Status::OP_OK) && (transferred == chunk)) {
+            status = destination.write(this->m_buffer, transferred);
+        }
+        if ((status == Os::File::Status::OP_OK) && (transferred != chunk)) {
+            status = Os::File::Status::BAD_SIZE;
+        }
+        copied += chunk;
+    }
+    if (status == Os::File::Status::OP_OK) {
+        status = destination.flush();
+    }
+    source.close();
+    destination.close();
+    // The intact records are renamed into place such that an interrupted truncation leaves the journal as it was
+    if ((status == Os::File::Status::OP_OK) &&
+        (Os::FileSystem::rename(temp.toChar(), path) != Os::FileSystem::Status::OP_OK)) {
+        status = Os::File::Status::OTHER_ERROR;
+    }
+    return status;
+}
+
+void Journal ::finishRecord(FwSizeType offset, FwSizeType size) {
+    FW_ASSERT((offset + RECORD_HEADER_SIZE + size) <= this->m_capacity, static_cast<FwAssertArgType>(size));
+    U8* const header = this->m_buffer + offset;
+    const U32 length = static_cast<U32>(size);
+    swapBigEndian(header, reinterpret_cast<const U8*>(&length), 1, sizeof(U32));
+    const U32 crc = crc32(header + RECORD_HEADER_SIZE, size, crc32(header, sizeof(U32)));
+    swapBigEndian(header + sizeof(U32), reinterpret_cast<const U8*>(&crc), 1, sizeof(U32));
+    if (this->m_pending == 0) {
+        (void)this->m_firstPending.now();
+    }
+    this->m_buffered += RECORD_HEADER_SIZE + size;
+    this->m_size += RECORD_HEADER_SIZE + size;
+    this->m_pending += 1;
+    this->m_records += 1;
+}
+
+Os::File::Status Journal ::writeBuffer() {
+    Os::File::Status status = Os::File::Status::OP_OK;
+    if (this->m_buffered > 0) {
+        FwSizeType written = this->m_buffered;
+        status = this->m_file.write(this->m_buffer, written);
+        if ((status == Os::File::Status::OP_OK) && (written != this->m_buffered)) {
+            status = Os::File::Status::BAD_SIZE;
+        }
+        this->m_buffered = 0;
+        // Part of the buffer may have been written, the end of the file is unknown
+        if (status != Os::File::Status::OP_OK) {
+            this->m_file.close();
+            this->m_pending = 0;
+        }
+    }
+    return status;
+}
+
+}  // namespace FileHelper
+}  // namespace Utilities
@@ -0,0 +1,205 @@
+// ======================================================================
+// \title  Journal.hpp
+// \author starchmd
+// \brief  hpp file for FileHelper crash-safe append-only journal
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#ifndef FprimeExtras_Utilities_FileHelper_Journal_HPP
+#define FprimeExtras_Utilities_FileHelper_Journal_HPP
+
+#include "ExtrasConfig/FileHelperConfig.hpp"
+#include "Fw/Buffer/Buffer.hpp"
+#include "Fw/FPrimeBasicTypes.hpp"
+#include "Fw/Types/Serializable.hpp"
+#include "Os/File.hpp"
+#include "Os/RawTime.hpp"
+
+namespace Utilities {
+namespace FileHelper {
+
+//! \brief receives each record of a journal as it is replayed on open
+class JournalReplayer {
+  public:
+    virtual ~JournalReplayer() {}
+
+    //! \brief handle the next record of the journal
+    //!
+    //! \param record the record contents, valid only for the duration of the call
+    virtual void replayRecord(Fw::Buffer& record) = 0;
+};
+
+//! \brief append-only file of length-prefixed, CRC-checked records
+//!
+//! Records are appended to a buffer supplied by the caller and written to the file with a single write once the
+//! buffer fills or the records are committed. Committing writes the buffer and flushes the file to storage, such that
+//! committed records survive a crash. Commits are grouped: records are committed once a count of records is pending,
+//! or once the oldest pending record has waited for a window of time, trading the durability of the latest records for
+//! fewer flushes. The file consists of a header followed by the records. All fields are big-endian:
+//!
+//! | Field   | Type    | Description                                      |
+//! |---------|---------|--------------------------------------------------|
+//! | magic   | U32     | JOURNAL_MAGIC, once at the start of the file     |
+//! | length  | U32     | Size of the record data, for each record         |
+//! | crc     | U32     | CRC32 of the length field followed by the data   |
+//! | data    | U8[]    | Record data                                      |
+//!
+//! Opening a journal replays each intact record in order. Replay stops at the first record that is incomplete, fails
+//! its CRC, or is longer than a record may be, as left by a crash during a write. The file is truncated there such
+//! that later records follow the last intact record. Truncation writes the intact records to a temporary file that is
+//! renamed over the journal, leaving the journal intact should truncation itself be interrupted.
+//!
+//! A journal whose write fails is closed, as the end of the file is unknown. Open it again to truncate any partial
+//! record and continue appending.
+class Journal {
+  public:
+    //! Magic number identifying a journal file: "JRNL"
+    static constexpr U32 JOURNAL_MAGIC = 0x4A524E4C;
+
+    //! Size of the file header
+    static constexpr FwSizeType HEADER_SIZE = sizeof(U32);
+
+    //! Size of the length and crc preceding each record
+    static constexpr FwSizeType RECORD_HEADER_SIZE = sizeof(U32) + sizeof(U32);
+
+    //! \brief construct a closed journal collecting records in buffer
+    //!
+    //! Records may be at most capacity - RECORD_HEADER_SIZE bytes. Commits default to
+    //! FILE_HELPER_JOURNAL_GROUP_RECORDS records and FILE_HELPER_JOURNAL_GROUP_WINDOW_US microseconds.
+    //!
+    //! \warning It is invalid to supply a null buffer or a capacity not exceeding RECORD_HEADER_SIZE and results in an
+    //!          assertion failure.
+    //!
+    //! \param buffer storage used to collect and replay records, must outlive the journal
+    //! \param capacity size of buffer in bytes
+    Journal(U8* buffer, FwSizeType capacity);
+
+    //! Destroy the journal, committing and closing it if open
+    ~Journal();
+
+    Journal(const Journal&) = delete;
+    Journal& operator=(const Journal&) = delete;
+
+    //! \brief open the journal at path, replaying its records
+    //!
+    //! A missing file, or one shorter than the header, is created as an empty journal. Each intact record of an
+    //! existing journal is passed to replayer in order, then any damaged tail is truncated. A file that is not a
+    //! journal is left untouched and OTHER_ERROR is returned.
+    //!
+    //! \warning It is invalid to open a journal that is already open or to supply a null path and results in an
+    //!          assertion failure.
+    //!
+    //! \param path path of the journal file
+    //! \param replayer receives each intact record
+    //! \return status of reading, truncating, and opening the journal
+    Os::File::Status open(const CHAR* path, JournalReplayer& replayer);
+
+    //! \brief commit any pending records and close the journal
+    //!
+    //! Closing a journal that is not open has no effect and returns OP_OK. The journal is closed even when the commit
+    //! fails.
+    //!
+    //! \return status of the commit
+    Os::File::Status close();
+
+    //! \brief check if the journal is open
+    bool isOpen() const;
+
+    //! \brief set when pending records are committed
+    //!
+    //! \param records commit once this many records are pending, 0 to not commit on a count
+    //! \param windowUs commit once the oldest pending record has waited this long, 0 to not commit on time
+    void setGroupCommit(FwSizeType records, U32 windowUs);
+
+    //! \brief append a record holding data
+    //!
+    //! \warning It is invalid to call this function on a journal that is not open, or to supply null data with a
+    //!          non-zero size, and results in an assertion failure.
+    //!
+    //! \param data the record data
+    //! \param size size of data in bytes
+    //! \return status of any write and commit made, BAD_SIZE when the record exceeds getMaxRecordSize
+    Os::File::Status append(const U8* data, FwSizeType size);
+
+    //! \brief append a record holding a serialized object
+    //!
+    //! The object is serialized directly into the buffer. The record holds only the bytes serialized, which may be
+    //! fewer than the SERIALIZED_SIZE of the object.
+    //!
+    //! \warning It is invalid to call this function on a journal that is not open and results in an assertion failure.
+    //!
+    //! \param object the object to serialize as the record
+    //! \return status of any write and commit made, BAD_SIZE when the object exceeds getMaxRecordSize
+    Os::File::Status append(const Fw::Serializable& object);
+
+    //! \brief write pending records and flush the file to storage
+    //!
+    //! \warning It is invalid to call this function on a journal that is not open and results in an assertion failure.
+    //!
+    //! \return status of the write and flush, OP_OK when no records are pending
+    Os::File::Status commit();
+
+    //! \brief commit pending records when they reach the group commit count or window
+    //!
+    //! Appending checks the group commit count and window itself. Call periodically, such as from a rate group, to
+    //! bound the time records wait when appends stop.
+    //!
+    //! \warning It is invalid to call this function on a journal that is not open and results in an assertion failure.
+    //!
+    //! \return status of any commit made
+    Os::File::Status commitIfDue();
+
+    //! \brief get the number of records appended and not yet committed
+    FwSizeType getPendingCount() const;
+
+    //! \brief get the number of records in the journal, replayed and appended
+    FwSizeType getRecordCount() const;
+
+    //! \brief get the size of the journal file in bytes, including pending records
+    FwSizeType getSize() const;
+
+    //! \brief get the number of damaged bytes truncated when the journal was opened
+    FwSizeType getTruncatedSize() const;
+
+    //! \brief get the largest record that may be appended
+    FwSizeType getMaxRecordSize() const;
+
+  private:
+    //! \brief replay the records of the journal at path, setting valid to the size of its intact part
+    Os::File::Status replay(const CHAR* path, JournalReplayer& replayer, FwSizeType& valid, FwSizeType& size);
+
+    //! \brief replace the journal at path with its first size bytes
+    Os::File::Status truncate(const CHAR* path, FwSizeType size);
+
+    //! \brief write the length and crc of the record of size bytes already held after them at offset in the buffer
+    void finishRecord(FwSizeType offset, FwSizeType size);
+
+    //! \brief write the buffered records to the file, closing the journal on error
+    Os::File::Status writeBuffer();
+
+    Os::File m_file;             //!< Journal file
+    U8* m_buffer;                //!< Storage of records not yet written
+    FwSizeType m_capacity;       //!< Size of m_buffer
+    FwSizeType m_buffered;       //!< Bytes held in m_buffer
+    FwSizeType m_pending;        //!< Records not yet committed
+    FwSizeType m_records;        //!< Records in the journal
+    FwSizeType m_size;           //!< Size of the journal file including buffered records
+    FwSizeType m_truncated;      //!< Bytes truncated on open
+    FwSizeType m_groupRecords;   //!< Pending record count triggering a commit
+    U32 m_groupWindowUs;         //!< Wait of the oldest pending record triggering a commit
+    Os::RawTime m_firstPending;  //!< Time the oldest pending record was appended
+};
+
+//! \brief Journal holding a buffer of CAPACITY bytes
+template <FwSizeType CAPACITY = Utilities::FILE_HELPER_JOURNAL_BUFFER_SIZE>
+class StaticJournal : public Journal {
+  public:
+    //! \brief construct a closed journal
+    StaticJournal() : Journal(m_storage, CAPACITY) {}
+
+  private:
+    U8 m_storage[CAPACITY];  //!< Storage of records
+};
+
+}  // namespace FileHelper
+}  // namespace Utilities
+#endif  // FprimeExtras_Utilities_FileHelper_Journal_HPP
@@ -0,0 +1,433 @@
+// ======================================================================
+// \title  KeyValueStore.cpp
+// \author starchmd
+// \brief  cpp file for FileHelper persistent key-value store
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#include "FprimeExtras/Utilities/FileHelper/KeyValueStore.hpp"
+#include "FprimeExtras/Utilities/FileHelper/Crc32.hpp"
+#include "Os/FileSystem.hpp"
+
+#include <cstring>
+
+namespace Utilities {
+namespace FileHelper {
+
+static_assert((Utilities::FILE_HELPER_KV_MAX_ENTRIES > 0) &&
+                  ((Utilities::FILE_HELPER_KV_MAX_ENTRIES & (Utilities::FILE_HELPER_KV_MAX_ENTRIES - 1)) == 0),
+              "FILE_HELPER_KV_MAX_ENTRIES must be a power of two");
+static_assert((Utilities::FILE_HELPER_KV_MAX_KEY_SIZE >= sizeof(U32)) &&
+                  (Utilities::FILE_HELPER_KV_MAX_KEY_SIZE <= 0xFF),
+              "FILE_HELPER_KV_MAX_KEY_SIZE must hold an integer key and fit in a U8");
+static_assert((Journal::RECORD_HEADER_SIZE + KeyValueStore::RECORD_PREFIX_SIZE +
+               Utilities::FILE_HELPER_KV_MAX_KEY_SIZE + Utilities::FILE_HELPER_KV_MAX_VALUE_SIZE) <=
+                  Utilities::FILE_HELPER_JOURNAL_BUFFER_SIZE,
+              "FILE_HELPER_JOURNAL_BUFFER_SIZE must hold the largest key-value record");
+
+constexpr FwSizeType KeyValueStore::RECORD_PREFIX_SIZE;
+
+namespace {
+
+//! Mask reducing a hash to an index of the hash table
+constexpr FwSizeType INDEX_MASK = Utilities::FILE_HELPER_KV_MAX_ENTRIES - 1;
+
+//! \brief ignores the records of a journal whose entries are already in memory
+class IgnoringReplayer : public JournalReplayer {
+  public:
+    void replayRecord(Fw::Buffer&) override {}
+};
+
+}  // namespace
+
+KeyValueStore ::KeyValueStore()
+    : m_groupRecords(Utilities::FILE_HELPER_JOURNAL_GROUP_RECORDS),
+      m_groupWindowUs(Utilities::FILE_HELPER_JOURNAL_GROUP_WINDOW_US),
+      m_count(0),
+      m_liveSize(Journal::HEADER_SIZE) {
+    ::memset(this->m_entries, 0, sizeof(this->m_entries));
+}
+
+KeyValueStore ::~KeyValueStore() {
+    (void)this->close();
+}
+
+Os::File::Status KeyValueStore ::open(const CHAR* path) {
+    FW_ASSERT(path != nullptr);
+    Os::ScopeLock compact_lock(this->m_compactLock);
+    Os::ScopeLock lock(this->m_lock);
+    FW_ASSERT(!this->m_journal.isOpen());
+    this->m_path = path;
+    this->m_tempPath.format("%s%s", path, Utilities::FILE_HELPER_KV_TEMP_SUFFIX);
+    ::memset(this->m_entries, 0, sizeof(this->m_entries));
+    this->m_count = 0;
+    this->m_liveSize = Journal::HEADER_SIZE;
+    this->m_journal.setGroupCommit(this->m_groupRecords, this->m_groupWindowUs);
+    Os::File::Status status = this->m_journal.open(path, *this);
+    if (status != Os::File::Status::OP_OK) {
+        ::memset(this->m_entries, 0, sizeof(this->m_entries));
+        this->m_count = 0;
+        this->m_liveSize = Journal::HEADER_SIZE;
+    }
+    return status;
+}
+
+Os::File::Status KeyValueStore ::close() {
+    Os::ScopeLock compact_lock(this->m_compactLock);
+    Os::ScopeLock lock(this->m_lock);
+    Os::File::Status status = this->m_journal.close();
+    ::memset(this->m_entries, 0, sizeof(this->m_entries));
+    this->m_count = 0;
+    this->m_liveSize = Journal::HEADER_SIZE;
+    return status;
+}
+
+bool KeyValueStore ::isOpen() const {
+    Os::ScopeLock lock(this->m_lock);
+    return this->m_journal.isOpen();
+}
+
+void KeyValueStore ::setGroupCommit(FwSizeType records, U32 windowUs) {
+    Os::ScopeLock lock(this->m_lock);
+    this->m_groupRecords = records;
+    this->m_groupWindowUs = windowUs;
+    this->m_journal.setGroupCommit(records, windowUs);
+}
+
+Os::File::Status KeyValueStore ::commit() {
+    Os::ScopeLock lock(this->m_lock);
+    if (!this->m_journal.isOpen()) {
+        return Os::File::Status::NOT_OPENED;
+    }
+    return this->m_journal.commit();
+}
+
+Os::File::Status KeyValueStore ::commitIfDue() {
+    Os::ScopeLock lock(this->m_lock);
+    if (!this->m_journal.isOpen()) {
+        return Os::File::Status::NOT_OPENED;
+    }
+    return this->m_journal.commitIfDue();
+}
+
+bool KeyValueStore ::contains(U32 key) const {
+    U8 key_data[sizeof(U32)];
+    encodeKey(key, key_data);
+    Os::ScopeLock lock(this->m_lock);
+    const FwSizeType index = this->find(KEY_INTEGER, key_data, sizeof(key_data));
+    return (index < Utilities::FILE_HELPER_KV_MAX_ENTRIES) && this->m_entries[index].m_used;
+}
+
+bool KeyValueStore ::contains(const CHAR* key) const {
+    const FwSizeType key_size = stringKeySize(key);
+    Os::ScopeLock lock(this->m_lock);
+    const FwSizeType index = this->find(KEY_STRING, reinterpret_cast<const U8*>(key), key_size);
+    return (index < Utilities::FILE_HELPER_KV_MAX_ENTRIES) && this->m_entries[index].m_used;
+}
+
+Os::File::Status KeyValueStore ::remove(U32 key) {
+    U8 key_data[sizeof(U32)];
+    encodeKey(key, key_data);
+    return this->removeValue(KEY_INTEGER, key_data, sizeof(key_data));
+}
+
+Os::File::Status KeyValueStore ::remove(const CHAR* key) {
+    return this->removeValue(KEY_STRING, reinterpret_cast<const U8*>(key), stringKeySize(key));
+}
+
+FwSizeType KeyValueStore ::getCount() const {
+    Os::ScopeLock lock(this->m_lock);
+    return this->m_count;
+}
+
+FwSizeType KeyValueStore ::getLogSize() const {
+    Os::ScopeLock lock(this->m_lock);
+    return this->m_journal.getSize();
+}
+
+Os::File::Status KeyValueStore ::compact() {
+    Os::ScopeLock compact_lock(this->m_compactLock);
+    FwSizeType snapshot_size = 0;
+    {
+        Os::ScopeLock lock(this->m_lock);
+        // The journal closes itself on a write error, leaving nothing to compact until the store is reopened
+        if (!this->m_journal.isOpen()) {
+            return Os::File::Status::NOT_OPENED;
+        }
+        ::memcpy(this->m_snapshot, this->m_entries, sizeof(this->m_entries));
+        snapshot_size = this->m_journal.getSize();
+    }
+    // The slow writes and flush of the live entries are made unlocked, such that reads and writes continue
+    Os::File::Status status = this->writeSnapshot();
+
+    Os::ScopeLock lock(this->m_lock);
+    // Closing commits the records appended since the snapshot, which then follow the live entries they replace
+    const Os::File::Status close_status = this->m_journal.close();
+    status = (status == Os::File::Status::OP_OK) ? close_status : status;
+    if (status == Os::File::Status::OP_OK) {
+        status = this->appendJournalTail(snapshot_size);
+    }
+    if ((status == Os::File::Status::OP_OK) &&
+        (Os::FileSystem::rename(this->m_tempPath.toChar(), this->m_path.toChar()) != Os::FileSystem::Status::OP_OK)) {
+        status = Os::File::Status::OTHER_ERROR;
+    }
+    // The journal is reopened whether or not it was replaced, its entries match those in memory either way
+    IgnoringReplayer ignore;
+    const Os::File::Status open_status = this->m_journal.open(this->m_path.toChar(), ignore);
+    return (status == Os::File::Status::OP_OK) ? open_status : status;
+}
+
+Os::File::Status KeyValueStore ::compactIfDue() {
+    FwSizeType log_size = 0;
+    FwSizeType live_size = 0;
+    {
+        Os::ScopeLock lock(this->m_lock);
+        if (!this->m_journal.isOpen()) {
+            return Os::File::Status::NOT_OPENED;
+        }
+        log_size = this->m_journal.getSize();
+        live_size = this->m_liveSize;
+    }
+    if ((log_size > Utilities::FILE_HELPER_KV_COMPACT_MIN_SIZE) &&
+        ((log_size / Utilities::FILE_HELPER_KV_COMPACT_RATIO) > live_size)) {
+        return this->compact();
+    }
+    return Os::File::Status::OP_OK;
+}
+
+Os::File::Status KeyValueStore ::writeSnapshot() {
+    IgnoringReplayer ignore;
+    // A journal left by an interrupted compaction is discarded rather than replayed
+    (void)Os::FileSystem::removeFile(this->m_tempPath.toChar());
+    Os::File::Status status = this->m_compactJournal.open(this->m_tempPath.toChar(), ignore);
+    // Entries are committed once, after all are written
+    this->m_compactJournal.setGroupCommit(0, 0);
+    for (FwSizeType i = 0; (i < Utilities::FILE_HELPER_KV_MAX_ENTRIES) && (status == Os::File::Status::OP_OK); i++) {
+        const Entry& entry = this->m_snapshot[i];
+        if (entry.m_used) {
+            status = appendRecord(this->m_compactJournal, SET, entry.m_keyKind, entry.m_key, entry.m_keySize,
+                                  entry.m_value, entry.m_valueSize);
+        }
+    }
+    const Os::File::Status close_status = this->m_compactJournal.close();
+    return (status == Os::File::Status::OP_OK) ? close_status : status;
+}
+
+Os::File::Status KeyValueStore ::appendJournalTail(FwSizeType offset) const {
+    Os::File source;
+    Os::File destination;
+    Os::File::Status status = source.open(this->m_path.toChar(), Os::File::Mode::OPEN_READ);
+    FwSizeType size = 0;
+    if (status == Os::File::Status::OP_OK) {
+        status = source.size(size);
+    }
+    if ((status == Os::File::Status::OP_OK) && (size > offset)) {
+        status = source.seek(static_cast<FwSignedSizeType>(offset), Os::File::SeekType::ABSOLUTE);
+        if (status == Os::File::Status::OP_OK) {
+            status = destination.open(this->m_tempPath.toChar(), Os::File::Mode::OPEN_APPEND);
+        }
+        U8 staging[Utilities::FILE_HELPER_STAGING_BUFFER_SIZE];
+        for (FwSizeType copied = offset; (copied < size) && (status == Os::File::Status::OP_OK);) {
+            const FwSizeType chunk = FW_MIN(static_cast<FwSizeType>(sizeof(staging)), size - copied);
+            FwSizeType transferred = chunk;
+            status = source.read(staging, transferred);
+            if ((status == Os::File::Status::OP_OK) && (transferred == chunk)) {
+                status = destination.write(staging, transferred);
+            }
+            if ((status == Os::File::Status::OP_OK) && (transferred != chunk)) {
+                status = Os::File::Status::BAD_SIZE;
+            }
+            copied += chunk;
+        }
+        if (status == Os::File::Status::OP_OK) {
+            status = destination.flush();
+        }
+    }
+    source.close();
+    destination.close();
+    return status;
+}
+
+void KeyValueStore ::encodeKey(U32 key, U8* data) {
+    swapBigEndian(data, reinterpret_cast<const U8*>(&key), 1, sizeof(U32));
+}
+
+FwSizeType KeyValueStore ::stringKeySize(const CHAR* key) {
+    FW_ASSERT(key != nullptr);
+    FwSizeType size = 0;
+    while ((size <= Utilities::FILE_HELPER_KV_MAX_KEY_SIZE) && (key[size] != '\0')) {
+        size++;
+    }
+    FW_ASSERT(size <= Utilities::FILE_HELPER_KV_MAX_KEY_SIZE, static_cast<FwAssertArgType>(size));
+    return size;
+}
+
+Os::File::Status KeyValueStore ::setValue(U8 keyKind,
+                                          const U8* key,
+                                          FwSizeType keySize,
+                                          const U8* value,
+                                          FwSizeType valueSize) {
+    FW_ASSERT(valueSize <= Utilities::FILE_HELPER_KV_MAX_VALUE_SIZE, static_cast<FwAssertArgType>(valueSize));
+    Os::ScopeLock lock(this->m_lock);
+    // The journal closes itself on a write error, the change is refused until the store is reopened
+    if (!this->m_journal.isOpen()) {
+        return Os::File::Status::NOT_OPENED;
+    }
+    const FwSizeType index = this->find(keyKind, key, keySize);
+    if (index >= Utilities::FILE_HELPER_KV_MAX_ENTRIES) {
+        return Os::File::Status::NO_SPACE;
+    }
+    const Entry& entry = this->m_entries[index];
+    if (entry.m_used && (entry.m_valueSize == valueSize) &&
+        (::memcmp(entry.m_value, value, static_cast<size_t>(valueSize)) == 0)) {
+        return Os::File::Status::OP_OK;
+    }
+    // Memory only reflects changes accepted by the journal
+    Os::File::Status status = appendRecord(this->m_journal, SET, keyKind, key, keySize, value, valueSize);
+    if (status == Os::File::Status::OP_OK) {
+        this->store(index, keyKind, key, keySize, value, valueSize);
+    }
+    return status;
+}
+
+Os::File::Status KeyValueStore ::getValue(U8 keyKind,
+                                          const U8* key,
+                                          FwSizeType keySize,
+                                          U8* value,
+                                          FwSizeType& valueSize) const {
+    Os::ScopeLock lock(this->m_lock);
+    const FwSizeType index = this->find(keyKind, key, keySize);
+    if ((index >= Utilities::FILE_HELPER_KV_MAX_ENTRIES) || !this->m_entries[index].m_used) {
+        return Os::File::Status::DOESNT_EXIST;
+    }
+    const Entry& entry = this->m_entries[index];
+    ::memcpy(value, entry.m_value, static_cast<size_t>(entry.m_valueSize));
+    valueSize = entry.m_valueSize;
+    return Os::File::Status::OP_OK;
+}
+
+Os::File::Status KeyValueStore ::removeValue(U8 keyKind, const U8* key, FwSizeType keySize) {
+    Os::ScopeLock lock(this->m_lock);
+    if (!this->m_journal.isOpen()) {
+        return Os::File::Status::NOT_OPENED;
+    }
+    const FwSizeType index = this->find(keyKind, key, keySize);
+    if ((index >= Utilities::FILE_HELPER_KV_MAX_ENTRIES) || !this->m_entries[index].m_used) {
+        return Os::File::Status::DOESNT_EXIST;
+    }
+    Os::File::Status status = appendRecord(this->m_journal, REMOVE, keyKind, key, keySize, nullptr, 0);
+    if (status == Os::File::Status::OP_OK) {
+        this->erase(index);
+    }
+    return status;
+}
+
+Os::File::Status KeyValueStore ::appendRecord(Journal& journal,
+                                              U8 op,
+                                              U8 keyKind,
+                                              const U8* key,
+                                              FwSizeType keySize,
+                                              const U8* value,
+                                              FwSizeType valueSize) {
+    U8 record[RECORD_PREFIX_SIZE + Utilities::FILE_HELPER_KV_MAX_KEY_SIZE + Utilities::FILE_HELPER_KV_MAX_VALUE_SIZE];
+    record[0] = op;
+    record[1] = keyKind;
+    record[2] = static_cast<U8>(keySize);
+    ::memcpy(record + RECORD_PREFIX_SIZE, key, static_cast<size_t>(keySize));
+    if (valueSize > 0) {
+        ::memcpy(record + RECORD_PREFIX_SIZE + keySize, value, static_cast<size_t>(valueSize));
+    }
+    return journal.append(record, RECORD_PREFIX_SIZE + keySize + valueSize);
+}
+
+void KeyValueStore ::replayRecord(Fw::Buffer& record) {
+    const U8* const data = record.getData();
+    const FwSizeType size = record.getSize();
+    // Records that cannot have been written by the store are skipped
+    if ((size < RECORD_PREFIX_SIZE) || (data[2] > Utilities::FILE_HELPER_KV_MAX_KEY_SIZE) ||
+        ((RECORD_PREFIX_SIZE + data[2]) > size)) {
+        return;
+    }
+    const U8* const key = data + RECORD_PREFIX_SIZE;
+    const FwSizeType key_size = data[2];
+    const FwSizeType value_size = size - RECORD_PREFIX_SIZE - key_size;
+    const FwSizeType index = this->find(data[1], key, key_size);
+    if (index >= Utilities::FILE_HELPER_KV_MAX_ENTRIES) {
+        return;
+    }
+    if ((data[0] == SET) && (value_size <= Utilities::FILE_HELPER_KV_MAX_VALUE_SIZE)) {
+        this->store(index, data[1], key, key_size, key + key_size, value_size);
+    } else if ((data[0] == REMOVE) && this->m_entries[index].m_used) {
+        this->erase(index);
+    }
+}
+
+FwSizeType KeyValueStore ::find(U8 keyKind, const U8* key, FwSizeType keySize) const {
+    FwSizeType index = home(keyKind, key, keySize);
+    for (FwSizeType probes = 0; probes < Utilities::FILE_HELPER_KV_MAX_ENTRIES; probes++) {
+        const Entry& entry = this->m_entries[index];
+        if (!entry.m_used || ((entry.m_keyKind == keyKind) && (entry.m_keySize == keySize) &&
+                              (::memcmp(entry.m_key, key, static_cast<size_t>(keySize)) == 0))) {
+            return index;
+        }
+        index = (index + 1) & INDEX_MASK;
+    }
+    return Utilities::FILE_HELPER_KV_MAX_ENTRIES;
+}
+
+void KeyValueStore ::store(FwSizeType index,
+                           U8 keyKind,
+                           const U8* key,
+                           FwSizeType keySize,
+                           const U8* value,
+                           FwSizeType valueSize) {
+    Entry& entry = this->m_entries[index];
+    if (entry.m_used) {
+        this->m_liveSize -= this->recordSize(index);
+    } else {
+        entry.m_used = true;
+        entry.m_keyKind = keyKind;
+        entry.m_keySize = static_cast<U8>(keySize);
+        ::memcpy(entry.m_key, key, static_cast<size_t>(keySize));
+        this->m_count += 1;
+    }
+    if (valueSize > 0) {
+        ::memcpy(entry.m_value, value, static_cast<size_t>(valueSize));
+    }
+    entry.m_valueSize = valueSize;
+    this->m_liveSize += this->recordSize(index);
+}
+
+void KeyValueStore ::erase(FwSizeType index) {
+    FW_ASSERT(this->m_entries[index].m_used);
+    this->m_liveSize -= this->recordSize(index);
+    this->m_count -= 1;
+    this->m_entries[index].m_used = false;
+    // Later entries of the probe sequence are moved into the gap such that searches never stop early, this avoids
+    // tombstones which would otherwise accumulate as keys are removed
+    FwSizeType gap = index;
+    FwSizeType next = (index + 1) & INDEX_MASK;
+    while (this->m_entries[next].m_used) {
+        const Entry& entry = this->m_entries[next];
+        const FwSizeType start = home(entry.m_keyKind, entry.m_key, entry.m_keySize);
+        // The entry may move into the gap when its home does not lie cyclically within (gap, next]
+        const bool movable = (gap <= next) ? ((start <= gap) || (start > next)) : ((start <= gap) && (start > next));
+        if (movable) {
+            this->m_entries[gap] = entry;
+            this->m_entries[next].m_used = false;
+            gap = next;
+        }
+        next = (next + 1) & INDEX_MASK;
+    }
+}
+
+FwSizeType KeyValueStore ::recordSize(FwSizeType index) const {
+    const Entry& entry = this->m_entries[index];
+    return Journal::RECORD_HEADER_SIZE + RECORD_PREFIX_SIZE + entry.m_keySize + entry.m_valueSize;
+}
+
+FwSizeType KeyValueStore ::home(U8 keyKind, const U8* key, FwSizeType keySize) {
+    return static_cast<FwSizeType>(crc32(key, keySize, keyKind)) & INDEX_MASK;
+}
+
+}  // namespace FileHelper
+}  // namespace Utilities
@@ -0,0 +1,298 @@
+// ======================================================================
+// \title  KeyValueStore.hpp
+// \author starchmd
+// \brief  hpp file for FileHelper persistent key-value store
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#ifndef FprimeExtras_Utilities_FileHelper_KeyValueStore_HPP
+#define FprimeExtras_Utilities_FileHelper_KeyValueStore_HPP
+
+#include <type_traits>
+
+#include "ExtrasConfig/FileHelperConfig.hpp"
+#include "FprimeExtras/Utilities/FileHelper/FileHelper.hpp"
+#include "FprimeExtras/Utilities/FileHelper/Journal.hpp"
+#include "Fw/FPrimeBasicTypes.hpp"
+#include "Fw/Types/Assert.hpp"
+#include "Fw/Types/FileNameString.hpp"
+#include "Fw/Types/Serializable.hpp"
+#include "Os/File.hpp"
+#include "Os/Mutex.hpp"
+
+// SFINAE type enabling the function only if T is a fundamental type or is derived from Fw::Serializable, excluding
+// Fw::Buffer
+#define T_VALUE_STATUS typename std::enable_if<std::is_fundamental<T>::value || (std::is_base_of<Fw::Serializable, T>::value && !std::is_same<T, Fw::Buffer>::value), Os::File::Status>::type
+
+namespace Utilities {
+namespace FileHelper {
+
+//! \brief persistent store of small primitive and serializable values keyed by integers or strings
+//!
+//! Every entry is held in memory in a hash table of FILE_HELPER_KV_MAX_ENTRIES entries, such that reads never touch
+//! the file. Each change is appended to a Journal as a single record, and the table is rebuilt by replaying the
+//! journal on open. Records are committed according to the journal group commit, one record at a time by default.
+//! Each record holds the following, all fields big-endian:
+//!
+//! | Field    | Type | Description                                   |
+//! |----------|------|-----------------------------------------------|
+//! | op       | U8   | SET or REMOVE                                 |
+//! | key kind | U8   | KEY_INTEGER or KEY_STRING                     |
+//! | key size | U8   | Size of the key                               |
+//! | key      | U8[] | Integer keys as a U32, string keys as chars   |
+//! | value    | U8[] | Serialized value, SET records only            |
+//!
+//! Replaced and removed values remain in the journal until it is compacted, which writes only the live entries to a
+//! new journal renamed over the old one. Call compactIfDue periodically from a low-priority context, such as a slow
+//! rate group, to compact once the journal has grown well past the live entries. All functions may be called from
+//! different threads. Reads and writes continue while a compaction writes the live entries, waiting only while the
+//! compacted journal is swapped in, whereas open and close wait for a compaction in progress.
+//!
+//! Integer and string keys are distinct: the integer key 1 and string key "1" name different entries. Values are
+//! stored as serialized and are read back as any type that deserializes from them.
+class KeyValueStore : private JournalReplayer {
+  public:
+    //! Kinds of key
+    enum KeyKind : U8 { KEY_INTEGER = 0, KEY_STRING = 1 };
+
+    //! Operations recorded in the journal
+    enum Operation : U8 { SET = 0, REMOVE = 1 };
+
+    //! Size of the op, key kind, and key size fields preceding the key of each record
+    static constexpr FwSizeType RECORD_PREFIX_SIZE = 3;
+
+    //! Construct a closed store
+    KeyValueStore();
+
+    //! Destroy the store, committing and closing it if open
+    ~KeyValueStore();
+
+    KeyValueStore(const KeyValueStore&) = delete;
+    KeyValueStore& operator=(const KeyValueStore&) = delete;
+
+    //! \brief open the store backed by the journal at path, loading its entries
+    //!
+    //! \warning It is invalid to open a store that is already open or to supply a null path and results in an
+    //!          assertion failure.
+    //!
+    //! \param path path of the journal file, created when missing
+    //! \return status of opening the journal
+    Os::File::Status open(const CHAR* path);
+
+    //! \brief commit any pending changes and close the store, clearing its entries
+    //!
+    //! \return status of the commit
+    Os::File::Status close();
+
+    //! \brief check if the store is open
+    bool isOpen() const;
+
+    //! \brief set when pending changes are committed, see Journal::setGroupCommit
+    void setGroupCommit(FwSizeType records, U32 windowUs);
+
+    //! \brief commit pending changes, see Journal::commit
+    //!
+    //! \return status of the commit, NOT_OPENED when the store is not open
+    Os::File::Status commit();
+
+    //! \brief commit pending changes when due, see Journal::commitIfDue
+    //!
+    //! \return status of any commit made, NOT_OPENED when the store is not open
+    Os::File::Status commitIfDue();
+
+    //! \brief set the value of an integer key
+    //!
+    //! The value is serialized and appended to the journal, then stored in memory. Setting a key to the value it holds
+    //! writes nothing. A store whose journal was closed by a write error refuses changes until it is reopened.
+    //!
+    //! \tparam T type of the value. Must be fundamental or derive from Fw::Serializable, and serialize to at most
+    //!         FILE_HELPER_KV_MAX_VALUE_SIZE bytes.
+    //! \param key the key
+    //! \param value the value
+    //! \return status of the append, NO_SPACE when the key is new and every entry is used, NOT_OPENED when the store is
+    //!         not open
+    template <typename T>
+    T_VALUE_STATUS set(U32 key, const T& value) {
+        U8 key_data[sizeof(U32)];
+        encodeKey(key, key_data);
+        return this->setObject(KEY_INTEGER, key_data, sizeof(key_data), value);
+    }
+
+    //! \brief set the value of a string key, see set(U32, const T&)
+    //!
+    //! \warning It is invalid to supply a null key or one longer than FILE_HELPER_KV_MAX_KEY_SIZE and results in an
+    //!          assertion failure.
+    template <typename T>
+    T_VALUE_STATUS set(const CHAR* key, const T& value) {
+        return this->setObject(KEY_STRING, reinterpret_cast<const U8*>(key), stringKeySize(key), value);
+    }
+
+    //! \brief get the value of an integer key
+    //!
+    //! \tparam T type of the value. Must be fundamental or derive from Fw::Serializable.
+    //! \param key the key
+    //! \param value set to the value
+    //! \return OP_OK, DOESNT_EXIST when the key has no value, or BAD_SIZE or OTHER_ERROR when the value does not
+    //!         deserialize as T
+    template <typename T>
+    T_VALUE_STATUS get(U32 key, T& value) const {
+        U8 key_data[sizeof(U32)];
+        encodeKey(key, key_data);
+        return this->getObject(KEY_INTEGER, key_data, sizeof(key_data), value);
+    }
+
+    //! \brief get the value of a string key, see get(U32, T&)
+    //!
+    //! \warning It is invalid to supply a null key or one longer than FILE_HELPER_KV_MAX_KEY_SIZE and results in an
+    //!          assertion failure.
+    template <typename T>
+    T_VALUE_STATUS get(const CHAR* key, T& value) const {
+        return this->getObject(KEY_STRING, reinterpret_cast<const U8*>(key), stringKeySize(key), value);
+    }
+
+    //! \brief check if an integer key has a value
+    bool contains(U32 key) const;
+
+    //! \brief check if a string key has a value
+    bool contains(const CHAR* key) const;
+
+    //! \brief remove the value of an integer key
+    //!
+    //! \return status of the append, DOESNT_EXIST when the key has no value, NOT_OPENED when the store is not open
+    Os::File::Status remove(U32 key);
+
+    //! \brief remove the value of a string key, see remove(U32)
+    Os::File::Status remove(const CHAR* key);
+
+    //! \brief get the number of keys with values
+    FwSizeType getCount() const;
+
+    //! \brief get the size of the journal, including replaced and removed values
+    FwSizeType getLogSize() const;
+
+    //! \brief rewrite the journal holding only the live entries
+    //!
+    //! The live entries are copied and written to a temporary journal that is renamed over the journal, such that an
+    //! interrupted compaction leaves the journal intact. The copy is written and flushed without holding the store
+    //! lock, records appended to the journal meanwhile are then copied to the end of the temporary journal before it
+    //! is swapped in. The journal is reopened even when compaction fails, and the store is left closed only when that
+    //! fails. Compactions are made one at a time.
+    //!
+    //! \return status of the compaction, NOT_OPENED when the store is not open
+    Os::File::Status compact();
+
+    //! \brief compact when the journal exceeds FILE_HELPER_KV_COMPACT_RATIO times the live entries and
+    //!        FILE_HELPER_KV_COMPACT_MIN_SIZE bytes
+    //!
+    //! \return status of any compaction made, NOT_OPENED when the store is not open
+    Os::File::Status compactIfDue();
+
+  private:
+    //! \brief an entry of the hash table
+    struct Entry {
+        bool m_used;                                          //!< Entry holds a key
+        U8 m_keyKind;                                         //!< Kind of the key
+        U8 m_keySize;                                         //!< Size of the key
+        U8 m_key[Utilities::FILE_HELPER_KV_MAX_KEY_SIZE];     //!< Key
+        FwSizeType m_valueSize;                               //!< Size of the serialized value
+        U8 m_value[Utilities::FILE_HELPER_KV_MAX_VALUE_SIZE];  //!< Serialized value
+    };
+
+    //! \brief serialize value and set it as the value of key
+    template <typename T>
+    Os::File::Status setObject(U8 keyKind, const U8* key, FwSizeType keySize, const T& value) {
+        static_assert(SerializedSize<T>::value <= Utilities::FILE_HELPER_KV_MAX_VALUE_SIZE,
+                      "Values must serialize to at most FILE_HELPER_KV_MAX_VALUE_SIZE bytes");
+        U8 data[SerializedSize<T>::value];
+        Fw::ExternalSerializeBuffer serializer(data, sizeof(data));
+        Fw::SerializeStatus serializeStatus = serializer.serializeFrom(value);
+        FW_ASSERT(serializeStatus == Fw::SerializeStatus::FW_SERIALIZE_OK,
+                  static_cast<FwAssertArgType>(serializeStatus));
+        return this->setValue(keyKind, key, keySize, data, serializer.getSize());
+    }
+
+    //! \brief deserialize the value of key into value
+    template <typename T>
+    Os::File::Status getObject(U8 keyKind, const U8* key, FwSizeType keySize, T& value) const {
+        U8 data[Utilities::FILE_HELPER_KV_MAX_VALUE_SIZE];
+        FwSizeType size = 0;
+        Os::File::Status status = this->getValue(keyKind, key, keySize, data, size);
+        if (status == Os::File::Status::OP_OK) {
+            Fw::ExternalSerializeBuffer deserializer(data, sizeof(data));
+            (void)deserializer.setBuffLen(size);
+            Fw::SerializeStatus serializeStatus = deserializer.deserializeTo(value);
+            if (serializeStatus == Fw::SerializeStatus::FW_DESERIALIZE_BUFFER_EMPTY) {
+                status = Os::File::Status::BAD_SIZE;
+            } else if (serializeStatus != Fw::SerializeStatus::FW_SERIALIZE_OK) {
+                status = Os::File::Status::OTHER_ERROR;
+            }
+        }
+        return status;
+    }
+
+    //! \brief encode an integer key as its big-endian bytes
+    static void encodeKey(U32 key, U8* data);
+
+    //! \brief get the size of a string key, asserting it is valid
+    static FwSizeType stringKeySize(const CHAR* key);
+
+    //! \brief append a SET record and store the value of key
+    Os::File::Status setValue(U8 keyKind, const U8* key, FwSizeType keySize, const U8* value, FwSizeType valueSize);
+
+    //! \brief copy the value of key into value, which holds FILE_HELPER_KV_MAX_VALUE_SIZE bytes
+    Os::File::Status getValue(U8 keyKind, const U8* key, FwSizeType keySize, U8* value, FwSizeType& valueSize) const;
+
+    //! \brief append a REMOVE record and remove the value of key
+    Os::File::Status removeValue(U8 keyKind, const U8* key, FwSizeType keySize);
+
+    //! \brief append a record to journal
+    static Os::File::Status appendRecord(Journal& journal,
+                                         U8 op,
+                                         U8 keyKind,
+                                         const U8* key,
+                                         FwSizeType keySize,
+                                         const U8* value,
+                                         FwSizeType valueSize);
+
+    //! \brief write the live entries copied to m_snapshot to the temporary journal and flush it
+    Os::File::Status writeSnapshot();
+
+    //! \brief append the bytes of the closed journal from offset to the end of the temporary journal and flush it
+    Os::File::Status appendJournalTail(FwSizeType offset) const;
+
+    //! \brief apply a record replayed from the journal
+    void replayRecord(Fw::Buffer& record) override;
+
+    //! \brief find the entry of key, or the free entry where it would be inserted
+    //!
+    //! \return index of the entry, FILE_HELPER_KV_MAX_ENTRIES when key is absent and every entry is used
+    FwSizeType find(U8 keyKind, const U8* key, FwSizeType keySize) const;
+
+    //! \brief store the value of key in the entry at index
+    void store(FwSizeType index, U8 keyKind, const U8* key, FwSizeType keySize, const U8* value, FwSizeType valueSize);
+
+    //! \brief clear the entry at index, moving later entries of its probe sequence back
+    void erase(FwSizeType index);
+
+    //! \brief get the size of the record of the entry at index
+    FwSizeType recordSize(FwSizeType index) const;
+
+    //! \brief get the hash table index where the search for key starts
+    static FwSizeType home(U8 keyKind, const U8* key, FwSizeType keySize);
+
+    mutable Os::Mutex m_lock;                                           //!< Lock of the entries and journal
+    Os::Mutex m_compactLock;  //!< Lock held through a compaction, and by open and close, taken before m_lock
+    StaticJournal<Utilities::FILE_HELPER_JOURNAL_BUFFER_SIZE> m_journal;  //!< Journal of changes
+    StaticJournal<Utilities::FILE_HELPER_JOURNAL_BUFFER_SIZE> m_compactJournal;  //!< Journal written by compact
+    Fw::FileNameString m_path;                                          //!< Path of the journal
+    Fw::FileNameString m_tempPath;                                      //!< Path of the journal written by compact
+    FwSizeType m_groupRecords;                                          //!< Journal group commit count
+    U32 m_groupWindowUs;                                                //!< Journal group commit window
+    FwSizeType m_count;                                                 //!< Entries used
+    FwSizeType m_liveSize;  //!< Size of a journal holding only the live entries
+    Entry m_entries[Utilities::FILE_HELPER_KV_MAX_ENTRIES];  //!< Hash table of entries
+    Entry m_snapshot[Utilities::FILE_HELPER_KV_MAX_ENTRIES];  //!< Entries copied by compact for writing unlocked
+};
+
+}  // namespace FileHelper
+}  // namespace Utilities
+#endif  // FprimeExtras_Utilities_FileHelper_KeyValueStore_HPP
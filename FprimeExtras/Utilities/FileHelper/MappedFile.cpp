@@ -0,0 +1,134 @@
+// ======================================================================
+// \title  MappedFile.cpp
+// \author starchmd
+// \brief  cpp file for FileHelper read-only memory-mapped file
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#include "FprimeExtras/Utilities/FileHelper/MappedFile.hpp"
+#include "Fw/Types/Assert.hpp"
+
+#if defined(__linux__)
+#include <cerrno>
+#include <limits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Utilities {
+namespace FileHelper {
+
+MappedFile ::MappedFile() : m_data(nullptr), m_size(0), m_open(false) {}
+
+MappedFile ::~MappedFile() {
+    this->close();
+}
+
+bool MappedFile ::isOpen() const {
+    return this->m_open;
+}
+
+FwSizeType MappedFile ::getSize() const {
+    return this->m_size;
+}
+
+const U8* MappedFile ::getData() const {
+    return this->m_data;
+}
+
+Fw::Buffer MappedFile ::getBuffer() const {
+    return this->getBuffer(0, this->m_size);
+}
+
+Fw::Buffer MappedFile ::getBuffer(FwSizeType offset, FwSizeType size) const {
+    FW_ASSERT(offset <= this->m_size, static_cast<FwAssertArgType>(offset));
+    FW_ASSERT(size <= (this->m_size - offset), static_cast<FwAssertArgType>(size));
+    if (size == 0) {
+        return Fw::Buffer();
+    }
+    // Fw::Buffer has no read-only form, the pages themselves are protected against writes
+    return Fw::Buffer(this->m_data + offset, size);
+}
+
+#if defined(__linux__)
+namespace {
+
+//! \brief convert an errno from opening or mapping a file to the matching file status
+Os::File::Status errnoToStatus(int error) {
+    switch (error) {
+        case ENOENT:
+        case ENOTDIR:
+            return Os::File::Status::DOESNT_EXIST;
+        case EACCES:
+        case EPERM:
+            return Os::File::Status::NO_PERMISSION;
+        case EINVAL:
+        case ENODEV:
+            return Os::File::Status::NOT_SUPPORTED;
+        case EFBIG:
+        case EOVERFLOW:
+            return Os::File::Status::BAD_SIZE;
+        default:
+            return Os::File::Status::OTHER_ERROR;
+    }
+}
+
+}  // namespace
+
+Os::File::Status MappedFile ::open(const CHAR* filepath) {
+    FW_ASSERT(filepath != nullptr);
+    this->close();
+    const int descriptor = ::open(filepath, O_RDONLY | O_CLOEXEC);
+    if (descriptor < 0) {
+        return errnoToStatus(errno);
+    }
+    Os::File::Status status = Os::File::Status::OP_OK;
+    struct stat file_stat;
+    if (::fstat(descriptor, &file_stat) != 0) {
+        status = errnoToStatus(errno);
+    } else if (!S_ISREG(file_stat.st_mode)) {
+        status = Os::File::Status::NOT_SUPPORTED;
+    } else if (static_cast<U64>(file_stat.st_size) > std::numeric_limits<size_t>::max()) {
+        status = Os::File::Status::BAD_SIZE;
+    } else if (file_stat.st_size > 0) {
+        const FwSizeType size = static_cast<FwSizeType>(file_stat.st_size);
+        void* mapped = ::mmap(nullptr, static_cast<size_t>(size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (mapped == MAP_FAILED) {
+            status = errnoToStatus(errno);
+        } else {
+            this->m_data = static_cast<U8*>(mapped);
+            this->m_size = size;
+        }
+    }
+    // The mapping holds its own reference to the file, the descriptor is no longer needed
+    (void)::close(descriptor);
+    this->m_open = (status == Os::File::Status::OP_OK);
+    return status;
+}
+
+void MappedFile ::close() {
+    if (this->m_data != nullptr) {
+        (void)::munmap(this->m_data, static_cast<size_t>(this->m_size));
+    }
+    this->m_data = nullptr;
+    this->m_size = 0;
+    this->m_open = false;
+}
+#else
+Os::File::Status MappedFile ::open(const CHAR* filepath) {
+    FW_ASSERT(filepath != nullptr);
+    // Memory mapping is only supported on Linux
+    this->close();
+    return Os::File::Status::NOT_SUPPORTED;
+}
+
+void MappedFile ::close() {
+    this->m_data = nullptr;
+    this->m_size = 0;
+    this->m_open = false;
+}
+#endif
+
+}  // namespace FileHelper
+}  // namespace Utilities
@@ -0,0 +1,83 @@
+// ======================================================================
+// \title  MappedFile.hpp
+// \author starchmd
+// \brief  hpp file for FileHelper read-only memory-mapped file
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#ifndef FprimeExtras_Utilities_FileHelper_MappedFile_HPP
+#define FprimeExtras_Utilities_FileHelper_MappedFile_HPP
+
+#include "Fw/Buffer/Buffer.hpp"
+#include "Fw/FPrimeBasicTypes.hpp"
+#include "Os/File.hpp"
+
+namespace Utilities {
+namespace FileHelper {
+
+//! \brief read-only view of a whole file mapped into memory
+//!
+//! Maps the contents of a file into memory such that they are read in place rather than copied into a caller-owned
+//! buffer. Opening costs the same regardless of the file size, pages are read by the operating system as they are first
+//! touched. The mapping is released when the MappedFile is closed or destroyed, invalidating every view of it.
+//!
+//! Views are returned as Fw::Buffer such that they may be passed wherever a buffer is read. The mapping is read-only and
+//! writing through a view is invalid. Changes made to the file while mapped may or may not be seen through the
+//! mapping, and truncating a mapped file is invalid. Memory mapping is only supported on Linux, elsewhere open returns
+//! NOT_SUPPORTED and callers should fall back to FileHelper::readFromFile.
+class MappedFile {
+  public:
+    //! \brief construct a closed mapping
+    MappedFile();
+
+    //! \brief destroy the mapping, closing it if open
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    //! \brief map the contents of a file
+    //!
+    //! Maps the file at filepath read-only, closing any mapping already open. An empty file opens successfully with a
+    //! size of zero and no data.
+    //!
+    //! \warning It is invalid to supply a null filepath and results in an assertion failure.
+    //!
+    //! \param filepath path of the file to map
+    //! \return OP_OK on success, NOT_SUPPORTED where mapping is unavailable, otherwise the reason the file was not mapped
+    Os::File::Status open(const CHAR* filepath);
+
+    //! \brief release the mapping, if open
+    void close();
+
+    //! \brief check if a file is mapped
+    bool isOpen() const;
+
+    //! \brief get the size of the mapped file in bytes
+    FwSizeType getSize() const;
+
+    //! \brief get the mapped file contents, null when closed or the file is empty
+    const U8* getData() const;
+
+    //! \brief get a read-only view of the whole mapped file
+    //!
+    //! The view is invalid when the mapping is closed or the file is empty.
+    Fw::Buffer getBuffer() const;
+
+    //! \brief get a read-only view of part of the mapped file
+    //!
+    //! \warning It is invalid to request a view past the end of the file and results in an assertion failure.
+    //!
+    //! \param offset offset of the view from the start of the file
+    //! \param size size of the view in bytes
+    //! \return view of size bytes at offset, invalid when size is zero
+    Fw::Buffer getBuffer(FwSizeType offset, FwSizeType size) const;
+
+  private:
+    U8* m_data;         //!< Start of the mapping, null when closed or the file is empty
+    FwSizeType m_size;  //!< Size of the mapped file
+    bool m_open;        //!< A file is mapped
+};
+
+}  // namespace FileHelper
+}  // namespace Utilities
+#endif  // FprimeExtras_Utilities_FileHelper_MappedFile_HPP
@@ -0,0 +1,271 @@
+// ======================================================================
+// \title  RecordFile.hpp
+// \author starchmd
+// \brief  hpp file for FileHelper fixed-size record file
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#ifndef FprimeExtras_Utilities_FileHelper_RecordFile_HPP
+#define FprimeExtras_Utilities_FileHelper_RecordFile_HPP
+
+#include "ExtrasConfig/FileHelperConfig.hpp"
+#include "FprimeExtras/Utilities/FileHelper/FileHelper.hpp"
+#include "Fw/FPrimeBasicTypes.hpp"
+#include "Fw/Types/Assert.hpp"
+#include "Os/File.hpp"
+
+namespace Utilities {
+namespace FileHelper {
+
+//! \brief file of fixed-size records of one type, accessed by index
+//!
+//! Every record of type T occupies exactly the size written by writeToFile, T::SERIALIZED_SIZE for serializables and
+//! sizeof(T) for primitives. Record i is therefore found at a known offset and is read or written with a single seek,
+//! and the record count follows from the file size. The file consists of a header followed by the records. All header
+//! fields are big-endian:
+//!
+//! | Field       | Type | Description                  |
+//! |-------------|------|------------------------------|
+//! | magic       | U32  | RECORD_FILE_MAGIC            |
+//! | record size | U64  | Size of each record in bytes |
+//!
+//! A partial record at the end of the file, as left by an interrupted append, is not counted and is overwritten by the
+//! next append. Os::File opens files either for reading or for writing, so a record file is opened with OPEN_READ to
+//! read records, or with OPEN_WRITE or OPEN_CREATE to write them. Open the path twice to do both.
+//!
+//! \tparam T type of each record. Must be fundamental or derive from Fw::Serializable.
+template <typename T>
+class RecordFile {
+  public:
+    //! Magic number identifying a record file: "RECF"
+    static constexpr U32 RECORD_FILE_MAGIC = 0x52454346;
+
+    //! Size of the file header
+    static constexpr FwSizeType HEADER_SIZE = sizeof(U32) + sizeof(U64);
+
+    //! Size of each record
+    static constexpr FwSizeType RECORD_SIZE = SerializedSize<T>::value;
+
+    static_assert(RECORD_SIZE > 0, "Records must have a non-zero serialized size");
+
+    //! Construct a closed record file
+    RecordFile() : m_writable(false) {}
+
+    //! Destroy the record file, closing it if open
+    ~RecordFile() { this->close(); }
+
+    RecordFile(const RecordFile&) = delete;
+    RecordFile& operator=(const RecordFile&) = delete;
+
+    //! \brief open the record file at path
+    //!
+    //! OPEN_READ opens an existing record file for reading. OPEN_WRITE opens a record file for writing, creating it
+    //! when missing or empty, and OPEN_CREATE creates an empty record file, overwriting any existing file. The header
+    //! of an existing file is checked, returning OTHER_ERROR when the magic does not match and BAD_SIZE when the file
+    //! holds records of another size.
+    //!
+    //! \warning It is invalid to open a record file that is already open, to supply a null path, or to supply another
+    //!          mode and results in an assertion failure.
+    //!
+    //! \param path path of the record file
+    //! \param mode OPEN_READ, OPEN_WRITE, or OPEN_CREATE
+    //! \return status of opening the file and reading or writing the header
+    Os::File::Status open(const CHAR* path, Os::File::Mode mode) {
+        FW_ASSERT(path != nullptr);
+        FW_ASSERT(!this->isOpen());
+        FW_ASSERT((mode == Os::File::Mode::OPEN_READ) || (mode == Os::File::Mode::OPEN_WRITE) ||
+                      (mode == Os::File::Mode::OPEN_CREATE),
+                  static_cast<FwAssertArgType>(mode));
+        Os::File::Status status = Os::File::Status::OP_OK;
+        if (mode == Os::File::Mode::OPEN_READ) {
+            status = this->m_file.open(path, mode);
+            if (status == Os::File::Status::OP_OK) {
+                status = this->checkHeader(this->m_file);
+            }
+        } else {
+            status = this->m_file.open(path, mode, Os::File::OverwriteType::OVERWRITE);
+            FwSizeType size = 0;
+            if (status == Os::File::Status::OP_OK) {
+                status = this->m_file.size(size);
+            }
+            if ((status == Os::File::Status::OP_OK) && (size == 0)) {
+                status = writeToFile(this->m_file, RECORD_FILE_MAGIC, static_cast<U64>(RECORD_SIZE));
+            } else if (status == Os::File::Status::OP_OK) {
+                // Files opened for writing cannot be read, the existing header is checked through a second handle
+                Os::File reader;
+                status = reader.open(path, Os::File::Mode::OPEN_READ);
+                if (status == Os::File::Status::OP_OK) {
+                    status = this->checkHeader(reader);
+                    reader.close();
+                }
+            }
+        }
+        if (status != Os::File::Status::OP_OK) {
+            this->m_file.close();
+        }
+        this->m_writable = (mode != Os::File::Mode::OPEN_READ);
+        return status;
+    }
+
+    //! \brief close the record file, if open
+    void close() { this->m_file.close(); }
+
+    //! \brief check if the record file is open
+    bool isOpen() const { return this->m_file.isOpen(); }
+
+    //! \brief get the number of whole records in the file
+    //!
+    //! \warning It is invalid to call this function on a record file that is not open and results in an assertion
+    //!          failure.
+    //!
+    //! \param count set to the number of records
+    //! \return status of reading the file size
+    Os::File::Status getCount(FwSizeType& count) {
+        FW_ASSERT(this->isOpen());
+        FwSizeType size = 0;
+        Os::File::Status status = this->m_file.size(size);
+        count = 0;
+        if ((status == Os::File::Status::OP_OK) && (size > HEADER_SIZE)) {
+            count = (size - HEADER_SIZE) / RECORD_SIZE;
+        }
+        return status;
+    }
+
+    //! \brief read record index
+    //!
+    //! \warning It is invalid to call this function on a record file that is not open for reading and results in an
+    //!          assertion failure.
+    //!
+    //! \param index index of the record
+    //! \param record set to the record read
+    //! \return status of the read, BAD_SIZE when there is no record index
+    Os::File::Status read(FwSizeType index, T& record) {
+        FW_ASSERT(this->isOpen() && !this->m_writable);
+        FwSizeType count = 0;
+        Os::File::Status status = this->getCount(count);
+        if ((status == Os::File::Status::OP_OK) && (index >= count)) {
+            status = Os::File::Status::BAD_SIZE;
+        }
+        if (status == Os::File::Status::OP_OK) {
+            status = this->seekRecord(index);
+        }
+        if (status == Os::File::Status::OP_OK) {
+            status = readFromFile(this->m_file, record);
+        }
+        return status;
+    }
+
+    //! \brief read consecutive records starting at record first
+    //!
+    //! Reads up to count records into records, stopping early at the end of the file. A first equal to the record count
+    //! is the end of the file and reads no records. The records are read through a stack buffer of
+    //! FILE_HELPER_STAGING_BUFFER_SIZE bytes such that small records cost one file read per buffer.
+    //!
+    //! \warning It is invalid to call this function on a record file that is not open for reading, or to supply null
+    //!          records with a non-zero count, and results in an assertion failure.
+    //!
+    //! \param first index of the first record to read, at most the record count
+    //! \param records storage for at least count records
+    //! \param count number of records to read, set to the number of records read
+    //! \return status of the reads, BAD_SIZE when first is past the record count
+    Os::File::Status readRange(FwSizeType first, T* records, FwSizeType& count) {
+        FW_ASSERT(this->isOpen() && !this->m_writable);
+        FW_ASSERT((records != nullptr) || (count == 0));
+        FwSizeType available = 0;
+        Os::File::Status status = this->getCount(available);
+        const FwSizeType requested = count;
+        count = 0;
+        if ((status == Os::File::Status::OP_OK) && (first > available)) {
+            status = Os::File::Status::BAD_SIZE;
+        }
+        if (status == Os::File::Status::OP_OK) {
+            status = this->seekRecord(first);
+        }
+        if (status == Os::File::Status::OP_OK) {
+            const FwSizeType total = FW_MIN(requested, available - first);
+            U8 staging[Utilities::FILE_HELPER_STAGING_BUFFER_SIZE];
+            BufferedReader reader(this->m_file, staging, sizeof(staging));
+            // Never read ahead past the last record requested
+            reader.setReadAhead(total * RECORD_SIZE);
+            while ((count < total) && (status == Os::File::Status::OP_OK)) {
+                status = readFromFile(reader, records[count]);
+                count += (status == Os::File::Status::OP_OK) ? 1 : 0;
+            }
+        }
+        return status;
+    }
+
+    //! \brief write record index, replacing the record or appending it when index is the record count
+    //!
+    //! \warning It is invalid to call this function on a record file that is not open for writing and results in an
+    //!          assertion failure.
+    //!
+    //! \param index index of the record, at most the record count
+    //! \param record the record to write
+    //! \return status of the write, BAD_SIZE when index is past the record count
+    Os::File::Status write(FwSizeType index, const T& record) {
+        FW_ASSERT(this->isOpen() && this->m_writable);
+        FwSizeType count = 0;
+        Os::File::Status status = this->getCount(count);
+        if ((status == Os::File::Status::OP_OK) && (index > count)) {
+            status = Os::File::Status::BAD_SIZE;
+        }
+        if (status == Os::File::Status::OP_OK) {
+            status = this->seekRecord(index);
+        }
+        if (status == Os::File::Status::OP_OK) {
+            status = writeToFile(this->m_file, record);
+        }
+        return status;
+    }
+
+    //! \brief append a record after the last record in the file
+    //!
+    //! \warning It is invalid to call this function on a record file that is not open for writing and results in an
+    //!          assertion failure.
+    //!
+    //! \param record the record to write
+    //! \return status of the write
+    Os::File::Status append(const T& record) {
+        FW_ASSERT(this->isOpen() && this->m_writable);
+        FwSizeType count = 0;
+        Os::File::Status status = this->getCount(count);
+        if (status == Os::File::Status::OP_OK) {
+            status = this->write(count, record);
+        }
+        return status;
+    }
+
+  private:
+    //! \brief check the header at the start of file matches records of type T
+    Os::File::Status checkHeader(Os::File& file) {
+        U32 magic = 0;
+        U64 record_size = 0;
+        Os::File::Status status = readFromFile(file, magic, record_size);
+        if ((status == Os::File::Status::OP_OK) && (magic != RECORD_FILE_MAGIC)) {
+            status = Os::File::Status::OTHER_ERROR;
+        } else if ((status == Os::File::Status::OP_OK) && (record_size != RECORD_SIZE)) {
+            status = Os::File::Status::BAD_SIZE;
+        }
+        return status;
+    }
+
+    //! \brief position the file at the start of record index
+    Os::File::Status seekRecord(FwSizeType index) {
+        return this->m_file.seek(static_cast<FwSignedSizeType>(HEADER_SIZE + (index * RECORD_SIZE)),
+                                 Os::File::SeekType::ABSOLUTE);
+    }
+
+    Os::File m_file;  //!< Record file
+    bool m_writable;  //!< File is open for writing rather than reading
+};
+
+template <typename T>
+constexpr U32 RecordFile<T>::RECORD_FILE_MAGIC;
+template <typename T>
+constexpr FwSizeType RecordFile<T>::HEADER_SIZE;
+template <typename T>
+constexpr FwSizeType RecordFile<T>::RECORD_SIZE;
+
+}  // namespace FileHelper
+}  // namespace Utilities
+#endif  // FprimeExtras_Utilities_FileHelper_RecordFile_HPP
@@ -0,0 +1,220 @@
+// ======================================================================
+// \title  FileHelperBenchmark.cpp
+// \author starchmd
+// \brief  cpp file for FileHelper per-call and bulk I/O benchmark
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+//
+// Measures the cost of FileHelper calls in each directory given, such as a tmpfs mount and a disk-backed directory, to
+// separate the cost of the calls from the cost of the storage:
+//
+//  - path: writeToFile and readFromFile of a U32 by path, opening and closing the file each call, against the same
+//    calls on a file opened once
+//  - object: writeToFile of a U64 primitive, of a serializable of the same size, and of a U64 through a
+//    StaticBufferedWriter, showing the per-call system call and serializer costs
+//  - record: writeToFile and readFromFile of a single buffer of each size from 1 B to 16 MiB
+//
+// Each measurement runs repeatedly until at least total_megabytes are moved or the operation count is reached. Usage:
+//
+//     FileHelperBenchmark [total_megabytes] [directory ...]
+//
+// The directory defaults to the working directory, e.g. pass /dev/shm and a disk-backed directory on Linux. Results are
+// printed one line per measurement as:
+// directory benchmark variant bytes_per_op ops ns_per_op megabytes_per_second
+//
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "FprimeExtras/Utilities/FileHelper/FileHelper.hpp"
+#include "Fw/Types/Serializable.hpp"
+#include "Os/FileSystem.hpp"
+
+namespace {
+
+//! Default amount of data moved per record measurement
+constexpr FwSizeType DEFAULT_TOTAL_MEGABYTES = 64;
+
+//! Operations measured per call-cost measurement
+constexpr FwSizeType CALL_OPS = 20000;
+
+//! Operations measured per path measurement, each of which opens and closes the file
+constexpr FwSizeType PATH_OPS = 2000;
+
+//! Smallest and largest record sizes measured, each size four times the last
+constexpr FwSizeType MIN_RECORD_SIZE = 1;
+constexpr FwSizeType MAX_RECORD_SIZE = 16 * 1024 * 1024;
+
+//! Name of the file written in each directory
+const CHAR* const BENCHMARK_FILENAME = "file_helper_benchmark.bin";
+
+//! Prevents the compiler from discarding benchmark results
+volatile U64 g_sink = 0;
+
+//! \brief serializable of the same size as a U64, measuring the cost of the serializable path
+struct BenchmarkSerializable : public Fw::Serializable {
+    enum { SERIALIZED_SIZE = sizeof(U64) };
+
+    Fw::SerializeStatus serializeTo(Fw::SerialBufferBase& buffer, Fw::Endianness = Fw::Endianness::BIG) const {
+        return buffer.serializeFrom(this->m_value);
+    }
+
+    Fw::SerializeStatus deserializeFrom(Fw::SerialBufferBase& buffer, Fw::Endianness = Fw::Endianness::BIG) {
+        return buffer.deserializeTo(this->m_value);
+    }
+
+    U64 m_value = 0;
+};
+
+//! \brief run operation ops times, returning nanoseconds per operation or a negative value on error
+template <typename Operation>
+double measure(FwSizeType ops, Operation operation) {
+    auto start = std::chrono::steady_clock::now();
+    for (FwSizeType i = 0; i < ops; i++) {
+        if (!operation(i)) {
+            return -1.0;
+        }
+    }
+    auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(ops);
+}
+
+//! \brief print one measurement
+void report(const char* directory,
+            const char* benchmark,
+            const char* variant,
+            FwSizeType bytes,
+            FwSizeType ops,
+            double ns_per_op) {
+    const double megabytes_per_second =
+        (ns_per_op > 0.0) ? (static_cast<double>(bytes) * 1e9) / (ns_per_op * 1024.0 * 1024.0) : 0.0;
+    (void)::printf("%s %s %s %" PRI_FwSizeType " %" PRI_FwSizeType " %.1f %.2f\n", directory, benchmark, variant,
+                   bytes, ops, ns_per_op, megabytes_per_second);
+}
+
+//! \brief measure writing and reading a U32 by path against the same calls on an open file
+void benchmarkPath(const char* directory, const CHAR* path) {
+    const double write_path = measure(PATH_OPS, [&](FwSizeType i) {
+        return Utilities::FileHelper::writeToFile(path, static_cast<U32>(i)) == Os::File::Status::OP_OK;
+    });
+    report(directory, "path", "write_path", sizeof(U32), PATH_OPS, write_path);
+    const double read_path = measure(PATH_OPS, [&](FwSizeType i) {
+        U32 value = 0;
+        const bool ok = Utilities::FileHelper::readFromFile(path, value) == Os::File::Status::OP_OK;
+        g_sink = g_sink + value;
+        return ok;
+    });
+    report(directory, "path", "read_path", sizeof(U32), PATH_OPS, read_path);
+
+    Os::File file;
+    if (file.open(path, Os::File::OPEN_CREATE, Os::File::OVERWRITE) != Os::File::OP_OK) {
+        return;
+    }
+    const double write_file = measure(PATH_OPS, [&](FwSizeType i) {
+        return (file.seek(0, Os::File::SeekType::ABSOLUTE) == Os::File::OP_OK) &&
+               (Utilities::FileHelper::writeToFile(file, static_cast<U32>(i)) == Os::File::Status::OP_OK);
+    });
+    file.close();
+    report(directory, "path", "write_file", sizeof(U32), PATH_OPS, write_file);
+    if (file.open(path, Os::File::OPEN_READ) != Os::File::OP_OK) {
+        return;
+    }
+    const double read_file = measure(PATH_OPS, [&](FwSizeType i) {
+        U32 value = 0;
+        const bool ok = (file.seek(0, Os::File::SeekType::ABSOLUTE) == Os::File::OP_OK) &&
+                        (Utilities::FileHelper::readFromFile(file, value) == Os::File::Status::OP_OK);
+        g_sink = g_sink + value;
+        return ok;
+    });
+    file.close();
+    report(directory, "path", "read_file", sizeof(U32), PATH_OPS, read_file);
+}
+
+//! \brief measure appending a primitive, a serializable of the same size, and a buffered primitive
+void benchmarkObject(const char* directory, const CHAR* path) {
+    Os::File file;
+    if (file.open(path, Os::File::OPEN_CREATE, Os::File::OVERWRITE) != Os::File::OP_OK) {
+        return;
+    }
+    const double primitive = measure(CALL_OPS, [&](FwSizeType i) {
+        return Utilities::FileHelper::writeToFile(file, static_cast<U64>(i)) == Os::File::Status::OP_OK;
+    });
+    report(directory, "object", "primitive", sizeof(U64), CALL_OPS, primitive);
+    BenchmarkSerializable serializable;
+    const double serialized = measure(CALL_OPS, [&](FwSizeType i) {
+        serializable.m_value = i;
+        return Utilities::FileHelper::writeToFile(file, serializable) == Os::File::Status::OP_OK;
+    });
+    report(directory, "object", "serializable", sizeof(U64), CALL_OPS, serialized);
+    double buffered = -1.0;
+    {
+        Utilities::FileHelper::StaticBufferedWriter<> writer(file);
+        buffered = measure(CALL_OPS, [&](FwSizeType i) {
+            return Utilities::FileHelper::writeToFile(writer, static_cast<U64>(i)) == Os::File::Status::OP_OK;
+        });
+        buffered = (writer.flush() == Os::File::Status::OP_OK) ? buffered : -1.0;
+    }
+    report(directory, "object", "buffered_primitive", sizeof(U64), CALL_OPS, buffered);
+    file.close();
+}
+
+//! \brief measure writing and reading single buffers of each record size
+void benchmarkRecord(const char* directory, const CHAR* path, FwSizeType total) {
+    std::vector<U8> data(MAX_RECORD_SIZE, 0xA5);
+    for (FwSizeType size = MIN_RECORD_SIZE; size <= MAX_RECORD_SIZE; size *= 4) {
+        const FwSizeType ops = FW_MAX(1, FW_MIN(CALL_OPS, total / size));
+        Fw::Buffer buffer(data.data(), size);
+        Os::File file;
+        if (file.open(path, Os::File::OPEN_CREATE, Os::File::OVERWRITE) != Os::File::OP_OK) {
+            return;
+        }
+        // Records are rewritten in place such that the file, and so the storage used, stays at one record
+        const double write = measure(ops, [&](FwSizeType) {
+            return (file.seek(0, Os::File::SeekType::ABSOLUTE) == Os::File::OP_OK) &&
+                   (Utilities::FileHelper::writeToFile(file, buffer) == Os::File::Status::OP_OK);
+        });
+        file.close();
+        report(directory, "record", "write", size, ops, write);
+        if (file.open(path, Os::File::OPEN_READ) != Os::File::OP_OK) {
+            return;
+        }
+        const double read = measure(ops, [&](FwSizeType) {
+            const bool ok = (file.seek(0, Os::File::SeekType::ABSOLUTE) == Os::File::OP_OK) &&
+                            (Utilities::FileHelper::readFromFile(file, buffer) == Os::File::Status::OP_OK);
+            g_sink = g_sink + data[0];
+            return ok;
+        });
+        file.close();
+        report(directory, "record", "read", size, ops, read);
+    }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const FwSizeType total_megabytes = (argc > 1) ? static_cast<FwSizeType>(::strtoull(argv[1], nullptr, 10))
+                                                  : DEFAULT_TOTAL_MEGABYTES;
+    std::vector<const char*> directories;
+    for (int i = 2; i < argc; i++) {
+        directories.push_back(argv[i]);
+    }
+    if (directories.empty()) {
+        directories.push_back(".");
+    }
+    if (total_megabytes == 0) {
+        (void)::fprintf(stderr, "Total megabytes must be non-zero\n");
+        return 1;
+    }
+    (void)::printf("# total: %" PRI_FwSizeType " MiB\n", total_megabytes);
+    (void)::printf("# directory benchmark variant bytes_per_op ops ns_per_op megabytes_per_second\n");
+    for (const char* directory : directories) {
+        const std::string path = std::string(directory) + "/" + BENCHMARK_FILENAME;
+        benchmarkPath(directory, path.c_str());
+        benchmarkObject(directory, path.c_str());
+        benchmarkRecord(directory, path.c_str(), total_megabytes * 1024 * 1024);
+        (void)Os::FileSystem::removeFile(path.c_str());
+    }
+    return 0;
+}
@@ -6,10 +6,24 @@
 // ======================================================================
 #include <gtest/gtest.h>
 
+#include "FprimeExtras/Utilities/FileHelper/AsyncFileHelper.hpp"
+#include "FprimeExtras/Utilities/FileHelper/Crc32.hpp"
 #include "FprimeExtras/Utilities/FileHelper/FileHelper.hpp"
+#include "FprimeExtras/Utilities/FileHelper/Journal.hpp"
+#include "FprimeExtras/Utilities/FileHelper/KeyValueStore.hpp"
+#include "FprimeExtras/Utilities/FileHelper/RecordFile.hpp"
 #include "Fw/Time/Time.hpp"
 #include "Os/FileSystem.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
 //! \brief test Serializable class for testing
 struct TestSerializable : public Fw::Serializable {
     enum { SERIALIZED_SIZE = 2 };
@@ -38,6 +52,134 @@ struct TestSerializable : public Fw::Serializable {
     U64 m_uint;
 };
 
+//! \brief test Serializable class of one byte, failing to deserialize any byte other than 0
+struct ZeroByteSerializable : public Fw::Serializable {
+    enum { SERIALIZED_SIZE = 1 };
+
+    Fw::SerializeStatus serializeTo(Fw::SerialBufferBase& buffer, Fw::Endianness = Fw::Endianness::BIG) const {
+        return buffer.serializeFrom(static_cast<U8>(0));
+    }
+
+    Fw::SerializeStatus deserializeFrom(Fw::SerialBufferBase& buffer, Fw::Endianness = Fw::Endianness::BIG) {
+        U8 byte = 0;
+        Fw::SerializeStatus status = buffer.deserializeTo(byte);
+        return ((status == Fw::FW_SERIALIZE_OK) && (byte != 0)) ? Fw::FW_DESERIALIZE_FORMAT_ERROR : status;
+    }
+};
+
+//! \brief large test Serializable class, too large for the stack buffer, holding a variable-length blob
+struct LargeSerializable : public Fw::Serializable {
+    static constexpr FwSizeType VALUES = 1000;
+    static constexpr FwSizeType BLOB_CAPACITY = 5000;
+    enum { SERIALIZED_SIZE = (VALUES * sizeof(U32)) + sizeof(FwSizeStoreType) + BLOB_CAPACITY + sizeof(bool) };
+
+    Fw::SerializeStatus serializeTo(Fw::SerialBufferBase& buffer, Fw::Endianness mode = Fw::Endianness::BIG) const {
+        for (FwSizeType i = 0; i < VALUES; i++) {
+            Fw::SerializeStatus status = buffer.serializeFrom(this->m_values[i], mode);
+            if (status != Fw::FW_SERIALIZE_OK) {
+                return status;
+            }
+        }
+        Fw::SerializeStatus status =
+            buffer.serializeFrom(this->m_blob, this->m_blobSize, Fw::Serialization::INCLUDE_LENGTH, mode);
+        if (status != Fw::FW_SERIALIZE_OK) {
+            return status;
+        }
+        return buffer.serializeFrom(this->m_flag, mode);
+    }
+
+    Fw::SerializeStatus deserializeFrom(Fw::SerialBufferBase& buffer, Fw::Endianness mode = Fw::Endianness::BIG) {
+        for (FwSizeType i = 0; i < VALUES; i++) {
+            Fw::SerializeStatus status = buffer.deserializeTo(this->m_values[i], mode);
+            if (status != Fw::FW_SERIALIZE_OK) {
+                return status;
+            }
+        }
+        this->m_blobSize = BLOB_CAPACITY;
+        Fw::SerializeStatus status =
+            buffer.deserializeTo(this->m_blob, this->m_blobSize, Fw::Serialization::INCLUDE_LENGTH, mode);
+        if (status != Fw::FW_SERIALIZE_OK) {
+            return status;
+        }
+        return buffer.deserializeTo(this->m_flag, mode);
+    }
+
+    bool operator==(const LargeSerializable& other) const {
+        return (::memcmp(this->m_values, other.m_values, sizeof(this->m_values)) == 0) &&
+               (this->m_blobSize == other.m_blobSize) &&
+               (::memcmp(this->m_blob, other.m_blob, static_cast<size_t>(this->m_blobSize)) == 0) &&
+               (this->m_flag == other.m_flag);
+    }
+
+    U32 m_values[VALUES];
+    U8 m_blob[BLOB_CAPACITY];
+    FwSizeType m_blobSize = 0;
+    bool m_flag = false;
+};
+
+//! \brief journal replayer collecting every record replayed
+struct CollectingReplayer : public Utilities::FileHelper::JournalReplayer {
+    void replayRecord(Fw::Buffer& record) override {
+        this->m_records.emplace_back(record.getData(), record.getData() + record.getSize());
+    }
+
+    std::vector<std::vector<U8>> m_records;
+};
+
+//! \brief asynchronous completions recorded by context, each context completed by a single worker
+struct RecordingCallback {
+    static void complete(void* argument, const Utilities::FileHelper::AsyncFileHelper::Completion& completion) {
+        RecordingCallback* self = static_cast<RecordingCallback*>(argument);
+        ASSERT_LT(completion.m_context, sizeof(self->m_statuses) / sizeof(self->m_statuses[0]));
+        self->m_statuses[completion.m_context] = completion.m_status;
+        self->m_completed[completion.m_context] = true;
+    }
+
+    Os::File::Status m_statuses[8] = {};
+    bool m_completed[8] = {};
+};
+
+//! \brief copy progress recording each report, stopping the copy once limit bytes are copied
+struct StoppingProgress {
+    static bool report(void* argument, FwSizeType copied, FwSizeType total) {
+        StoppingProgress* self = static_cast<StoppingProgress*>(argument);
+        EXPECT_GT(copied, self->m_copied);
+        EXPECT_LE(copied, total);
+        self->m_copied = copied;
+        self->m_reports++;
+        return copied < self->m_limit;
+    }
+
+    FwSizeType m_limit = 0;
+    FwSizeType m_copied = 0;
+    FwSizeType m_reports = 0;
+};
+
+//! \brief allocator drawing from the heap, counting outstanding allocations and failing those above limit bytes
+struct CountingAllocator : public Fw::MemAllocator {
+    void* allocate(const FwEnumStoreType identifier, FwSizeType& size, bool& recoverable, FwSizeType) override {
+        EXPECT_EQ(identifier, this->m_identifier);
+        recoverable = false;
+        if (size > this->m_limit) {
+            size = this->m_limit;
+        }
+        this->m_allocations++;
+        this->m_outstanding++;
+        return ::operator new(static_cast<size_t>(size));
+    }
+
+    void deallocate(const FwEnumStoreType identifier, void* ptr) override {
+        EXPECT_EQ(identifier, this->m_identifier);
+        this->m_outstanding--;
+        ::operator delete(ptr);
+    }
+
+    FwEnumStoreType m_identifier = 7;
+    FwSizeType m_limit = std::numeric_limits<FwSizeType>::max();
+    FwSizeType m_allocations = 0;
+    FwSizeType m_outstanding = 0;
+};
+
 const CHAR* TEST_FILEPATH = "testfile.bin";
 
 // \!brief helper function to test direct readback of types
@@ -194,6 +336,926 @@ TEST(FileHelperTest, InvalidBuffers) {
     ASSERT_EQ(buffer_out.getSize(), 0);
 }
 
+TEST(FileHelperTest, VariadicTypes) {
+    const U8 out_u8 = 42;
+    const I16 out_i16 = -4242;
+    const U32 out_u32 = 0xDEADBEEF;
+    const F64 out_f64 = -42.5;
+    const bool out_bool = true;
+    TestSerializable out_object;
+    out_object.m_int = -42;
+    out_object.m_uint = 42;
+    constexpr FwSizeType expected_size =
+        Utilities::FileHelper::TotalSerializedSize<U8, I16, U32, F64, TestSerializable, bool>::value;
+    static_assert(expected_size == 18, "Combined size must be the sum of the individual sizes");
+
+    Os::File file;
+    ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_CREATE, Os::File::OVERWRITE), Os::File::OP_OK);
+    ASSERT_EQ(Utilities::FileHelper::writeToFile(file, out_u8, out_i16, out_u32, out_f64, out_object, out_bool),
+              Os::File::Status::OP_OK);
+    file.close();
+    FwSizeType read_size = 0;
+    ASSERT_EQ(Os::FileSystem::getFileSize(TEST_FILEPATH, read_size), Os::FileSystem::Status::OP_OK);
+    ASSERT_EQ(read_size, expected_size);
+
+    // Batched read back
+    U8 in_u8 = 0;
+    I16 in_i16 = 0;
+    U32 in_u32 = 0;
+    F64 in_f64 = 0.0;
+    bool in_bool = false;
+    TestSerializable in_object;
+    ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_READ), Os::File::OP_OK);
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(file, in_u8, in_i16, in_u32, in_f64, in_object, in_bool),
+              Os::File::Status::OP_OK);
+    file.close();
+    ASSERT_EQ(in_u8, out_u8);
+    ASSERT_EQ(in_i16, out_i16);
+    ASSERT_EQ(in_u32, out_u32);
+    ASSERT_EQ(in_f64, out_f64);
+    ASSERT_EQ(in_object, out_object);
+    ASSERT_EQ(in_bool, out_bool);
+
+    // The layout matches writing each object in turn
+    in_u32 = 0;
+    ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_READ), Os::File::OP_OK);
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(file, in_u8), Os::File::Status::OP_OK);
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(file, in_i16), Os::File::Status::OP_OK);
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(file, in_u32), Os::File::Status::OP_OK);
+    file.close();
+    ASSERT_EQ(in_u32, out_u32);
+
+    // Reading past the end of the file fails without updating any object
+    U64 in_u64 = 7;
+    in_u8 = 0;
+    ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_READ), Os::File::OP_OK);
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(file, in_f64, in_u64, in_u64, in_u8), Os::File::Status::BAD_SIZE);
+    file.close();
+    ASSERT_EQ(in_u64, 7);
+    ASSERT_EQ(in_u8, 0);
+
+    // A later object failing to deserialize leaves the earlier objects unchanged
+    ZeroByteSerializable in_zero;
+    ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_READ), Os::File::OP_OK);
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(file, in_u8, in_zero), Os::File::Status::OTHER_ERROR);
+    file.close();
+    ASSERT_EQ(in_u8, 0);
+}
+
+//! \brief helper function to test array writing of primitive types against writing each primitive in turn
+template <typename T>
+void testWritingArray(FwSizeType count) {
+    std::vector<T> out(count);
+    for (FwSizeType i = 0; i < count; i++) {
+        out[i] = static_cast<T>((i * 2654435761U) ^ (i << 7));
+    }
+    Os::File file;
+    ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_CREATE, Os::File::OVERWRITE), Os::File::OP_OK);
+    ASSERT_EQ(Utilities::FileHelper::writeArray(file, out.data(), count), Os::File::Status::OP_OK);
+    file.close();
+    FwSizeType read_size = 0;
+    ASSERT_EQ(Os::FileSystem::getFileSize(TEST_FILEPATH, read_size), Os::FileSystem::Status::OP_OK);
+    ASSERT_EQ(read_size, count * sizeof(T));
+
+    // Element by element readback matches
+    ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_READ), Os::File::OP_OK);
+    for (FwSizeType i = 0; i < count; i++) {
+        T readback{};
+        ASSERT_EQ(Utilities::FileHelper::readFromFile(file, readback), Os::File::Status::OP_OK);
+        ASSERT_EQ(readback, out[i]) << "Mismatch at element " << i;
+    }
+    file.close();
+
+    // Array readback matches
+    std::vector<T> in(count + 1);
+    ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_READ), Os::File::OP_OK);
+    ASSERT_EQ(Utilities::FileHelper::readArray(file, in.data(), count), Os::File::Status::OP_OK);
+    file.close();
+    for (FwSizeType i = 0; i < count; i++) {
+        ASSERT_EQ(in[i], out[i]) << "Mismatch at element " << i;
+    }
+
+    // Reading past the end of the file fails
+    ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_READ), Os::File::OP_OK);
+    ASSERT_EQ(Utilities::FileHelper::readArray(file, in.data(), count + 1), Os::File::Status::BAD_SIZE);
+    file.close();
+}
+
+TEST(FileHelperTest, ArrayTypes) {
+    // Sizes below, at, and across multiple staging buffers
+    const FwSizeType counts[] = {0, 1, 7, Utilities::FILE_HELPER_STAGING_BUFFER_SIZE / 8,
+                                 (Utilities::FILE_HELPER_STAGING_BUFFER_SIZE * 3) + 5};
+    for (const FwSizeType count : counts) {
+        testWritingArray<U8>(count);
+        testWritingArray<I16>(count);
+        testWritingArray<U32>(count);
+        testWritingArray<F32>(count);
+        testWritingArray<I64>(count);
+        testWritingArray<F64>(count);
+    }
+}
+
+TEST(FileHelperTest, SwapBigEndian) {
+    const U8 source[] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+    U8 destination[sizeof(source)];
+    // Converting twice restores the original in both directions
+    for (FwSizeType size = 1; size <= sizeof(U64); size *= 2) {
+        Utilities::FileHelper::swapBigEndian(destination, source, sizeof(source) / size, size);
+        Utilities::FileHelper::swapBigEndian(destination, destination, sizeof(source) / size, size);
+        ASSERT_EQ(::memcmp(destination, source, sizeof(source)), 0);
+    }
+    // Big-endian bytes convert to the host value
+    U32 value = 0;
+    Utilities::FileHelper::swapBigEndian(reinterpret_cast<U8*>(&value), source, 1, sizeof(U32));
+    ASSERT_EQ(value, 0x01020304U);
+}
+
+TEST(FileHelperTest, BufferedStreams) {
+    constexpr FwSizeType records = 1000;
+    constexpr FwSizeType capacity = 64;
+    U8 write_storage[capacity];
+    U8 read_storage[capacity];
+    U16 array_out[100];
+    for (FwSizeType i = 0; i < 100; i++) {
+        array_out[i] = static_cast<U16>(i * 613);
+    }
+    TestSerializable object_out;
+    object_out.m_int = -42;
+    object_out.m_uint = 42;
+
+    // Records smaller than the buffer are collected, larger ones are written through
+    Os::File file;
+    ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_CREATE, Os::File::OVERWRITE), Os::File::OP_OK);
+    {
+        Utilities::FileHelper::BufferedWriter writer(file, write_storage, capacity);
+        for (FwSizeType i = 0; i < records; i++) {
+            ASSERT_EQ(Utilities::FileHelper::writeToFile(writer, static_cast<U32>(i)), Os::File::Status::OP_OK);
+            ASSERT_EQ(Utilities::FileHelper::writeToFile(writer, object_out, static_cast<I8>(-1)),
+                      Os::File::Status::OP_OK);
+        }
+        ASSERT_GT(writer.getBufferedSize(), 0);
+        ASSERT_EQ(Utilities::FileHelper::writeArray(writer, array_out, 100), Os::File::Status::OP_OK);
+        ASSERT_EQ(writer.getBufferedSize(), 0);
+        ASSERT_EQ(Utilities::FileHelper::writeToFile(writer, static_cast<U8>(0xAB)), Os::File::Status::OP_OK);
+        // Remaining data is written on destruction
+    }
+    file.close();
+    FwSizeType file_size = 0;
+    ASSERT_EQ(Os::FileSystem::getFileSize(TEST_FILEPATH, file_size), Os::FileSystem::Status::OP_OK);
+    ASSERT_EQ(file_size, (records * 7) + sizeof(array_out) + 1);
+
+    // Read back with a read-ahead shorter than the buffer to exercise every refill path
+    for (FwSizeType read_ahead = 1; read_ahead <= capacity; read_ahead *= 4) {
+        ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_READ), Os::File::OP_OK);
+        Utilities::FileHelper::BufferedReader reader(file, read_storage, capacity);
+        reader.setReadAhead(read_ahead);
+        for (FwSizeType i = 0; i < records; i++) {
+            U32 value = 0;
+            TestSerializable object_in;
+            I8 marker = 0;
+            ASSERT_EQ(Utilities::FileHelper::readFromFile(reader, value), Os::File::Status::OP_OK);
+            ASSERT_EQ(Utilities::FileHelper::readFromFile(reader, object_in, marker), Os::File::Status::OP_OK);
+            ASSERT_EQ(value, i);
+            ASSERT_EQ(object_in, object_out);
+            ASSERT_EQ(marker, -1);
+        }
+        U16 array_in[100];
+        ASSERT_EQ(Utilities::FileHelper::readArray(reader, array_in, 100), Os::File::Status::OP_OK);
+        ASSERT_EQ(::memcmp(array_in, array_out, sizeof(array_out)), 0);
+        U8 last = 0;
+        ASSERT_EQ(Utilities::FileHelper::readFromFile(reader, last), Os::File::Status::OP_OK);
+        ASSERT_EQ(last, 0xAB);
+        ASSERT_EQ(Utilities::FileHelper::readFromFile(reader, last), Os::File::Status::BAD_SIZE);
+        file.close();
+    }
+
+    // Statically sized streams and discarding after a seek
+    ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_CREATE, Os::File::OVERWRITE), Os::File::OP_OK);
+    {
+        Utilities::FileHelper::StaticBufferedWriter<> writer(file);
+        ASSERT_EQ(Utilities::FileHelper::writeToFile(writer, static_cast<U32>(1), static_cast<U32>(2)),
+                  Os::File::Status::OP_OK);
+        ASSERT_EQ(writer.flush(), Os::File::Status::OP_OK);
+    }
+    file.close();
+    ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_READ), Os::File::OP_OK);
+    Utilities::FileHelper::StaticBufferedReader<16> reader(file);
+    U32 value = 0;
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(reader, value), Os::File::Status::OP_OK);
+    ASSERT_EQ(value, 1);
+    ASSERT_EQ(reader.getBufferedSize(), sizeof(U32));
+    ASSERT_EQ(file.seek(0, Os::File::SeekType::ABSOLUTE), Os::File::OP_OK);
+    reader.discard();
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(reader, value), Os::File::Status::OP_OK);
+    ASSERT_EQ(value, 1);
+    file.close();
+}
+
+TEST(FileHelperTest, LargeSerializableTypes) {
+    static_assert(LargeSerializable::SERIALIZED_SIZE > Utilities::FILE_HELPER_SERIAL_STAGING_SIZE,
+                  "Large serializable must be streamed");
+    std::vector<LargeSerializable> out(2);
+    for (FwSizeType i = 0; i < LargeSerializable::VALUES; i++) {
+        out[0].m_values[i] = static_cast<U32>(i * 2654435761U);
+        out[1].m_values[i] = static_cast<U32>(~i);
+    }
+    for (FwSizeType i = 0; i < LargeSerializable::BLOB_CAPACITY; i++) {
+        out[0].m_blob[i] = static_cast<U8>(i * 7);
+        out[1].m_blob[i] = static_cast<U8>(i * 13);
+    }
+    // A full blob larger than the staging buffer and a partial blob that is padded
+    out[0].m_blobSize = LargeSerializable::BLOB_CAPACITY;
+    out[0].m_flag = true;
+    out[1].m_blobSize = 100;
+
+    // The file contents match serializing each object into a buffer of its full size
+    std::vector<U8> expected(2 * LargeSerializable::SERIALIZED_SIZE, 0);
+    for (FwSizeType i = 0; i < 2; i++) {
+        Fw::ExternalSerializeBuffer serializer(expected.data() + (i * LargeSerializable::SERIALIZED_SIZE),
+                                               LargeSerializable::SERIALIZED_SIZE);
+        ASSERT_EQ(serializer.serializeFrom(out[i]), Fw::FW_SERIALIZE_OK);
+    }
+    Os::File file;
+    U8 storage[100];
+    for (FwSizeType buffered = 0; buffered < 2; buffered++) {
+        ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_CREATE, Os::File::OVERWRITE), Os::File::OP_OK);
+        if (buffered == 0) {
+            ASSERT_EQ(Utilities::FileHelper::writeToFile(file, out[0]), Os::File::Status::OP_OK);
+            ASSERT_EQ(Utilities::FileHelper::writeToFile(file, out[1]), Os::File::Status::OP_OK);
+        } else {
+            Utilities::FileHelper::BufferedWriter writer(file, storage, sizeof(storage));
+            ASSERT_EQ(Utilities::FileHelper::writeToFile(writer, out[0]), Os::File::Status::OP_OK);
+            ASSERT_EQ(Utilities::FileHelper::writeToFile(writer, out[1]), Os::File::Status::OP_OK);
+            ASSERT_EQ(writer.flush(), Os::File::Status::OP_OK);
+        }
+        file.close();
+        std::vector<U8> actual(expected.size());
+        Fw::Buffer buffer(actual.data(), actual.size());
+        ASSERT_EQ(Utilities::FileHelper::readFromFile(TEST_FILEPATH, buffer), Os::File::Status::OP_OK);
+        ASSERT_EQ(actual, expected);
+
+        // Objects read back in turn, each consuming exactly its serialized size
+        std::vector<LargeSerializable> in(2);
+        ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_READ), Os::File::OP_OK);
+        if (buffered == 0) {
+            ASSERT_EQ(Utilities::FileHelper::readFromFile(file, in[0]), Os::File::Status::OP_OK);
+            ASSERT_EQ(Utilities::FileHelper::readFromFile(file, in[1]), Os::File::Status::OP_OK);
+            ASSERT_EQ(Utilities::FileHelper::readFromFile(file, in[1]), Os::File::Status::BAD_SIZE);
+        } else {
+            Utilities::FileHelper::BufferedReader reader(file, storage, sizeof(storage));
+            ASSERT_EQ(Utilities::FileHelper::readFromFile(reader, in[0]), Os::File::Status::OP_OK);
+            ASSERT_EQ(Utilities::FileHelper::readFromFile(reader, in[1]), Os::File::Status::OP_OK);
+            ASSERT_EQ(Utilities::FileHelper::readFromFile(reader, in[1]), Os::File::Status::BAD_SIZE);
+        }
+        file.close();
+        ASSERT_EQ(in[0], out[0]);
+        ASSERT_EQ(in[1], out[1]);
+    }
+
+    // A truncated object is reported
+    ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_CREATE, Os::File::OVERWRITE), Os::File::OP_OK);
+    FwSizeType size = LargeSerializable::SERIALIZED_SIZE - 1;
+    ASSERT_EQ(file.write(expected.data(), size), Os::File::OP_OK);
+    file.close();
+    LargeSerializable truncated;
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(TEST_FILEPATH, truncated), Os::File::Status::BAD_SIZE);
+}
+
+TEST(FileHelperTest, MappedFile) {
+    Utilities::FileHelper::MappedFile mapping;
+    ASSERT_FALSE(mapping.isOpen());
+    ASSERT_FALSE(mapping.getBuffer().isValid());
+
+    // Objects written by writeToFile are read in turn from the mapping
+    TestSerializable serializable;
+    serializable.m_int = -7;
+    serializable.m_uint = 200;
+    LargeSerializable large;
+    for (FwSizeType i = 0; i < LargeSerializable::VALUES; i++) {
+        large.m_values[i] = static_cast<U32>(i * 31);
+    }
+    ::memset(large.m_blob, 0xA5, sizeof(large.m_blob));
+    large.m_blobSize = 1234;
+    large.m_flag = true;
+    Os::File file;
+    ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_CREATE, Os::File::OVERWRITE), Os::File::OP_OK);
+    ASSERT_EQ(Utilities::FileHelper::writeToFile(file, static_cast<U32>(0xDEADBEEF), serializable),
+              Os::File::Status::OP_OK);
+    ASSERT_EQ(Utilities::FileHelper::writeToFile(file, large), Os::File::Status::OP_OK);
+    file.close();
+
+    ASSERT_EQ(mapping.open(TEST_FILEPATH), Os::File::Status::OP_OK);
+    ASSERT_TRUE(mapping.isOpen());
+    const FwSizeType expected_size =
+        sizeof(U32) + TestSerializable::SERIALIZED_SIZE + LargeSerializable::SERIALIZED_SIZE;
+    ASSERT_EQ(mapping.getSize(), expected_size);
+    Fw::Buffer view = mapping.getBuffer();
+    ASSERT_TRUE(view.isValid());
+    ASSERT_EQ(view.getSize(), expected_size);
+    ASSERT_EQ(view.getData(), mapping.getData());
+    ASSERT_EQ(view.getData()[0], 0xDE);
+    Fw::Buffer part = mapping.getBuffer(1, 2);
+    ASSERT_EQ(part.getData(), mapping.getData() + 1);
+    ASSERT_EQ(part.getSize(), 2);
+    ASSERT_FALSE(mapping.getBuffer(expected_size, 0).isValid());
+
+    FwSizeType offset = 0;
+    U32 primitive = 0;
+    TestSerializable serializable_in;
+    LargeSerializable large_in;
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(mapping, offset, primitive), Os::File::Status::OP_OK);
+    ASSERT_EQ(offset, sizeof(U32));
+    ASSERT_EQ(primitive, 0xDEADBEEF);
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(mapping, offset, serializable_in), Os::File::Status::OP_OK);
+    ASSERT_EQ(serializable_in, serializable);
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(mapping, offset, large_in), Os::File::Status::OP_OK);
+    ASSERT_EQ(large_in, large);
+    ASSERT_EQ(offset, expected_size);
+
+    // Reads past the end of the mapping fail and leave the offset in place
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(mapping, offset, primitive), Os::File::Status::BAD_SIZE);
+    ASSERT_EQ(offset, expected_size);
+    offset = expected_size - 1;
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(mapping, offset, primitive), Os::File::Status::BAD_SIZE);
+    ASSERT_EQ(offset, expected_size - 1);
+    mapping.close();
+    ASSERT_FALSE(mapping.isOpen());
+    ASSERT_EQ(mapping.getSize(), 0);
+
+    // Empty files map with no data and missing files are reported
+    ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_CREATE, Os::File::OVERWRITE), Os::File::OP_OK);
+    file.close();
+    ASSERT_EQ(mapping.open(TEST_FILEPATH), Os::File::Status::OP_OK);
+    ASSERT_TRUE(mapping.isOpen());
+    ASSERT_EQ(mapping.getSize(), 0);
+    ASSERT_EQ(mapping.getData(), nullptr);
+    ASSERT_FALSE(mapping.getBuffer().isValid());
+    (void)Os::FileSystem::removeFile(TEST_FILEPATH);
+    ASSERT_EQ(mapping.open(TEST_FILEPATH), Os::File::Status::DOESNT_EXIST);
+    ASSERT_FALSE(mapping.isOpen());
+}
+
+TEST(FileHelperTest, RecordFile) {
+    using Records = Utilities::FileHelper::RecordFile<TestSerializable>;
+    constexpr FwSizeType COUNT = 1000;
+    std::vector<TestSerializable> out(COUNT);
+    for (FwSizeType i = 0; i < COUNT; i++) {
+        out[i].m_int = static_cast<I8>(i);
+        out[i].m_uint = static_cast<U8>(i * 3);
+    }
+    FwSizeType count = 0;
+    Records writer;
+    ASSERT_EQ(writer.open(TEST_FILEPATH, Os::File::OPEN_CREATE), Os::File::Status::OP_OK);
+    ASSERT_EQ(writer.getCount(count), Os::File::Status::OP_OK);
+    ASSERT_EQ(count, 0);
+    for (FwSizeType i = 0; i < COUNT; i++) {
+        ASSERT_EQ(writer.append(out[i]), Os::File::Status::OP_OK);
+    }
+    // Records are replaced in place, but never written past the end of the file
+    out[500].m_int = -1;
+    ASSERT_EQ(writer.write(500, out[500]), Os::File::Status::OP_OK);
+    ASSERT_EQ(writer.write(COUNT + 1, out[0]), Os::File::Status::BAD_SIZE);
+    ASSERT_EQ(writer.getCount(count), Os::File::Status::OP_OK);
+    ASSERT_EQ(count, COUNT);
+    writer.close();
+
+    // Reopening for writing keeps the records
+    ASSERT_EQ(writer.open(TEST_FILEPATH, Os::File::OPEN_WRITE), Os::File::Status::OP_OK);
+    ASSERT_EQ(writer.getCount(count), Os::File::Status::OP_OK);
+    ASSERT_EQ(count, COUNT);
+    writer.close();
+
+    Records reader;
+    ASSERT_EQ(reader.open(TEST_FILEPATH, Os::File::OPEN_READ), Os::File::Status::OP_OK);
+    for (FwSizeType i : {static_cast<FwSizeType>(999), static_cast<FwSizeType>(0), static_cast<FwSizeType>(500)}) {
+        TestSerializable record;
+        ASSERT_EQ(reader.read(i, record), Os::File::Status::OP_OK);
+        ASSERT_EQ(record, out[i]);
+    }
+    TestSerializable record;
+    ASSERT_EQ(reader.read(COUNT, record), Os::File::Status::BAD_SIZE);
+
+    // Ranges stop at the end of the file
+    std::vector<TestSerializable> in(COUNT);
+    count = COUNT;
+    ASSERT_EQ(reader.readRange(0, in.data(), count), Os::File::Status::OP_OK);
+    ASSERT_EQ(count, COUNT);
+    ASSERT_EQ(in, out);
+    count = 10;
+    ASSERT_EQ(reader.readRange(995, in.data(), count), Os::File::Status::OP_OK);
+    ASSERT_EQ(count, 5);
+    ASSERT_EQ(in[4], out[999]);
+    // The last record, the end of the file, and past the end of the file
+    count = 10;
+    ASSERT_EQ(reader.readRange(COUNT - 1, in.data(), count), Os::File::Status::OP_OK);
+    ASSERT_EQ(count, 1);
+    ASSERT_EQ(in[0], out[COUNT - 1]);
+    count = 10;
+    ASSERT_EQ(reader.readRange(COUNT, in.data(), count), Os::File::Status::OP_OK);
+    ASSERT_EQ(count, 0);
+    count = 10;
+    ASSERT_EQ(reader.readRange(COUNT + 1, in.data(), count), Os::File::Status::BAD_SIZE);
+    ASSERT_EQ(count, 0);
+    reader.close();
+
+    // A partial record is not counted and is replaced by the next append
+    Os::File file;
+    ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_APPEND), Os::File::OP_OK);
+    ASSERT_EQ(Utilities::FileHelper::writeToFile(file, static_cast<U8>(0xFF)), Os::File::Status::OP_OK);
+    file.close();
+    ASSERT_EQ(writer.open(TEST_FILEPATH, Os::File::OPEN_WRITE), Os::File::Status::OP_OK);
+    ASSERT_EQ(writer.getCount(count), Os::File::Status::OP_OK);
+    ASSERT_EQ(count, COUNT);
+    ASSERT_EQ(writer.append(out[1]), Os::File::Status::OP_OK);
+    ASSERT_EQ(writer.getCount(count), Os::File::Status::OP_OK);
+    ASSERT_EQ(count, COUNT + 1);
+    writer.close();
+    ASSERT_EQ(reader.open(TEST_FILEPATH, Os::File::OPEN_READ), Os::File::Status::OP_OK);
+    ASSERT_EQ(reader.read(COUNT, record), Os::File::Status::OP_OK);
+    ASSERT_EQ(record, out[1]);
+    reader.close();
+
+    // Files of other record sizes and other formats are rejected
+    Utilities::FileHelper::RecordFile<U32> other;
+    ASSERT_EQ(other.open(TEST_FILEPATH, Os::File::OPEN_READ), Os::File::Status::BAD_SIZE);
+    ASSERT_FALSE(other.isOpen());
+    ASSERT_EQ(other.open(TEST_FILEPATH, Os::File::OPEN_WRITE), Os::File::Status::BAD_SIZE);
+    ASSERT_FALSE(other.isOpen());
+    ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_CREATE, Os::File::OVERWRITE), Os::File::OP_OK);
+    ASSERT_EQ(Utilities::FileHelper::writeToFile(file, static_cast<U64>(0), static_cast<U64>(2)),
+              Os::File::Status::OP_OK);
+    file.close();
+    ASSERT_EQ(reader.open(TEST_FILEPATH, Os::File::OPEN_READ), Os::File::Status::OTHER_ERROR);
+    ASSERT_FALSE(reader.isOpen());
+}
+
+TEST(FileHelperTest, Journal) {
+    (void)Os::FileSystem::removeFile(TEST_FILEPATH);
+    std::vector<std::vector<U8>> expected;
+    for (FwSizeType i = 0; i < 20; i++) {
+        expected.emplace_back(static_cast<size_t>((i * 37) % 200), static_cast<U8>(i));
+    }
+    Utilities::FileHelper::StaticJournal<256> journal;
+    ASSERT_EQ(journal.getMaxRecordSize(), 256 - Utilities::FileHelper::Journal::RECORD_HEADER_SIZE);
+    CollectingReplayer replayer;
+    ASSERT_EQ(journal.open(TEST_FILEPATH, replayer), Os::File::Status::OP_OK);
+    ASSERT_EQ(journal.getRecordCount(), 0);
+    ASSERT_EQ(journal.getSize(), Utilities::FileHelper::Journal::HEADER_SIZE);
+
+    // Records are committed in groups, filling the buffer writes records without committing them
+    journal.setGroupCommit(3, 0);
+    for (FwSizeType i = 0; i < expected.size(); i++) {
+        ASSERT_EQ(journal.append(expected[i].data(), expected[i].size()), Os::File::Status::OP_OK);
+        ASSERT_EQ(journal.getPendingCount(), (i + 1) % 3);
+    }
+    TestSerializable serializable;
+    serializable.m_int = -3;
+    serializable.m_uint = 9;
+    ASSERT_EQ(journal.append(serializable), Os::File::Status::OP_OK);
+    expected.push_back({0xFD, 0x09});
+    ASSERT_EQ(journal.getPendingCount(), 0);
+    std::vector<U8> too_large(journal.getMaxRecordSize() + 1, 0);
+    ASSERT_EQ(journal.append(too_large.data(), too_large.size()), Os::File::Status::BAD_SIZE);
+
+    // Without a count or window records wait for an explicit commit
+    journal.setGroupCommit(0, 0);
+    ASSERT_EQ(journal.append(expected[0].data(), expected[0].size()), Os::File::Status::OP_OK);
+    expected.push_back(expected[0]);
+    ASSERT_EQ(journal.commitIfDue(), Os::File::Status::OP_OK);
+    ASSERT_EQ(journal.getPendingCount(), 1);
+    ASSERT_EQ(journal.commit(), Os::File::Status::OP_OK);
+    ASSERT_EQ(journal.getPendingCount(), 0);
+    const FwSizeType size = journal.getSize();
+    ASSERT_EQ(journal.close(), Os::File::Status::OP_OK);
+    FwSizeType file_size = 0;
+    ASSERT_EQ(Os::FileSystem::getFileSize(TEST_FILEPATH, file_size), Os::FileSystem::OP_OK);
+    ASSERT_EQ(file_size, size);
+
+    // Records replay in order
+    ASSERT_EQ(journal.open(TEST_FILEPATH, replayer), Os::File::Status::OP_OK);
+    ASSERT_EQ(replayer.m_records, expected);
+    ASSERT_EQ(journal.getRecordCount(), expected.size());
+    ASSERT_EQ(journal.getTruncatedSize(), 0);
+    ASSERT_EQ(journal.close(), Os::File::Status::OP_OK);
+
+    // A partial record and a record failing its CRC are truncated, and later records follow the intact records
+    const U8 damaged[][12] = {{0x00, 0x00, 0x00, 0x08, 0x12, 0x34, 0x56, 0x78, 0x01, 0x02, 0x03, 0x04},
+                              {0x00, 0x00, 0x00, 0x04, 0x12, 0x34, 0x56, 0x78, 0x01, 0x02, 0x03, 0x04},
+                              {0x7F, 0xFF, 0xFF, 0xFF, 0x12, 0x34, 0x56, 0x78, 0x01, 0x02, 0x03, 0x04}};
+    for (const U8* tail : damaged) {
+        Os::File file;
+        ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_APPEND), Os::File::OP_OK);
+        FwSizeType tail_size = sizeof(damaged[0]);
+        ASSERT_EQ(file.write(tail, tail_size), Os::File::OP_OK);
+        file.close();
+        replayer.m_records.clear();
+        ASSERT_EQ(journal.open(TEST_FILEPATH, replayer), Os::File::Status::OP_OK);
+        ASSERT_EQ(replayer.m_records, expected);
+        ASSERT_EQ(journal.getTruncatedSize(), sizeof(damaged[0]));
+        ASSERT_EQ(journal.getSize(), size);
+        ASSERT_EQ(Os::FileSystem::getFileSize(TEST_FILEPATH, file_size), Os::FileSystem::OP_OK);
+        ASSERT_EQ(file_size, size);
+        ASSERT_EQ(journal.close(), Os::File::Status::OP_OK);
+    }
+    ASSERT_EQ(journal.open(TEST_FILEPATH, replayer), Os::File::Status::OP_OK);
+    ASSERT_EQ(journal.append(expected[1].data(), expected[1].size()), Os::File::Status::OP_OK);
+    expected.push_back(expected[1]);
+    ASSERT_EQ(journal.close(), Os::File::Status::OP_OK);
+    replayer.m_records.clear();
+    ASSERT_EQ(journal.open(TEST_FILEPATH, replayer), Os::File::Status::OP_OK);
+    ASSERT_EQ(replayer.m_records, expected);
+    ASSERT_EQ(journal.close(), Os::File::Status::OP_OK);
+
+    // Files that are not journals are left untouched
+    ASSERT_EQ(Utilities::FileHelper::writeToFile(TEST_FILEPATH, static_cast<U64>(0x0123456789ABCDEF)),
+              Os::File::Status::OP_OK);
+    ASSERT_EQ(journal.open(TEST_FILEPATH, replayer), Os::File::Status::OTHER_ERROR);
+    ASSERT_FALSE(journal.isOpen());
+    U64 contents = 0;
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(TEST_FILEPATH, contents), Os::File::Status::OP_OK);
+    ASSERT_EQ(contents, 0x0123456789ABCDEF);
+}
+
+TEST(FileHelperTest, KeyValueStore) {
+    (void)Os::FileSystem::removeFile(TEST_FILEPATH);
+    std::unique_ptr<Utilities::FileHelper::KeyValueStore> store(new Utilities::FileHelper::KeyValueStore());
+    ASSERT_EQ(store->open(TEST_FILEPATH), Os::File::Status::OP_OK);
+    ASSERT_EQ(store->getCount(), 0);
+
+    // Integer and string keys hold primitives and serializables
+    TestSerializable serializable;
+    serializable.m_int = -5;
+    serializable.m_uint = 77;
+    U32 primitive = 0;
+    ASSERT_EQ(store->get(static_cast<U32>(1), primitive), Os::File::Status::DOESNT_EXIST);
+    ASSERT_EQ(store->set(static_cast<U32>(1), static_cast<U32>(0xCAFEF00D)), Os::File::Status::OP_OK);
+    ASSERT_EQ(store->set("1", serializable), Os::File::Status::OP_OK);
+    ASSERT_EQ(store->set("mode", static_cast<U8>(3)), Os::File::Status::OP_OK);
+    ASSERT_EQ(store->getCount(), 3);
+    ASSERT_EQ(store->get(static_cast<U32>(1), primitive), Os::File::Status::OP_OK);
+    ASSERT_EQ(primitive, 0xCAFEF00D);
+    TestSerializable serializable_in;
+    ASSERT_EQ(store->get("1", serializable_in), Os::File::Status::OP_OK);
+    ASSERT_EQ(serializable_in, serializable);
+    ASSERT_EQ(store->get("mode", primitive), Os::File::Status::BAD_SIZE);
+    ASSERT_TRUE(store->contains("mode"));
+    ASSERT_FALSE(store->contains(static_cast<U32>(2)));
+
+    // Each change is one record, unchanged values are not written
+    const FwSizeType log_size = store->getLogSize();
+    ASSERT_EQ(store->set("mode", static_cast<U8>(3)), Os::File::Status::OP_OK);
+    ASSERT_EQ(store->getLogSize(), log_size);
+    ASSERT_EQ(store->set("mode", static_cast<U8>(4)), Os::File::Status::OP_OK);
+    ASSERT_EQ(store->getLogSize(), log_size + Utilities::FileHelper::Journal::RECORD_HEADER_SIZE +
+                                       Utilities::FileHelper::KeyValueStore::RECORD_PREFIX_SIZE + 4 + 1);
+    ASSERT_EQ(store->remove("1"), Os::File::Status::OP_OK);
+    ASSERT_EQ(store->remove("1"), Os::File::Status::DOESNT_EXIST);
+    ASSERT_FALSE(store->contains("1"));
+
+    // Fill the table, churning values, such that removal must preserve every probe sequence
+    std::vector<U32> expected(Utilities::FILE_HELPER_KV_MAX_ENTRIES, 0);
+    for (U32 round = 0; round < 4; round++) {
+        for (U32 key = 100; key < (100 + Utilities::FILE_HELPER_KV_MAX_ENTRIES - 2); key++) {
+            const U32 value = (key * 7919) + round;
+            ASSERT_EQ(store->set(key, value), Os::File::Status::OP_OK);
+            expected[key - 100] = value;
+        }
+        for (U32 key = 100 + round; key < (100 + Utilities::FILE_HELPER_KV_MAX_ENTRIES - 2); key += 3) {
+            ASSERT_EQ(store->remove(key), Os::File::Status::OP_OK);
+            expected[key - 100] = 0;
+        }
+    }
+    const U32 full_key = 100 + Utilities::FILE_HELPER_KV_MAX_ENTRIES;
+    for (U32 key = full_key; store->getCount() < Utilities::FILE_HELPER_KV_MAX_ENTRIES; key++) {
+        ASSERT_EQ(store->set(key, key), Os::File::Status::OP_OK);
+    }
+    ASSERT_EQ(store->set(static_cast<U32>(0xFFFFFFFF), static_cast<U32>(0)), Os::File::Status::NO_SPACE);
+    const FwSizeType count = store->getCount();
+    auto check = [&](Utilities::FileHelper::KeyValueStore& kv) {
+        ASSERT_EQ(kv.getCount(), count);
+        U8 mode = 0;
+        ASSERT_EQ(kv.get("mode", mode), Os::File::Status::OP_OK);
+        ASSERT_EQ(mode, 4);
+        ASSERT_FALSE(kv.contains("1"));
+        for (U32 key = 100; key < (100 + Utilities::FILE_HELPER_KV_MAX_ENTRIES - 2); key++) {
+            U32 value = 0;
+            if (expected[key - 100] == 0) {
+                ASSERT_EQ(kv.get(key, value), Os::File::Status::DOESNT_EXIST);
+            } else {
+                ASSERT_EQ(kv.get(key, value), Os::File::Status::OP_OK);
+                ASSERT_EQ(value, expected[key - 100]);
+            }
+        }
+    };
+    check(*store);
+
+    // Entries are rebuilt from the journal, and survive compaction
+    ASSERT_EQ(store->close(), Os::File::Status::OP_OK);
+    ASSERT_EQ(store->getCount(), 0);
+    ASSERT_EQ(store->open(TEST_FILEPATH), Os::File::Status::OP_OK);
+    check(*store);
+    const FwSizeType before = store->getLogSize();
+    ASSERT_EQ(store->compact(), Os::File::Status::OP_OK);
+    ASSERT_LT(store->getLogSize(), before);
+    ASSERT_EQ(store->compactIfDue(), Os::File::Status::OP_OK);
+    check(*store);
+    ASSERT_EQ(store->set("mode", static_cast<U8>(4)), Os::File::Status::OP_OK);
+    ASSERT_EQ(store->close(), Os::File::Status::OP_OK);
+    ASSERT_EQ(store->open(TEST_FILEPATH), Os::File::Status::OP_OK);
+    check(*store);
+
+    // Writes made while compacting are not blocked by the compaction and survive it
+    constexpr U32 WRITES = 2000;
+    std::atomic<bool> writing(true);
+    std::thread writer([&]() {
+        for (U32 value = 1; value <= WRITES; value++) {
+            EXPECT_EQ(store->set(full_key, value), Os::File::Status::OP_OK);
+        }
+        writing = false;
+    });
+    U32 compactions = 0;
+    while (writing || (compactions == 0)) {
+        ASSERT_EQ(store->compact(), Os::File::Status::OP_OK);
+        compactions++;
+    }
+    writer.join();
+    ASSERT_EQ(store->close(), Os::File::Status::OP_OK);
+    ASSERT_EQ(store->open(TEST_FILEPATH), Os::File::Status::OP_OK);
+    check(*store);
+    U32 written = 0;
+    ASSERT_EQ(store->get(full_key, written), Os::File::Status::OP_OK);
+    ASSERT_EQ(written, WRITES);
+    ASSERT_EQ(store->close(), Os::File::Status::OP_OK);
+
+    // A store left closed, as by a write error closing its journal, refuses changes rather than asserting
+    ASSERT_EQ(store->set("mode", static_cast<U8>(5)), Os::File::Status::NOT_OPENED);
+    ASSERT_EQ(store->remove("mode"), Os::File::Status::NOT_OPENED);
+    ASSERT_EQ(store->commit(), Os::File::Status::NOT_OPENED);
+    ASSERT_EQ(store->commitIfDue(), Os::File::Status::NOT_OPENED);
+    ASSERT_EQ(store->compact(), Os::File::Status::NOT_OPENED);
+    ASSERT_EQ(store->compactIfDue(), Os::File::Status::NOT_OPENED);
+}
+
+TEST(FileHelperTest, AsyncFileHelper) {
+    using Utilities::FileHelper::AsyncFileHelper;
+    (void)Os::FileSystem::removeFile(TEST_FILEPATH);
+    std::unique_ptr<AsyncFileHelper> helper(new AsyncFileHelper());
+    U8 data[64];
+    for (FwSizeType i = 0; i < sizeof(data); i++) {
+        data[i] = static_cast<U8>(i * 3);
+    }
+    Fw::Buffer buffer(data, sizeof(data));
+    ASSERT_FALSE(helper->writeToFile(TEST_FILEPATH, buffer));
+    ASSERT_FALSE(helper->isRunning());
+
+    // A single worker performs requests in order, completions wait for poll
+    ASSERT_EQ(helper->start(1), 1);
+    U8 read_data[2 * sizeof(data)] = {};
+    Fw::Buffer read_buffer(read_data, sizeof(read_data));
+    U8 long_data[sizeof(read_data) + 1];
+    Fw::Buffer long_buffer(long_data, sizeof(long_data));
+    ASSERT_TRUE(helper->writeToFile(TEST_FILEPATH, buffer, 1));
+    ASSERT_TRUE(helper->appendToFile(TEST_FILEPATH, buffer, 2));
+    ASSERT_TRUE(helper->readFromFile(TEST_FILEPATH, read_buffer, 3));
+    ASSERT_TRUE(helper->readFromFile(TEST_FILEPATH, long_buffer, 4));
+    helper->stop();
+    ASSERT_FALSE(helper->isRunning());
+    ASSERT_EQ(helper->getOutstandingCount(), 4);
+    const AsyncFileHelper::Operation operations[] = {AsyncFileHelper::WRITE, AsyncFileHelper::APPEND,
+                                                     AsyncFileHelper::READ, AsyncFileHelper::READ};
+    const Os::File::Status statuses[] = {Os::File::Status::OP_OK, Os::File::Status::OP_OK, Os::File::Status::OP_OK,
+                                         Os::File::Status::BAD_SIZE};
+    AsyncFileHelper::Completion completion;
+    for (U32 i = 0; i < 4; i++) {
+        ASSERT_TRUE(helper->poll(completion));
+        ASSERT_EQ(completion.m_context, i + 1);
+        ASSERT_EQ(completion.m_operation, operations[i]);
+        ASSERT_EQ(completion.m_status, statuses[i]);
+    }
+    ASSERT_FALSE(helper->poll(completion));
+    ASSERT_EQ(::memcmp(read_data, data, sizeof(data)), 0);
+    ASSERT_EQ(::memcmp(read_data + sizeof(data), data, sizeof(data)), 0);
+
+    // Submitting never waits, requests beyond the queue are refused until completions are collected
+    ASSERT_EQ(helper->start(1), 1);
+    for (FwSizeType i = 0; i < Utilities::FILE_HELPER_ASYNC_QUEUE_DEPTH; i++) {
+        ASSERT_TRUE(helper->writeToFile(TEST_FILEPATH, buffer));
+    }
+    ASSERT_FALSE(helper->writeToFile(TEST_FILEPATH, buffer));
+    helper->stop();
+    ASSERT_EQ(helper->getOutstandingCount(), Utilities::FILE_HELPER_ASYNC_QUEUE_DEPTH);
+    while (helper->poll(completion)) {
+        ASSERT_EQ(completion.m_status, Os::File::Status::OP_OK);
+    }
+    ASSERT_EQ(helper->getOutstandingCount(), 0);
+
+    // Objects are serialized as queued, and workers deliver completions to the callback
+    TestSerializable serializable;
+    serializable.m_int = -7;
+    serializable.m_uint = 42;
+    U8 storage_data[TestSerializable::SERIALIZED_SIZE];
+    Fw::Buffer storage(storage_data, sizeof(storage_data));
+    RecordingCallback callback;
+    helper->setCallback(RecordingCallback::complete, &callback);
+    ASSERT_EQ(helper->start(Utilities::FILE_HELPER_ASYNC_MAX_THREADS), Utilities::FILE_HELPER_ASYNC_MAX_THREADS);
+    ASSERT_TRUE(helper->writeToFile(TEST_FILEPATH, serializable, storage, 0));
+    serializable.m_int = 0;
+    helper->stop();
+    TestSerializable serializable_in;
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(TEST_FILEPATH, serializable_in), Os::File::Status::OP_OK);
+    ASSERT_EQ(serializable_in.m_int, -7);
+    ASSERT_EQ(serializable_in.m_uint, 42);
+    U8 reads[8][TestSerializable::SERIALIZED_SIZE] = {};  // Context 0 is the write
+    ASSERT_EQ(helper->start(Utilities::FILE_HELPER_ASYNC_MAX_THREADS), Utilities::FILE_HELPER_ASYNC_MAX_THREADS);
+    for (U32 i = 1; i < 8; i++) {
+        Fw::Buffer read(reads[i], sizeof(reads[i]));
+        ASSERT_TRUE(helper->readFromFile(TEST_FILEPATH, read, i));
+    }
+    helper->stop();
+    ASSERT_EQ(helper->getOutstandingCount(), 0);
+    ASSERT_FALSE(helper->poll(completion));
+    for (U32 i = 0; i < 8; i++) {
+        ASSERT_TRUE(callback.m_completed[i]);
+        ASSERT_EQ(callback.m_statuses[i], Os::File::Status::OP_OK);
+    }
+    for (U32 i = 1; i < 8; i++) {
+        ASSERT_EQ(::memcmp(reads[i], storage_data, sizeof(storage_data)), 0);
+    }
+}
+
+TEST(FileHelperTest, CopyFile) {
+    const CHAR* copy_path = "testfile.copy.bin";
+    (void)Os::FileSystem::removeFile(copy_path);
+    std::vector<U8> data(Utilities::FILE_HELPER_COPY_CHUNK_SIZE + (5 * Utilities::FILE_HELPER_CRC_CHUNK_SIZE) + 3);
+    for (FwSizeType i = 0; i < data.size(); i++) {
+        data[i] = static_cast<U8>((i * 13) ^ (i >> 9));
+    }
+    Fw::Buffer buffer(data.data(), data.size());
+    ASSERT_EQ(Utilities::FileHelper::writeToFile(TEST_FILEPATH, buffer), Os::File::Status::OP_OK);
+    std::vector<U8> copy(data.size());
+    Fw::Buffer copy_buffer(copy.data(), copy.size());
+
+    // Whole copies, in the kernel without a CRC, and through the stack, a supplied, or an allocated buffer with one
+    U8 user_buffer[1000];
+    CountingAllocator allocator;
+    for (FwSizeType variant = 0; variant < 4; variant++) {
+        Utilities::FileHelper::CopyOptions options;
+        U32 crc = 0;
+        options.m_crc = (variant > 0) ? &crc : nullptr;
+        options.m_buffer = (variant == 2) ? user_buffer : nullptr;
+        options.m_bufferSize = (variant == 2) ? sizeof(user_buffer) : 0;
+        options.m_allocator = (variant == 3) ? &allocator : nullptr;
+        options.m_allocatorId = allocator.m_identifier;
+        FwSizeType copied = 0;
+        ASSERT_EQ(Utilities::FileHelper::copyFile(TEST_FILEPATH, copy_path, options, copied), Os::File::Status::OP_OK);
+        ASSERT_EQ(copied, data.size());
+        ASSERT_EQ(crc, (variant > 0) ? Utilities::FileHelper::crc32(data.data(), data.size()) : 0);
+        std::fill(copy.begin(), copy.end(), 0);
+        ASSERT_EQ(Utilities::FileHelper::readFromFile(copy_path, copy_buffer), Os::File::Status::OP_OK);
+        ASSERT_EQ(copy, data);
+    }
+    ASSERT_EQ(allocator.m_allocations, 1);
+    ASSERT_EQ(allocator.m_outstanding, 0);
+    Utilities::FileHelper::CopyOptions allocated;
+    U32 crc = 0;
+    allocated.m_crc = &crc;
+    allocated.m_allocator = &allocator;
+    allocated.m_allocatorId = allocator.m_identifier;
+    allocator.m_limit = 10;
+    ASSERT_EQ(Utilities::FileHelper::copyFile(TEST_FILEPATH, copy_path, allocated), Os::File::Status::NO_SPACE);
+    ASSERT_EQ(allocator.m_outstanding, 0);
+
+    // Copies stopped by progress resume at the offsets copied, accumulating the CRC, for either path
+    for (FwSizeType variant = 0; variant < 2; variant++) {
+        (void)Os::FileSystem::removeFile(copy_path);
+        Utilities::FileHelper::CopyOptions options;
+        U32 crc = 0;
+        options.m_crc = (variant == 1) ? &crc : nullptr;
+        StoppingProgress progress;
+        options.m_progress = StoppingProgress::report;
+        options.m_progressArgument = &progress;
+        FwSizeType done = 0;
+        FwSizeType calls = 0;
+        while (done < data.size()) {
+            progress.m_copied = 0;
+            progress.m_limit = data.size() / 4;
+            options.m_sourceOffset = done;
+            options.m_destinationOffset = done;
+            options.m_truncate = (done == 0);
+            FwSizeType copied = 0;
+            ASSERT_EQ(Utilities::FileHelper::copyFile(TEST_FILEPATH, copy_path, options, copied),
+                      Os::File::Status::OP_OK);
+            ASSERT_EQ(copied, progress.m_copied);
+            done += copied;
+            calls++;
+        }
+        ASSERT_GT(calls, 1);
+        ASSERT_EQ(crc, (variant == 1) ? Utilities::FileHelper::crc32(data.data(), data.size()) : 0);
+        ASSERT_EQ(Utilities::FileHelper::readFromFile(copy_path, copy_buffer), Os::File::Status::OP_OK);
+        ASSERT_EQ(copy, data);
+    }
+
+    // Ranges copy into place, keeping the rest of the destination unless truncating
+    for (FwSizeType variant = 0; variant < 2; variant++) {
+        ASSERT_EQ(Utilities::FileHelper::copyFile(TEST_FILEPATH, copy_path), Os::File::Status::OP_OK);
+        Utilities::FileHelper::CopyOptions options;
+        U32 crc = 0;
+        options.m_crc = (variant == 1) ? &crc : nullptr;
+        options.m_sourceOffset = 10;
+        options.m_destinationOffset = 20;
+        options.m_length = 100;
+        options.m_truncate = false;
+        ASSERT_EQ(Utilities::FileHelper::copyFile(TEST_FILEPATH, copy_path, options), Os::File::Status::OP_OK);
+        ASSERT_EQ(Utilities::FileHelper::readFromFile(copy_path, copy_buffer), Os::File::Status::OP_OK);
+        ASSERT_EQ(::memcmp(copy.data(), data.data(), 20), 0);
+        ASSERT_EQ(::memcmp(copy.data() + 20, data.data() + 10, 100), 0);
+        ASSERT_EQ(::memcmp(copy.data() + 120, data.data() + 120, data.size() - 120), 0);
+        options.m_truncate = true;
+        options.m_destinationOffset = 0;
+        ASSERT_EQ(Utilities::FileHelper::copyFile(TEST_FILEPATH, copy_path, options), Os::File::Status::OP_OK);
+        FwSizeType size = 0;
+        ASSERT_EQ(Os::FileSystem::getFileSize(copy_path, size), Os::FileSystem::OP_OK);
+        ASSERT_EQ(size, 100);
+
+        // Ranges past the end of the source leave the destination untouched
+        options.m_sourceOffset = data.size() - 50;
+        ASSERT_EQ(Utilities::FileHelper::copyFile(TEST_FILEPATH, copy_path, options), Os::File::Status::BAD_SIZE);
+        options.m_sourceOffset = data.size() + 1;
+        options.m_length = Utilities::FileHelper::COPY_TO_END;
+        ASSERT_EQ(Utilities::FileHelper::copyFile(TEST_FILEPATH, copy_path, options), Os::File::Status::BAD_SIZE);
+        ASSERT_EQ(Os::FileSystem::getFileSize(copy_path, size), Os::FileSystem::OP_OK);
+        ASSERT_EQ(size, 100);
+        ASSERT_EQ(Utilities::FileHelper::copyFile("missing.bin", copy_path, options), Os::File::Status::DOESNT_EXIST);
+    }
+
+#if defined(__linux__)
+    // Copies of a file onto itself, by any path, are rejected leaving it intact
+    for (const CHAR* path : {TEST_FILEPATH, "./testfile.bin"}) {
+        for (FwSizeType variant = 0; variant < 2; variant++) {
+            Utilities::FileHelper::CopyOptions options;
+            U32 crc = 0;
+            options.m_crc = (variant == 1) ? &crc : nullptr;
+            ASSERT_EQ(Utilities::FileHelper::copyFile(TEST_FILEPATH, path, options),
+                      Os::File::Status::INVALID_ARGUMENT);
+            std::fill(copy.begin(), copy.end(), 0);
+            ASSERT_EQ(Utilities::FileHelper::readFromFile(TEST_FILEPATH, copy_buffer), Os::File::Status::OP_OK);
+            ASSERT_EQ(copy, data);
+        }
+    }
+#endif
+    (void)Os::FileSystem::removeFile(copy_path);
+}
+
+TEST(FileHelperTest, AllocatedBuffer) {
+    std::vector<U8> data((2 * Utilities::FILE_HELPER_LOAD_CHUNK_SIZE) + 17);
+    for (FwSizeType i = 0; i < data.size(); i++) {
+        data[i] = static_cast<U8>((i * 29) ^ (i >> 11));
+    }
+    Fw::Buffer buffer(data.data(), data.size());
+    ASSERT_EQ(Utilities::FileHelper::writeToFile(TEST_FILEPATH, buffer), Os::File::Status::OP_OK);
+    CountingAllocator allocator;
+
+    // Whole files load with a single allocation of exactly their size
+    {
+        Utilities::FileHelper::AllocatedBuffer loaded;
+        ASSERT_EQ(Utilities::FileHelper::readFromFile(TEST_FILEPATH, allocator, allocator.m_identifier, loaded),
+                  Os::File::Status::OP_OK);
+        ASSERT_EQ(allocator.m_allocations, 1);
+        ASSERT_EQ(loaded.getSize(), data.size());
+        ASSERT_TRUE(loaded.getBuffer().isValid());
+        ASSERT_EQ(::memcmp(loaded.getData(), data.data(), data.size()), 0);
+
+        // Moving transfers ownership, loading again releases the previous contents first
+        Utilities::FileHelper::AllocatedBuffer moved(std::move(loaded));
+        ASSERT_EQ(loaded.getData(), nullptr);
+        ASSERT_EQ(moved.getSize(), data.size());
+        ASSERT_EQ(Utilities::FileHelper::readFromFile(TEST_FILEPATH, allocator, allocator.m_identifier, moved),
+                  Os::File::Status::OP_OK);
+        ASSERT_EQ(allocator.m_outstanding, 1);
+        loaded = std::move(moved);
+        ASSERT_EQ(allocator.m_outstanding, 1);
+        ASSERT_EQ(::memcmp(loaded.getData(), data.data(), data.size()), 0);
+    }
+    ASSERT_EQ(allocator.m_outstanding, 0);
+
+    // Short allocations and missing files fail owning nothing, empty files load without allocating
+    Utilities::FileHelper::AllocatedBuffer loaded;
+    allocator.m_limit = data.size() - 1;
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(TEST_FILEPATH, allocator, allocator.m_identifier, loaded),
+              Os::File::Status::NO_SPACE);
+    ASSERT_EQ(loaded.getData(), nullptr);
+    ASSERT_EQ(allocator.m_outstanding, 0);
+    ASSERT_EQ(Utilities::FileHelper::readFromFile("missing.bin", allocator, allocator.m_identifier, loaded),
+              Os::File::Status::DOESNT_EXIST);
+    const FwSizeType allocations = allocator.m_allocations;
+    ASSERT_EQ(Utilities::FileHelper::writeToFile(TEST_FILEPATH, Fw::Buffer()), Os::File::Status::OP_OK);
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(TEST_FILEPATH, allocator, allocator.m_identifier, loaded),
+              Os::File::Status::OP_OK);
+    ASSERT_EQ(loaded.getSize(), 0);
+    ASSERT_FALSE(loaded.getBuffer().isValid());
+    ASSERT_EQ(allocator.m_allocations, allocations);
+}
+
 TEST(FileHelperTest, BadSizeTest) {
     U8 store[100];
     TestSerializable test_object;
@@ -226,6 +1288,105 @@ TEST(FileHelperTest, DeathNoFile) {
     ASSERT_DEATH(Utilities::FileHelper::writeToFile<Fw::TimeValue>(file, test_time), ".*FileHelper");
 }
 
+//! \brief bit-at-a-time CRC32 used as the reference for the table-driven implementation
+U32 referenceCrc32(const U8* data, FwSizeType size) {
+    U32 crc = 0xFFFFFFFF;
+    for (FwSizeType i = 0; i < size; i++) {
+        crc ^= data[i];
+        for (U32 bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320 : 0);
+        }
+    }
+    return ~crc;
+}
+
+TEST(FileHelperTest, Crc32) {
+    // Standard check value
+    const U8 check[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    ASSERT_EQ(Utilities::FileHelper::crc32(check, sizeof(check)), 0xCBF43926);
+    ASSERT_EQ(Utilities::FileHelper::crc32(nullptr, 0), 0);
+
+    U8 data[300];
+    for (FwSizeType i = 0; i < sizeof(data); i++) {
+        data[i] = static_cast<U8>((i * 151) ^ (i >> 3));
+    }
+    // Every size at every alignment must match the reference, and any split must chain to the same value
+    for (FwSizeType offset = 0; offset < 8; offset++) {
+        for (FwSizeType size = 0; size < (sizeof(data) - offset); size++) {
+            const U32 expected = referenceCrc32(data + offset, size);
+            ASSERT_EQ(Utilities::FileHelper::crc32(data + offset, size), expected) << offset << ":" << size;
+            const FwSizeType split = size / 3;
+            const U32 first = Utilities::FileHelper::crc32(data + offset, split);
+            ASSERT_EQ(Utilities::FileHelper::crc32(data + offset + split, size - split, first), expected);
+            // Every supported kernel must compute the same CRC
+            for (FwSizeType i = 0; i < Utilities::FileHelper::NUM_CRC32_KERNELS; i++) {
+                const Utilities::FileHelper::Crc32Kernel kernel = static_cast<Utilities::FileHelper::Crc32Kernel>(i);
+                if (Utilities::FileHelper::isSupported(kernel)) {
+                    ASSERT_EQ(Utilities::FileHelper::crc32(kernel, data + offset, size), expected) << i;
+                    ASSERT_EQ(Utilities::FileHelper::crc32(kernel, data + offset + split, size - split, first),
+                              expected);
+                }
+            }
+        }
+    }
+    ASSERT_TRUE(Utilities::FileHelper::isSupported(Utilities::FileHelper::getCrc32Kernel()));
+}
+
+TEST(FileHelperTest, Crc32Transfers) {
+    std::vector<U8> data(3 * Utilities::FILE_HELPER_CRC_CHUNK_SIZE + 17);
+    for (FwSizeType i = 0; i < data.size(); i++) {
+        data[i] = static_cast<U8>((i * 31) ^ (i >> 7));
+    }
+    const U32 expected = referenceCrc32(data.data(), data.size());
+
+    // Writes and reads fold the data into the CRC, directly and through buffered streams
+    Os::File file;
+    ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_CREATE, Os::File::OVERWRITE), Os::File::OP_OK);
+    U32 crc = 0;
+    Fw::Buffer head(data.data(), 100);
+    Fw::Buffer rest(data.data() + 100, data.size() - 100);
+    ASSERT_EQ(Utilities::FileHelper::writeToFileCrc32(file, head, crc), Os::File::Status::OP_OK);
+    {
+        Utilities::FileHelper::StaticBufferedWriter<> writer(file);
+        ASSERT_EQ(Utilities::FileHelper::writeToFileCrc32(writer, rest, crc), Os::File::Status::OP_OK);
+    }
+    file.close();
+    ASSERT_EQ(crc, expected);
+    ASSERT_EQ(Utilities::FileHelper::crc32OfFile(TEST_FILEPATH, crc), Os::File::Status::OP_OK);
+    ASSERT_EQ(crc, expected);
+
+    std::vector<U8> read_data(data.size() + 1, 0);
+    ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_READ), Os::File::OP_OK);
+    crc = 0;
+    Fw::Buffer read_head(read_data.data(), 100);
+    ASSERT_EQ(Utilities::FileHelper::readFromFileCrc32(file, read_head, crc), Os::File::Status::OP_OK);
+    {
+        Utilities::FileHelper::StaticBufferedReader<> reader(file);
+        Fw::Buffer read_rest(read_data.data() + 100, read_data.size() - 100);
+        ASSERT_EQ(Utilities::FileHelper::readFromFileCrc32(reader, read_rest, crc), Os::File::Status::BAD_SIZE);
+    }
+    file.close();
+    ASSERT_EQ(crc, expected);
+    ASSERT_EQ(::memcmp(read_data.data(), data.data(), data.size()), 0);
+
+    // Copies fold the data into the CRC, failing on a short source
+    const CHAR* copy_path = "testfile.copy.bin";
+    Os::File destination;
+    ASSERT_EQ(file.open(TEST_FILEPATH, Os::File::OPEN_READ), Os::File::OP_OK);
+    ASSERT_EQ(destination.open(copy_path, Os::File::OPEN_CREATE, Os::File::OVERWRITE), Os::File::OP_OK);
+    crc = 0;
+    ASSERT_EQ(Utilities::FileHelper::copyFileCrc32(file, destination, data.size(), crc), Os::File::Status::OP_OK);
+    ASSERT_EQ(crc, expected);
+    ASSERT_EQ(Utilities::FileHelper::copyFileCrc32(file, destination, 1, crc), Os::File::Status::BAD_SIZE);
+    ASSERT_EQ(crc, expected);
+    file.close();
+    destination.close();
+    ASSERT_EQ(Utilities::FileHelper::crc32OfFile(copy_path, crc), Os::File::Status::OP_OK);
+    ASSERT_EQ(crc, expected);
+    (void)Os::FileSystem::removeFile(copy_path);
+    ASSERT_NE(Utilities::FileHelper::crc32OfFile(copy_path, crc), Os::File::Status::OP_OK);
+}
+
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
     int status = RUN_ALL_TESTS();
@@ -0,0 +1,167 @@
+// ======================================================================
+// \title  StreamDropDetector.cpp
+// \author starchmd
+// \brief  cpp file for StreamDropDetector component implementation class
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+
+#include "FprimeExtras/Utilities/StreamDropDetector/StreamDropDetector.hpp"
+#include "FprimeExtras/Utilities/ZeroScan/ZeroScan.hpp"
+
+#include <cstring>
+
+namespace Utilities {
+
+// ----------------------------------------------------------------------
+// Component construction and destruction
+// ----------------------------------------------------------------------
+
+StreamDropDetector ::StreamDropDetector(const char* const compName)
+    : StreamDropDetectorComponentBase(compName), m_active(false), m_fileSize(0), m_packetSize(0) {
+    ::memset(this->m_received, 0, sizeof(this->m_received));
+}
+
+StreamDropDetector ::~StreamDropDetector() {}
+
+// ----------------------------------------------------------------------
+// Handler implementations for typed input ports
+// ----------------------------------------------------------------------
+
+void StreamDropDetector ::bufferIn_handler(FwIndexType portNum, Fw::Buffer& fwBuffer) {
+    Fw::FilePacket packet;
+    // Buffers that are not valid file packets are left for the receiver to reject
+    if (packet.fromBuffer(fwBuffer) == Fw::FW_SERIALIZE_OK) {
+        switch (packet.asHeader().getType()) {
+            case Fw::FilePacket::T_START:
+                this->startFile(packet.asStartPacket());
+                break;
+            case Fw::FilePacket::T_DATA:
+                this->receiveData(packet.asDataPacket());
+                break;
+            case Fw::FilePacket::T_END:
+                this->finishFile();
+                break;
+            case Fw::FilePacket::T_CANCEL:
+                if (this->m_active) {
+                    this->log_ACTIVITY_LO_DetectingDropsCanceled();
+                    this->m_active = false;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    // The payload is inspected in-place before the buffer is handed on, it is never copied
+    this->bufferOut_out(0, fwBuffer);
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+void StreamDropDetector ::startFile(const Fw::FilePacket::StartPacket& start) {
+    if (this->m_active) {
+        this->log_ACTIVITY_LO_DetectingDropsCanceled();
+    }
+    // Path names in file packets are not null-terminated
+    const Fw::FilePacket::PathName& path = start.getDestinationPath();
+    this->m_file.format("%.*s", static_cast<int>(path.getLength()), path.getValue());
+    this->m_fileSize = start.getFileSize();
+    Fw::ParamValid valid = Fw::ParamValid::INVALID;
+    this->m_packetSize = this->paramGet_PACKET_SIZE(valid);
+    // Packet indices depend on the size of every packet of the file, which the first data packet need not show
+    if (((valid != Fw::ParamValid::VALID) && (valid != Fw::ParamValid::DEFAULT)) || (this->m_packetSize == 0)) {
+        this->m_active = false;
+        this->log_WARNING_LO_PacketSizeNotSet(this->m_file);
+        return;
+    }
+    ::memset(this->m_received, 0, sizeof(this->m_received));
+    this->m_active = true;
+    this->log_ACTIVITY_LO_DetectingDrops(this->m_file);
+    this->log_ACTIVITY_HI_PossibleDrops_ThrottleClear();
+    (void)this->checkPacketCount();
+}
+
+void StreamDropDetector ::receiveData(const Fw::FilePacket::DataPacket& data) {
+    const FwSizeType offset = data.getByteOffset();
+    const FwSizeType size = data.getDataSize();
+    if (!this->m_active || (size == 0)) {
+        return;
+    }
+    // Only data starting on a packet boundary within the file is tracked
+    if ((offset % this->m_packetSize) != 0) {
+        return;
+    }
+    // Data larger than a packet covers several packets, each checked for zeros on its own
+    const FwSizeType packets = this->getPacketCount();
+    for (FwSizeType start = 0, index = offset / this->m_packetSize; (start < size) && (index < packets);
+         start += this->m_packetSize, index++) {
+        const FwSizeType length = FW_MIN(this->m_packetSize, size - start);
+        if (!Utilities::ZeroScan::isZero(data.getData() + start, length)) {
+            this->m_received[index / 8] = static_cast<U8>(this->m_received[index / 8] | (1 << (index % 8)));
+        }
+    }
+}
+
+void StreamDropDetector ::finishFile() {
+    if (!this->m_active) {
+        return;
+    }
+    this->m_active = false;
+    const FwSizeType packets = this->getPacketCount();
+
+    Fw::ParamValid valid = Fw::ParamValid::INVALID;
+    const Fw::Enabled write_bitmap = this->paramGet_WRITE_BITMAP(valid);
+    if (((valid == Fw::ParamValid::VALID) || (valid == Fw::ParamValid::DEFAULT)) &&
+        (write_bitmap == Fw::Enabled::ENABLED)) {
+        Fw::FileNameString bitmap_path;
+        bitmap_path.format("%s%s", this->m_file.toChar(), Utilities::DROP_DETECTOR_STREAM_BITMAP_SUFFIX);
+        Os::File::Status status = this->m_bitmap.open(bitmap_path.toChar(), this->m_packetSize);
+        if (status != Os::File::OP_OK) {
+            this->log_WARNING_HI_BitmapWriteError(Os::FileStatus(static_cast<Os::FileStatus::T>(status)));
+        }
+    }
+
+    // Consecutive drops are coalesced into ranges reported as one-based indices, matching the DropDetector
+    DropRanges ranges;
+    DropRanges::Range range;
+    for (FwSizeType i = 0; i < packets; i++) {
+        const bool drop = ((this->m_received[i / 8] >> (i % 8)) & 0x1) == 0;
+        // The bitmap is left open on a failed write such that its staged bits are written again, it is closed below
+        if (this->m_bitmap.isOpen()) {
+            Os::File::Status status = this->m_bitmap.recordOrEnd(drop);
+            if (status != Os::File::OP_OK) {
+                this->log_WARNING_HI_BitmapWriteError(Os::FileStatus(static_cast<Os::FileStatus::T>(status)));
+            }
+        }
+        if (ranges.record(i, drop, range)) {
+            this->log_ACTIVITY_HI_PossibleDrops(range.first + 1, range.last + 1);
+        }
+    }
+    if (ranges.finish(packets, range)) {
+        this->log_ACTIVITY_HI_PossibleDrops(range.first + 1, range.last + 1);
+    }
+    if (this->m_bitmap.isOpen()) {
+        Os::File::Status status = this->m_bitmap.close();
+        if (status != Os::File::OP_OK) {
+            this->log_WARNING_HI_BitmapWriteError(Os::FileStatus(static_cast<Os::FileStatus::T>(status)));
+        }
+    }
+    this->log_ACTIVITY_HI_DropSummary(packets, ranges.getDrops(), ranges.getRanges());
+}
+
+bool StreamDropDetector ::checkPacketCount() {
+    if (this->getPacketCount() > Utilities::DROP_DETECTOR_STREAM_MAX_PACKETS) {
+        this->log_WARNING_LO_FileTooLarge(this->getPacketCount());
+        this->m_active = false;
+        return false;
+    }
+    return true;
+}
+
+FwSizeType StreamDropDetector ::getPacketCount() const {
+    FW_ASSERT(this->m_packetSize != 0);
+    return (this->m_fileSize / this->m_packetSize) + (((this->m_fileSize % this->m_packetSize) != 0) ? 1 : 0);
+}
+
+}  // namespace Utilities
@@ -0,0 +1,78 @@
+// ======================================================================
+// \title  StreamDropDetector.hpp
+// \author starchmd
+// \brief  hpp file for StreamDropDetector component implementation class
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+
+#ifndef Utilities_StreamDropDetector_HPP
+#define Utilities_StreamDropDetector_HPP
+
+#include "ExtrasConfig/DropDetectorConfig.hpp"
+#include "FprimeExtras/Utilities/DropBitmap/DropBitmap.hpp"
+#include "FprimeExtras/Utilities/DropBitmap/DropRanges.hpp"
+#include "FprimeExtras/Utilities/StreamDropDetector/StreamDropDetectorComponentAc.hpp"
+#include "Fw/FilePacket/FilePacket.hpp"
+#include "Fw/Types/FileNameString.hpp"
+
+namespace Utilities {
+
+class StreamDropDetector final : public StreamDropDetectorComponentBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Component construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct StreamDropDetector object
+    StreamDropDetector(const char* const compName  //!< The component name
+    );
+
+    //! Destroy StreamDropDetector object
+    ~StreamDropDetector();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Handler implementations for typed input ports
+    // ----------------------------------------------------------------------
+
+    //! Handler implementation for bufferIn
+    //!
+    //! Uplinked file packets to inspect
+    void bufferIn_handler(FwIndexType portNum,  //!< The port number
+                          Fw::Buffer& fwBuffer  //!< The buffer
+                          ) override;
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Start tracking the file announced by a start packet, abandoning any file in progress
+    void startFile(const Fw::FilePacket::StartPacket& start  //!< The start packet
+    );
+
+    //! Record the payload of a data packet of the file in progress
+    void receiveData(const Fw::FilePacket::DataPacket& data  //!< The data packet
+    );
+
+    //! Report the drops of the file in progress, writing its bitmap file when enabled
+    void finishFile();
+
+    //! Stop tracking the file in progress when it has too many packets, returning false when stopped
+    bool checkPacketCount();
+
+    //! Get the number of packets of the file in progress, including a short final packet
+    FwSizeType getPacketCount() const;
+
+    bool m_active;              //!< A file is being tracked
+    Fw::FileNameString m_file;  //!< Destination path of the file in progress
+    FwSizeType m_fileSize;      //!< Size of the file in progress
+    FwSizeType m_packetSize;    //!< Packet size of the file in progress
+
+    DropBitmapWriter m_bitmap;
+    U8 m_received[(Utilities::DROP_DETECTOR_STREAM_MAX_PACKETS + 7) / 8];  //!< Packets received with data, LSB-first
+};
+
+}  // namespace Utilities
+
+#endif
@@ -0,0 +1,39 @@
+// ======================================================================
+// \title  StreamDropDetectorTestMain.cpp
+// \author starchmd
+// \brief  cpp file for StreamDropDetector component test main function
+// ======================================================================
+
+#include "StreamDropDetectorTester.hpp"
+#include "STest/Random/Random.hpp"
+
+TEST_F(StreamHarness, Drops) {
+    Utilities::StreamDropDetectorTester tester;
+    tester.test_drops(*this);
+}
+
+TEST_F(StreamHarness, UnsetSize) {
+    Utilities::StreamDropDetectorTester tester;
+    tester.test_unset_size(*this);
+}
+
+TEST_F(StreamHarness, Bitmap) {
+    Utilities::StreamDropDetectorTester tester;
+    tester.test_bitmap(*this);
+}
+
+TEST_F(StreamHarness, SpanningData) {
+    Utilities::StreamDropDetectorTester tester;
+    tester.test_spanning_data(*this);
+}
+
+TEST_F(StreamHarness, Cancel) {
+    Utilities::StreamDropDetectorTester tester;
+    tester.test_cancel(*this);
+}
+
+int main(int argc, char** argv) {
+    STest::Random::seed();
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,222 @@
+// ======================================================================
+// \title  StreamDropDetectorTester.cpp
+// \author starchmd
+// \brief  cpp file for StreamDropDetector component test harness implementation class
+// ======================================================================
+
+#include "StreamDropDetectorTester.hpp"
+#include "ExtrasConfig/DropDetectorConfig.hpp"
+#include "FprimeExtras/Utilities/DropBitmap/test/ut/DropRangesHelper.hpp"
+#include "FprimeExtras/Utilities/FileHelper/FileHelper.hpp"
+#include "Os/FileSystem.hpp"
+#include "STest/Pick/Pick.hpp"
+
+void StreamHarness ::SetUp() {
+    TEST_PACKET_SIZE = STest::Pick::lowerUpper(1, 512);
+    this->final_size = STest::Pick::lowerUpper(1, static_cast<U32>(TEST_PACKET_SIZE));
+    const U32 packets = STest::Pick::lowerUpper(1, 2000);
+    for (U32 i = 0; i < packets; i++) {
+        const U32 pick = STest::Pick::lowerUpper(0, 9);
+        const Arrival arrival = (pick == 0) ? Arrival::ZEROS : ((pick == 1) ? Arrival::MISSING : Arrival::SENT);
+        if (arrival != Arrival::SENT) {
+            this->drop_indices.push_back(i + 1);  // one-based index
+        }
+        this->arrivals.push_back(arrival);
+    }
+}
+
+std::vector<std::pair<FwSizeType, FwSizeType>> StreamHarness ::drop_ranges() const {
+    return coalesce_drops(this->drop_indices);
+}
+
+FwSizeType StreamHarness ::file_size() const {
+    return ((this->arrivals.size() - 1) * this->TEST_PACKET_SIZE) + this->final_size;
+}
+
+namespace Utilities {
+
+// ----------------------------------------------------------------------
+// Construction and destruction
+// ----------------------------------------------------------------------
+
+StreamDropDetectorTester ::StreamDropDetectorTester()
+    : StreamDropDetectorGTestBase("StreamDropDetectorTester", StreamDropDetectorTester::MAX_HISTORY_SIZE),
+      component("StreamDropDetector") {
+    this->initComponents();
+    this->connectPorts();
+}
+
+StreamDropDetectorTester ::~StreamDropDetectorTester() {}
+
+// ----------------------------------------------------------------------
+// Tests
+// ----------------------------------------------------------------------
+
+void StreamDropDetectorTester ::test_drops(StreamHarness& harness) {
+    this->paramSet_PACKET_SIZE(harness.TEST_PACKET_SIZE, Fw::ParamValid::VALID);
+    this->component.loadParameters();
+    const FwSizeType sent = this->sendFile(harness, true);
+    // Every buffer is forwarded unchanged
+    ASSERT_from_bufferOut_SIZE(sent);
+    ASSERT_EVENTS_DetectingDrops_SIZE(1);
+    this->assertDropEvents(harness);
+}
+
+void StreamDropDetectorTester ::test_unset_size(StreamHarness& harness) {
+    // Files are not tracked without a packet size, but are still forwarded
+    const FwSizeType sent = this->sendFile(harness, true);
+    ASSERT_from_bufferOut_SIZE(sent);
+    ASSERT_EVENTS_PacketSizeNotSet_SIZE(1);
+    ASSERT_EVENTS_DetectingDrops_SIZE(0);
+    ASSERT_EVENTS_PossibleDrops_SIZE(0);
+    ASSERT_EVENTS_DropSummary_SIZE(0);
+}
+
+void StreamDropDetectorTester ::test_bitmap(StreamHarness& harness) {
+    Fw::String bitmap_path;
+    bitmap_path.format("%s%s", harness.TEST_FILE_NAME, Utilities::DROP_DETECTOR_STREAM_BITMAP_SUFFIX);
+    this->paramSet_PACKET_SIZE(harness.TEST_PACKET_SIZE, Fw::ParamValid::VALID);
+    this->paramSet_WRITE_BITMAP(Fw::Enabled::ENABLED, Fw::ParamValid::VALID);
+    this->component.loadParameters();
+    (void)this->sendFile(harness, true);
+    this->assertDropEvents(harness);
+    ASSERT_EVENTS_BitmapWriteError_SIZE(0);
+
+    // Header fields
+    Os::File file;
+    ASSERT_EQ(file.open(bitmap_path.toChar(), Os::File::OPEN_READ), Os::File::OP_OK);
+    U32 magic = 0;
+    U64 packet_size = 0;
+    U64 packet_count = 0;
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(file, magic), Os::File::OP_OK);
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(file, packet_size), Os::File::OP_OK);
+    ASSERT_EQ(Utilities::FileHelper::readFromFile(file, packet_count), Os::File::OP_OK);
+    ASSERT_EQ(magic, DropBitmapWriter::DROP_BITMAP_MAGIC);
+    ASSERT_EQ(packet_size, harness.TEST_PACKET_SIZE);
+    ASSERT_EQ(packet_count, harness.arrivals.size());
+
+    // One bit per packet, set for each drop
+    U8 byte = 0;
+    for (FwSizeType i = 0; i < packet_count; i++) {
+        if ((i % 8) == 0) {
+            ASSERT_EQ(Utilities::FileHelper::readFromFile(file, byte), Os::File::OP_OK);
+        }
+        const bool expected = harness.arrivals[i] != StreamHarness::Arrival::SENT;
+        ASSERT_EQ(((byte >> (7 - (i % 8))) & 0x1) == 1, expected) << "Mismatch at packet " << i;
+    }
+    file.close();
+    (void)Os::FileSystem::removeFile(bitmap_path.toChar());
+}
+
+void StreamDropDetectorTester ::test_spanning_data(StreamHarness& harness) {
+    // Data packets of up to four packets each, such that each data packet covers several packets
+    const FwSizeType span = 4;
+    harness.TEST_PACKET_SIZE = STest::Pick::lowerUpper(1, 128);
+    harness.final_size = STest::Pick::lowerUpper(1, static_cast<U32>(harness.TEST_PACKET_SIZE));
+    this->paramSet_PACKET_SIZE(harness.TEST_PACKET_SIZE, Fw::ParamValid::VALID);
+    this->component.loadParameters();
+    (void)this->sendFile(harness, true, span);
+    // Every packet covered by a data packet is tracked, not only the first
+    this->assertDropEvents(harness);
+}
+
+void StreamDropDetectorTester ::test_cancel(StreamHarness& harness) {
+    this->paramSet_PACKET_SIZE(harness.TEST_PACKET_SIZE, Fw::ParamValid::VALID);
+    this->component.loadParameters();
+    (void)this->sendFile(harness, false);
+    Fw::FilePacket::CancelPacket cancel;
+    cancel.initialize(static_cast<U32>(harness.arrivals.size() + 1));
+    Fw::FilePacket packet;
+    packet.fromCancelPacket(cancel);
+    this->sendPacket(packet);
+    ASSERT_EVENTS_DetectingDropsCanceled_SIZE(1);
+
+    // An end packet following the cancel reports nothing
+    Fw::FilePacket::EndPacket end;
+    end.initialize(static_cast<U32>(harness.arrivals.size() + 2), CFDP::Checksum());
+    packet.fromEndPacket(end);
+    this->sendPacket(packet);
+    ASSERT_EVENTS_DropSummary_SIZE(0);
+    ASSERT_EVENTS_PossibleDrops_SIZE(0);
+
+    // A following uplink is detected afresh
+    this->clearHistory();
+    (void)this->sendFile(harness, true);
+    this->assertDropEvents(harness);
+}
+
+// ----------------------------------------------------------------------
+// Helper functions
+// ----------------------------------------------------------------------
+
+FwSizeType StreamDropDetectorTester ::sendFile(const StreamHarness& harness, bool end, FwSizeType span) {
+    FwSizeType sent = 0;
+    U32 sequence = 0;
+    Fw::FilePacket packet;
+    Fw::FilePacket::StartPacket start;
+    start.initialize(static_cast<U32>(harness.file_size()), "source.bin", harness.TEST_FILE_NAME);
+    packet.fromStartPacket(start);
+    this->sendPacket(packet);
+    sent++;
+
+    U8 payload[512];
+    FwSizeType i = 0;
+    while (i < harness.arrivals.size()) {
+        sequence++;
+        if (harness.arrivals[i] == StreamHarness::Arrival::MISSING) {
+            i++;
+            continue;
+        }
+        // Consecutive packets that arrive are combined into data packets of up to span packets
+        const FwSizeType first = i;
+        FwSizeType size = 0;
+        while ((i < harness.arrivals.size()) && ((i - first) < span) &&
+               (harness.arrivals[i] != StreamHarness::Arrival::MISSING)) {
+            const FwSizeType length =
+                (i == (harness.arrivals.size() - 1)) ? harness.final_size : harness.TEST_PACKET_SIZE;
+            for (FwSizeType j = 0; j < length; j++) {
+                payload[size + j] = (harness.arrivals[i] == StreamHarness::Arrival::ZEROS)
+                                        ? 0
+                                        : static_cast<U8>(STest::Pick::lowerUpper(1, 255));
+            }
+            size += length;
+            i++;
+        }
+        Fw::FilePacket::DataPacket data;
+        data.initialize(sequence, static_cast<U32>(first * harness.TEST_PACKET_SIZE), static_cast<U16>(size), payload);
+        packet.fromDataPacket(data);
+        this->sendPacket(packet);
+        sent++;
+    }
+    if (end) {
+        Fw::FilePacket::EndPacket end_packet;
+        end_packet.initialize(sequence + 1, CFDP::Checksum());
+        packet.fromEndPacket(end_packet);
+        this->sendPacket(packet);
+        sent++;
+    }
+    return sent;
+}
+
+void StreamDropDetectorTester ::sendPacket(const Fw::FilePacket& packet) {
+    Fw::Buffer buffer(this->m_storage, sizeof(this->m_storage));
+    ASSERT_LE(packet.bufferSize(), sizeof(this->m_storage));
+    buffer.setSize(packet.bufferSize());
+    ASSERT_EQ(packet.toBuffer(buffer), Fw::FW_SERIALIZE_OK);
+    this->invoke_to_bufferIn(0, buffer);
+}
+
+void StreamDropDetectorTester ::assertDropEvents(const StreamHarness& harness) {
+    const std::vector<std::pair<FwSizeType, FwSizeType>> ranges = harness.drop_ranges();
+    // Range events beyond the throttle are suppressed, the summary still counts every range
+    const FwSizeType reported = FW_MIN(
+        ranges.size(), static_cast<FwSizeType>(StreamDropDetectorComponentBase::EVENTID_POSSIBLEDROPS_THROTTLE));
+    ASSERT_EVENTS_PossibleDrops_SIZE(reported);
+    for (FwSizeType i = 0; i < reported; i++) {
+        ASSERT_EVENTS_PossibleDrops(i, ranges[i].first, ranges[i].second);
+    }
+    ASSERT_EVENTS_DropSummary_SIZE(1);
+    ASSERT_EVENTS_DropSummary(0, harness.arrivals.size(), harness.drop_indices.size(), ranges.size());
+}
+
+}  // namespace Utilities
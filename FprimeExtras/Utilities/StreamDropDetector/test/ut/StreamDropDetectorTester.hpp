@@ -0,0 +1,121 @@
+// ======================================================================
+// \title  StreamDropDetectorTester.hpp
+// \author starchmd
+// \brief  hpp file for StreamDropDetector component test harness implementation class
+// ======================================================================
+
+#ifndef Utilities_StreamDropDetectorTester_HPP
+#define Utilities_StreamDropDetectorTester_HPP
+
+#include "FprimeExtras/Utilities/StreamDropDetector/StreamDropDetector.hpp"
+#include "FprimeExtras/Utilities/StreamDropDetector/StreamDropDetectorGTestBase.hpp"
+#include <utility>
+#include <vector>
+
+class StreamHarness : public testing::Test {
+  public:
+    //! \brief how a packet of the uplinked file arrives
+    enum Arrival {
+        SENT,     //!< Packet arrives with data
+        ZEROS,    //!< Packet arrives with a payload of zeros
+        MISSING,  //!< Packet never arrives
+    };
+
+    //! \brief set up test harness, packets, etc
+    void SetUp() override;
+
+    //! \brief get the expected [first, last] ranges of drops as one-based indices
+    std::vector<std::pair<FwSizeType, FwSizeType>> drop_ranges() const;
+
+    //! \brief get the size of the uplinked file
+    FwSizeType file_size() const;
+
+    const char* TEST_FILE_NAME = "test_stream_file.bin";
+    FwSizeType TEST_PACKET_SIZE;
+    FwSizeType final_size;
+    std::vector<Arrival> arrivals;
+    std::vector<U32> drop_indices;
+};
+
+namespace Utilities {
+
+class StreamDropDetectorTester final : public StreamDropDetectorGTestBase {
+  public:
+    // ----------------------------------------------------------------------
+    // Constants
+    // ----------------------------------------------------------------------
+
+    // Maximum size of histories storing events, telemetry, and port outputs
+    static const FwSizeType MAX_HISTORY_SIZE = 3000;
+
+    // Instance ID supplied to the component instance under test
+    static const FwEnumStoreType TEST_INSTANCE_ID = 0;
+
+  public:
+    // ----------------------------------------------------------------------
+    // Construction and destruction
+    // ----------------------------------------------------------------------
+
+    //! Construct object StreamDropDetectorTester
+    StreamDropDetectorTester();
+
+    //! Destroy object StreamDropDetectorTester
+    ~StreamDropDetectorTester();
+
+  public:
+    // ----------------------------------------------------------------------
+    // Tests
+    // ----------------------------------------------------------------------
+
+    //! Test uplink with drops and a configured packet size
+    void test_drops(StreamHarness& harness);
+
+    //! Test uplink without a configured packet size
+    void test_unset_size(StreamHarness& harness);
+
+    //! Test uplink with drops recorded to a bitmap file
+    void test_bitmap(StreamHarness& harness);
+
+    //! Test uplink with data packets larger than the packet size
+    void test_spanning_data(StreamHarness& harness);
+
+    //! Test canceled uplink
+    void test_cancel(StreamHarness& harness);
+
+  private:
+    // ----------------------------------------------------------------------
+    // Helper functions
+    // ----------------------------------------------------------------------
+
+    //! Send the packets of the harness file, ending with an end packet when end is set. Consecutive packets that
+    //! arrive are sent together in data packets of up to span packets.
+    //! \return number of packets sent
+    FwSizeType sendFile(const StreamHarness& harness, bool end, FwSizeType span = 1);
+
+    //! Serialize a file packet into a buffer and send it to the component
+    void sendPacket(const Fw::FilePacket& packet);
+
+    //! Assert the drop range and summary events match the harness drops
+    void assertDropEvents(const StreamHarness& harness);
+
+    //! Connect ports
+    void connectPorts();
+
+    //! Initialize components
+    void initComponents();
+
+  private:
+    // ----------------------------------------------------------------------
+    // Member variables
+    // ----------------------------------------------------------------------
+
+    //! The component under test
+    StreamDropDetector component;
+
+    //! Storage of serialized file packets
+    U8 m_storage[1024];
+};
+
+}  // namespace Utilities
+
+#endif
@@ -0,0 +1,194 @@
+// ======================================================================
+// \title  ZeroScan.cpp
+// \author starchmd
+// \brief  cpp file for ZeroScan zero-detection kernels
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#include "FprimeExtras/Utilities/ZeroScan/ZeroScan.hpp"
+
+#include <cstdint>
+#include <cstring>
+
+#include "Fw/Types/Assert.hpp"
+
+// SIMD kernels are built with per-function target attributes such that the rest of the library does not require any
+// special compiler flags. SSE2 is part of the x86-64 baseline, AVX2 must be detected at runtime.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && defined(__SSE2__)
+#define ZERO_SCAN_X86 1
+#include <immintrin.h>
+#else
+#define ZERO_SCAN_X86 0
+#endif
+
+namespace Utilities {
+namespace ZeroScan {
+namespace {
+
+//! Kernel function signature shared by all implementations
+typedef FwSizeType (*KernelFunction)(const U8* data, FwSizeType size);
+
+//! \brief scalar search of a short run, used for heads, tails and to locate a byte within a non-zero block
+FwSizeType findNonZeroBytes(const U8* data, FwSizeType start, FwSizeType size) {
+    for (FwSizeType i = start; i < size; i++) {
+        if (data[i] != 0) {
+            return i;
+        }
+    }
+    return size;
+}
+
+//! \brief portable word-at-a-time kernel
+//!
+//! Bytes are consumed individually until the pointer is word aligned. Words are then OR'ed together in groups of four
+//! such that only a single branch is taken per 32 bytes on 64-bit machines. Once a non-zero group is found, the
+//! exact byte is located with the scalar search.
+FwSizeType findNonZeroPortable(const U8* data, FwSizeType size) {
+    typedef uintptr_t Word;
+    constexpr FwSizeType WORD_SIZE = sizeof(Word);
+    constexpr FwSizeType BLOCK_SIZE = 4 * WORD_SIZE;
+
+    // Consume unaligned head
+    FwSizeType index = 0;
+    while ((index < size) && ((reinterpret_cast<uintptr_t>(data + index) % WORD_SIZE) != 0)) {
+        if (data[index] != 0) {
+            return index;
+        }
+        index++;
+    }
+    // Consume aligned blocks of four words
+    for (; (size - index) >= BLOCK_SIZE; index += BLOCK_SIZE) {
+        Word words[4];
+        (void)::memcpy(words, data + index, BLOCK_SIZE);
+        if ((words[0] | words[1] | words[2] | words[3]) != 0) {
+            return findNonZeroBytes(data, index, index + BLOCK_SIZE);
+        }
+    }
+    // Consume remaining whole words
+    for (; (size - index) >= WORD_SIZE; index += WORD_SIZE) {
+        Word word;
+        (void)::memcpy(&word, data + index, WORD_SIZE);
+        if (word != 0) {
+            return findNonZeroBytes(data, index, index + WORD_SIZE);
+        }
+    }
+    return findNonZeroBytes(data, index, size);
+}
+
+#if ZERO_SCAN_X86
+//! \brief SSE2 kernel processing 64 bytes per iteration
+FwSizeType findNonZeroSse2(const U8* data, FwSizeType size) {
+    constexpr FwSizeType VECTOR_SIZE = sizeof(__m128i);
+    constexpr FwSizeType BLOCK_SIZE = 4 * VECTOR_SIZE;
+    const __m128i zero = _mm_setzero_si128();
+
+    FwSizeType index = 0;
+    for (; (size - index) >= BLOCK_SIZE; index += BLOCK_SIZE) {
+        const __m128i* block = reinterpret_cast<const __m128i*>(data + index);
+        __m128i merged = _mm_or_si128(_mm_or_si128(_mm_loadu_si128(block), _mm_loadu_si128(block + 1)),
+                                      _mm_or_si128(_mm_loadu_si128(block + 2), _mm_loadu_si128(block + 3)));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(merged, zero)) != 0xFFFF) {
+            return findNonZeroBytes(data, index, index + BLOCK_SIZE);
+        }
+    }
+    for (; (size - index) >= VECTOR_SIZE; index += VECTOR_SIZE) {
+        __m128i vector = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(vector, zero)) != 0xFFFF) {
+            return findNonZeroBytes(data, index, index + VECTOR_SIZE);
+        }
+    }
+    return findNonZeroBytes(data, index, size);
+}
+
+//! \brief AVX2 kernel processing 128 bytes per iteration
+__attribute__((target("avx2"))) FwSizeType findNonZeroAvx2(const U8* data, FwSizeType size) {
+    constexpr FwSizeType VECTOR_SIZE = sizeof(__m256i);
+    constexpr FwSizeType BLOCK_SIZE = 4 * VECTOR_SIZE;
+
+    FwSizeType index = 0;
+    for (; (size - index) >= BLOCK_SIZE; index += BLOCK_SIZE) {
+        const __m256i* block = reinterpret_cast<const __m256i*>(data + index);
+        __m256i merged = _mm256_or_si256(_mm256_or_si256(_mm256_loadu_si256(block), _mm256_loadu_si256(block + 1)),
+                                         _mm256_or_si256(_mm256_loadu_si256(block + 2), _mm256_loadu_si256(block + 3)));
+        if (!_mm256_testz_si256(merged, merged)) {
+            return findNonZeroBytes(data, index, index + BLOCK_SIZE);
+        }
+    }
+    for (; (size - index) >= VECTOR_SIZE; index += VECTOR_SIZE) {
+        __m256i vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + index));
+        if (!_mm256_testz_si256(vector, vector)) {
+            return findNonZeroBytes(data, index, index + VECTOR_SIZE);
+        }
+    }
+    // Less than one vector remains, finish with the SSE2 kernel
+    return index + findNonZeroSse2(data + index, size - index);
+}
+#endif
+
+//! \brief get the function implementing a supported kernel
+KernelFunction getFunction(Kernel kernel) {
+    switch (kernel) {
+#if ZERO_SCAN_X86
+        case Kernel::SSE2:
+            return findNonZeroSse2;
+        case Kernel::AVX2:
+            return findNonZeroAvx2;
+#endif
+        default:
+            return findNonZeroPortable;
+    }
+}
+
+//! \brief select the fastest kernel supported by this CPU
+Kernel selectKernel() {
+    Kernel selected = Kernel::PORTABLE;
+    for (FwSizeType i = 0; i < Kernel::NUM_KERNELS; i++) {
+        Kernel candidate = static_cast<Kernel>(i);
+        if (isSupported(candidate)) {
+            selected = candidate;
+        }
+    }
+    return selected;
+}
+
+//! \brief get the function of the selected kernel, selecting it on first use
+KernelFunction getSelectedFunction() {
+    // Function-local statics are initialized exactly once, even when first called from multiple threads
+    static const KernelFunction selected = getFunction(getKernel());
+    return selected;
+}
+
+}  // namespace
+
+bool isSupported(Kernel kernel) {
+    switch (kernel) {
+        case Kernel::PORTABLE:
+            return true;
+#if ZERO_SCAN_X86
+        case Kernel::SSE2:
+            return true;
+        case Kernel::AVX2:
+            return __builtin_cpu_supports("avx2");
+#endif
+        default:
+            return false;
+    }
+}
+
+Kernel getKernel() {
+    static const Kernel selected = selectKernel();
+    return selected;
+}
+
+FwSizeType findNonZero(const U8* data, FwSizeType size) {
+    FW_ASSERT((data != nullptr) || (size == 0));
+    return getSelectedFunction()(data, size);
+}
+
+FwSizeType findNonZero(Kernel kernel, const U8* data, FwSizeType size) {
+    FW_ASSERT((data != nullptr) || (size == 0));
+    FW_ASSERT(isSupported(kernel), static_cast<FwAssertArgType>(kernel));
+    return getFunction(kernel)(data, size);
+}
+
+}  // namespace ZeroScan
+}  // namespace Utilities
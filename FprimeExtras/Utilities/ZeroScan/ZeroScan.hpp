@@ -0,0 +1,76 @@
+// ======================================================================
+// \title  ZeroScan.hpp
+// \author starchmd
+// \brief  hpp file for ZeroScan zero-detection kernels
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#ifndef FprimeExtras_Utilities_ZeroScan_HPP
+#define FprimeExtras_Utilities_ZeroScan_HPP
+
+#include "Fw/FPrimeBasicTypes.hpp"
+
+namespace Utilities {
+namespace ZeroScan {
+
+//! \brief implementations of the zero-detection kernel
+//!
+//! PORTABLE is available on every platform and processes a machine word at a time. The SIMD kernels are only
+//! available on x86 targets and are selected at runtime based on the capabilities of the running CPU.
+enum Kernel {
+    PORTABLE,  //!< Word-at-a-time kernel written in plain C++
+    SSE2,      //!< 16-byte vector kernel
+    AVX2,      //!< 32-byte vector kernel
+    NUM_KERNELS
+};
+
+//! \brief check if the given kernel can run on this platform and CPU
+//!
+//! \param kernel the kernel to check
+//! \return true when the kernel was compiled in and the CPU supports it, false otherwise
+bool isSupported(Kernel kernel);
+
+//! \brief get the kernel selected for this CPU
+//!
+//! The fastest supported kernel is selected once on first use and is used by findNonZero and isZero.
+//!
+//! \return kernel used by the dispatching functions
+Kernel getKernel();
+
+//! \brief find the first non-zero byte in a block of memory
+//!
+//! Searches data for the first byte that is not zero using the kernel selected for this CPU.
+//!
+//! \warning It is invalid to call this function with a null data pointer and a non-zero size and results in an
+//!          assertion failure.
+//!
+//! \param data pointer to the memory to search
+//! \param size number of bytes to search
+//! \return offset of the first non-zero byte, or size when every byte is zero
+FwSizeType findNonZero(const U8* data, FwSizeType size);
+
+//! \brief find the first non-zero byte in a block of memory using a specific kernel
+//!
+//! Identical to findNonZero, but uses the supplied kernel. This is used to test and benchmark kernels against each
+//! other.
+//!
+//! \warning It is invalid to call this function with an unsupported kernel and results in an assertion failure.
+//!
+//! \param kernel kernel to use. Must be supported (see isSupported).
+//! \param data pointer to the memory to search
+//! \param size number of bytes to search
+//! \return offset of the first non-zero byte, or size when every byte is zero
+FwSizeType findNonZero(Kernel kernel, const U8* data, FwSizeType size);
+
+//! \brief check if a block of memory is entirely zero
+//!
+//! \param data pointer to the memory to check
+//! \param size number of bytes to check
+//! \return true when every byte is zero (or size is zero), false otherwise
+inline bool isZero(const U8* data, FwSizeType size) {
+    return findNonZero(data, size) == size;
+}
+
+}  // namespace ZeroScan
+}  // namespace Utilities
+
+#endif  // FprimeExtras_Utilities_ZeroScan_HPP
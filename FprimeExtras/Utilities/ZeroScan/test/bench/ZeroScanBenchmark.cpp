@@ -0,0 +1,99 @@
+// ======================================================================
+// \title  ZeroScanBenchmark.cpp
+// \author starchmd
+// \brief  cpp file for ZeroScan kernel microbenchmark
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+//
+// Compares the throughput of each supported ZeroScan kernel against the original byte-at-a-time loop used by
+// DropDetector::readPacket. Buffers are entirely zero such that every byte must be inspected, which is the worst case
+// for drop detection. Usage:
+//
+//     ZeroScanBenchmark [total_megabytes]
+//
+// Results are printed one line per (kernel, block size) as: kernel block_bytes bytes_per_second speedup
+//
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "FprimeExtras/Utilities/ZeroScan/ZeroScan.hpp"
+
+namespace {
+
+//! Default amount of data scanned per measurement
+constexpr FwSizeType DEFAULT_TOTAL_MEGABYTES = 256;
+
+//! Block sizes to measure. 256 matches the default DROP_DETECTOR_FILE_READ_BUFFER_SIZE.
+constexpr FwSizeType BLOCK_SIZES[] = {256, 4096, 65536, 1048576};
+
+//! Prevents the compiler from discarding benchmark results
+volatile FwSizeType g_sink = 0;
+
+//! \brief original DropDetector::readPacket scanning loop
+FwSizeType findNonZeroLegacy(const U8* data, FwSizeType size) {
+    for (FwSizeType j = 0; j < size; j++) {
+        if (data[j] != 0) {
+            return j;
+        }
+    }
+    return size;
+}
+
+const char* kernelName(Utilities::ZeroScan::Kernel kernel) {
+    switch (kernel) {
+        case Utilities::ZeroScan::Kernel::PORTABLE:
+            return "portable";
+        case Utilities::ZeroScan::Kernel::SSE2:
+            return "sse2";
+        case Utilities::ZeroScan::Kernel::AVX2:
+            return "avx2";
+        default:
+            return "unknown";
+    }
+}
+
+//! \brief measure the bytes/second of a scanning function across total bytes using the given block size
+template <typename Function>
+double measure(Function function, const std::vector<U8>& data, FwSizeType block, FwSizeType total) {
+    const FwSizeType iterations = total / block;
+    auto start = std::chrono::steady_clock::now();
+    for (FwSizeType i = 0; i < iterations; i++) {
+        const FwSizeType offset = (i * block) % (data.size() - block + 1);
+        g_sink = g_sink + function(data.data() + offset, block);
+    }
+    auto stop = std::chrono::steady_clock::now();
+    const double seconds = std::chrono::duration<double>(stop - start).count();
+    return static_cast<double>(iterations * block) / seconds;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const FwSizeType total_megabytes = (argc > 1) ? static_cast<FwSizeType>(::strtoull(argv[1], nullptr, 10))
+                                                  : DEFAULT_TOTAL_MEGABYTES;
+    const FwSizeType total = total_megabytes * 1024 * 1024;
+    // Working set larger than the largest block and small enough to stay in cache for smaller blocks
+    std::vector<U8> data(4 * 1048576, 0);
+
+    (void)::printf("# selected kernel: %s\n", kernelName(Utilities::ZeroScan::getKernel()));
+    (void)::printf("# kernel block_bytes bytes_per_second speedup\n");
+    for (FwSizeType block : BLOCK_SIZES) {
+        const double legacy = measure(findNonZeroLegacy, data, block, total);
+        (void)::printf("legacy %" PRI_FwSizeType " %.0f %.2f\n", block, legacy, 1.0);
+        for (FwSizeType i = 0; i < Utilities::ZeroScan::Kernel::NUM_KERNELS; i++) {
+            const Utilities::ZeroScan::Kernel kernel = static_cast<Utilities::ZeroScan::Kernel>(i);
+            if (!Utilities::ZeroScan::isSupported(kernel)) {
+                continue;
+            }
+            const double rate = measure(
+                [kernel](const U8* bytes, FwSizeType size) {
+                    return Utilities::ZeroScan::findNonZero(kernel, bytes, size);
+                },
+                data, block, total);
+            (void)::printf("%s %" PRI_FwSizeType " %.0f %.2f\n", kernelName(kernel), block, rate, rate / legacy);
+        }
+    }
+    return 0;
+}
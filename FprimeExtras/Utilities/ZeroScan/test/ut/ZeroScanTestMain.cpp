@@ -0,0 +1,74 @@
+// ======================================================================
+// \title  ZeroScanTestMain.cpp
+// \author starchmd
+// \brief  cpp file for ZeroScan unit tests
+// \copyright Copyright (c) 2025 Michael Starch
+// ======================================================================
+#include <gtest/gtest.h>
+
+#include "FprimeExtras/Utilities/ZeroScan/ZeroScan.hpp"
+
+// Large enough to exercise heads, unrolled blocks, and tails of every kernel
+constexpr FwSizeType TEST_BUFFER_SIZE = 1024;
+// Offsets used to misalign the start of the scanned data
+constexpr FwSizeType TEST_MAX_OFFSET = 64;
+
+//! \brief check a kernel against every position of a single non-zero byte at every alignment
+void testKernel(Utilities::ZeroScan::Kernel kernel) {
+    U8 storage[TEST_BUFFER_SIZE + TEST_MAX_OFFSET] = {0};
+    for (FwSizeType offset = 0; offset < TEST_MAX_OFFSET; offset += 7) {
+        U8* data = storage + offset;
+        for (FwSizeType size = 0; size <= TEST_BUFFER_SIZE; size += 61) {
+            // All zero data reports the size
+            ASSERT_EQ(Utilities::ZeroScan::findNonZero(kernel, data, size), size);
+            for (FwSizeType position = 0; position < size; position++) {
+                data[position] = 0x80;
+                ASSERT_EQ(Utilities::ZeroScan::findNonZero(kernel, data, size), position);
+                // A second non-zero byte after the first must not change the result
+                if ((position + 1) < size) {
+                    data[size - 1] = 0x01;
+                    ASSERT_EQ(Utilities::ZeroScan::findNonZero(kernel, data, size), position);
+                    data[size - 1] = 0;
+                }
+                data[position] = 0;
+            }
+        }
+    }
+}
+
+TEST(ZeroScanTest, PortableKernel) {
+    testKernel(Utilities::ZeroScan::Kernel::PORTABLE);
+}
+
+TEST(ZeroScanTest, Sse2Kernel) {
+    if (!Utilities::ZeroScan::isSupported(Utilities::ZeroScan::Kernel::SSE2)) {
+        GTEST_SKIP() << "SSE2 not supported on this platform";
+    }
+    testKernel(Utilities::ZeroScan::Kernel::SSE2);
+}
+
+TEST(ZeroScanTest, Avx2Kernel) {
+    if (!Utilities::ZeroScan::isSupported(Utilities::ZeroScan::Kernel::AVX2)) {
+        GTEST_SKIP() << "AVX2 not supported on this platform";
+    }
+    testKernel(Utilities::ZeroScan::Kernel::AVX2);
+}
+
+TEST(ZeroScanTest, SelectedKernel) {
+    U8 data[TEST_BUFFER_SIZE] = {0};
+    ASSERT_TRUE(Utilities::ZeroScan::isSupported(Utilities::ZeroScan::getKernel()));
+    ASSERT_TRUE(Utilities::ZeroScan::isZero(data, sizeof(data)));
+    ASSERT_TRUE(Utilities::ZeroScan::isZero(nullptr, 0));
+    data[TEST_BUFFER_SIZE - 1] = 1;
+    ASSERT_FALSE(Utilities::ZeroScan::isZero(data, sizeof(data)));
+    ASSERT_EQ(Utilities::ZeroScan::findNonZero(data, sizeof(data)), TEST_BUFFER_SIZE - 1);
+}
+
+TEST(ZeroScanTest, DeathNullPointer) {
+    ASSERT_DEATH(Utilities::ZeroScan::findNonZero(nullptr, 1), ".*ZeroScan");
+}
+
+int main(int argc, char* argv[]) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}